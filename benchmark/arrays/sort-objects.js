@@ -0,0 +1,26 @@
+'use strict';
+var common = require('../common.js');
+var bench = common.createBenchmark(main, {
+  order: ['random', 'sorted', 'runs'],
+  n: [1e5]
+});
+
+function main(conf) {
+  var n = +conf.n;
+  var arr = new Array(n);
+
+  bench.start();
+  for (var i = 0; i < 10; ++i) {
+    for (var j = 0; j < n; ++j) {
+      var key;
+      switch (conf.order) {
+        case 'random': key = Math.random(); break;
+        case 'sorted': key = j; break;
+        case 'runs': key = (j % 1000) * 3 + ((j / 1000) | 0); break;
+      }
+      arr[j] = { key: key, index: j };
+    }
+    arr.sort(function(a, b) { return a.key - b.key; });
+  }
+  bench.end(10);
+}
@@ -0,0 +1,35 @@
+'use strict';
+var common = require('../common.js');
+var bench = common.createBenchmark(main, {
+  type: ['Array', 'Int8Array', 'Uint16Array', 'Int32Array', 'Float64Array'],
+  order: ['random', 'sorted', 'reversed', 'runs'],
+  comparator: ['default', 'numeric'],
+  n: [1e5]
+});
+
+function fill(arr, order) {
+  var n = arr.length;
+  for (var i = 0; i < n; ++i) {
+    switch (order) {
+      case 'random': arr[i] = (Math.random() * 1e4) | 0; break;
+      case 'sorted': arr[i] = i; break;
+      case 'reversed': arr[i] = n - i; break;
+      case 'runs': arr[i] = (i % 1000) * 3 + ((i / 1000) | 0); break;
+    }
+  }
+}
+
+function main(conf) {
+  var clazz = global[conf.type];
+  var n = +conf.n;
+  var compare = conf.comparator === 'numeric' ?
+    function(a, b) { return a - b; } : undefined;
+
+  var arr = conf.type === 'Array' ? new Array(n).fill(0) : new clazz(n);
+  bench.start();
+  for (var i = 0; i < 10; ++i) {
+    fill(arr, conf.order);
+    arr.sort(compare);
+  }
+  bench.end(10);
+}
@@ -0,0 +1,56 @@
+'use strict';
+var common = require('../common.js');
+var bench = common.createBenchmark(main, {
+  type: ['Float32Array', 'Float64Array'],
+  kernel: ['add', 'mul', 'scale', 'axpy', 'copy'],
+  size: [1024, 1e6],
+  n: [1e8]
+});
+
+function add(a, b, c) {
+  for (var i = 0; i < c.length; ++i)
+    c[i] = a[i] + b[i];
+}
+
+function mul(a, b, c) {
+  for (var i = 0; i < c.length; ++i)
+    c[i] = a[i] * b[i];
+}
+
+function scale(a, b, c) {
+  for (var i = 0; i < c.length; ++i)
+    c[i] = a[i] * 1.5;
+}
+
+// Two operations per element, so not a single element-wise kernel.
+function axpy(a, b, c) {
+  for (var i = 0; i < c.length; ++i)
+    c[i] = a[i] * 1.5 + b[i];
+}
+
+function copy(a, b, c) {
+  for (var i = 0; i < c.length; ++i)
+    c[i] = a[i];
+}
+
+const kernels = { add, mul, scale, axpy, copy };
+
+function main(conf) {
+  var clazz = global[conf.type];
+  var kernel = kernels[conf.kernel];
+  var size = +conf.size;
+  var iterations = Math.max(1, Math.floor(+conf.n / size));
+
+  var a = new clazz(size);
+  var b = new clazz(size);
+  var c = new clazz(size);
+  for (var i = 0; i < size; ++i) {
+    a[i] = i * 0.5;
+    b[i] = size - i;
+  }
+
+  bench.start();
+  for (var j = 0; j < iterations; ++j)
+    kernel(a, b, c);
+  bench.end(iterations * size);
+}
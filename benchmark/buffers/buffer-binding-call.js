@@ -0,0 +1,45 @@
+'use strict';
+var common = require('../common.js');
+
+// Small buffers keep the native work trivial, so this mostly measures the
+// cost of checking and unpacking the arguments of a binding call.
+var bench = common.createBenchmark(main, {
+  method: ['compare', 'equals', 'fill', 'indexOf'],
+  millions: [1]
+});
+
+function main(conf) {
+  const iter = (conf.millions >>> 0) * 1e6;
+  const b0 = Buffer.alloc(8, 'a');
+  const b1 = Buffer.alloc(8, 'a');
+  var i;
+
+  switch (conf.method) {
+    case 'compare':
+      bench.start();
+      for (i = 0; i < iter; i++)
+        Buffer.compare(b0, b1);
+      bench.end(iter / 1e6);
+      break;
+    case 'equals':
+      bench.start();
+      for (i = 0; i < iter; i++)
+        b0.equals(b1);
+      bench.end(iter / 1e6);
+      break;
+    case 'fill':
+      bench.start();
+      for (i = 0; i < iter; i++)
+        b0.fill('ab');
+      bench.end(iter / 1e6);
+      break;
+    case 'indexOf':
+      bench.start();
+      for (i = 0; i < iter; i++)
+        b0.indexOf('b');
+      bench.end(iter / 1e6);
+      break;
+    default:
+      throw new Error('Unexpected method');
+  }
+}
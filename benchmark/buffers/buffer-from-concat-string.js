@@ -0,0 +1,24 @@
+'use strict';
+var common = require('../common');
+
+var bench = common.createBenchmark(main, {
+  pieces: [16, 1024, 65536],
+  n: [256]
+});
+
+// Builds a page out of many small pieces the way a template engine would,
+// then encodes it. The string is a fresh rope on every iteration.
+function main(conf) {
+  var n = conf.n | 0;
+  var pieces = conf.pieces | 0;
+
+  bench.start();
+  for (var i = 0; i < n; i++) {
+    var page = '<ul>';
+    for (var j = 0; j < pieces; j++)
+      page += '<li>item ' + j + ' – ünïcödé</li>';
+    page += '</ul>';
+    Buffer.from(page, 'utf8');
+  }
+  bench.end(n);
+}
@@ -0,0 +1,87 @@
+'use strict';
+
+const common = require('../common.js');
+const assert = require('assert');
+
+const bench = common.createBenchmark(main, {
+  method: ['async', 'generator'],
+  size: [64, 1024],
+  n: [1e4]
+});
+
+function makeRequest(size, i) {
+  const body = new Array(size);
+  for (var j = 0; j < size; j++)
+    body[j] = (i + j) & 0xff;
+  return { id: i, body };
+}
+
+async function handleRequest(req) {
+  var sum = 0;
+  try {
+    await null;
+    const body = req.body;
+    for (var i = 0; i < body.length; i++)
+      sum = (sum * 31 + body[i]) | 0;
+    if (sum === -1)
+      throw new Error('Unexpected checksum');
+  } catch (err) {
+    return -1;
+  }
+  await null;
+  return sum;
+}
+
+function* requestGenerator(req) {
+  var sum = 0;
+  try {
+    yield req.id;
+    const body = req.body;
+    for (var i = 0; i < body.length; i++)
+      sum = (sum * 31 + body[i]) | 0;
+    if (sum === -1)
+      throw new Error('Unexpected checksum');
+  } catch (err) {
+    return -1;
+  }
+  yield req.id;
+  return sum;
+}
+
+async function runAsync(size, n) {
+  var total = 0;
+  bench.start();
+  for (var i = 0; i < n; i++)
+    total ^= await handleRequest(makeRequest(size, i));
+  bench.end(n);
+  assert.notStrictEqual(total, -1);
+}
+
+function runGenerator(size, n) {
+  var total = 0;
+  bench.start();
+  for (var i = 0; i < n; i++) {
+    const it = requestGenerator(makeRequest(size, i));
+    var step;
+    while (!(step = it.next()).done);
+    total ^= step.value;
+  }
+  bench.end(n);
+  assert.notStrictEqual(total, -1);
+}
+
+function main(conf) {
+  const size = +conf.size;
+  const n = +conf.n;
+
+  switch (conf.method) {
+    case 'async':
+      runAsync(size, n);
+      break;
+    case 'generator':
+      runGenerator(size, n);
+      break;
+    default:
+      throw new Error('Unexpected method');
+  }
+}
@@ -0,0 +1,90 @@
+'use strict';
+
+const common = require('../common.js');
+const assert = require('assert');
+
+const bench = common.createBenchmark(main, {
+  method: [
+    'array-push-pop',
+    'array-indexof',
+    'string-slice',
+    'string-indexof',
+    'map-get-set'
+  ],
+  millions: [10]
+});
+
+function arrayPushPop(arr, n) {
+  for (var i = 0; i < n; i++) {
+    arr.push(i);
+    arr.push(i + 1);
+    arr.pop();
+  }
+  return arr.length;
+}
+
+function arrayIndexOf(arr, n) {
+  var found = 0;
+  for (var i = 0; i < n; i++) {
+    if (arr.indexOf(i & 15) >= 0)
+      found++;
+  }
+  return found;
+}
+
+function stringSlice(str, n) {
+  var len = 0;
+  for (var i = 0; i < n; i++)
+    len += str.slice(i & 7, 16).length;
+  return len;
+}
+
+function stringIndexOf(str, n) {
+  var pos = 0;
+  for (var i = 0; i < n; i++)
+    pos += str.indexOf('needle', i & 7);
+  return pos;
+}
+
+function mapGetSet(map, n) {
+  var sum = 0;
+  for (var i = 0; i < n; i++) {
+    var key = i & 1023;
+    map.set(key, i);
+    if (map.has(key))
+      sum += map.get(key);
+  }
+  return sum;
+}
+
+function run(fn, arg, n) {
+  fn(arg, 1e3);
+  bench.start();
+  var result = fn(arg, n);
+  bench.end(n / 1e6);
+  return result;
+}
+
+function main(conf) {
+  const n = +conf.millions * 1e6;
+
+  switch (conf.method) {
+    case 'array-push-pop':
+      assert.strictEqual(run(arrayPushPop, [], n), n + 1e3);
+      break;
+    case 'array-indexof':
+      assert.strictEqual(run(arrayIndexOf, [0, 1, 2, 3, 4, 5, 6, 7], n), n / 2);
+      break;
+    case 'string-slice':
+      assert(run(stringSlice, 'abcdefghijklmnopqrstuvwxyz', n) > 0);
+      break;
+    case 'string-indexof':
+      assert(run(stringIndexOf, 'haystack haystack needle', n) > 0);
+      break;
+    case 'map-get-set':
+      assert(run(mapGetSet, new Map(), n) > 0);
+      break;
+    default:
+      throw new Error('Unexpected method');
+  }
+}
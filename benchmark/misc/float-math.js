@@ -0,0 +1,82 @@
+'use strict';
+var common = require('../common.js');
+var bench = common.createBenchmark(main, {
+  kernel: ['nbody', 'polynomial', 'matmul'],
+  n: [1e6]
+});
+
+// Scalar double arithmetic where most sources stay live after each
+// operation, so destructive two-operand encodings need extra moves.
+function nbody(n) {
+  var x = [0, 1, 0, -1], y = [1, 0, -1, 0];
+  var vx = [0.01, 0, -0.01, 0], vy = [0, 0.01, 0, -0.01];
+  var dt = 0.001;
+  for (var step = 0; step < n; step++) {
+    for (var i = 0; i < 4; i++) {
+      for (var j = i + 1; j < 4; j++) {
+        var dx = x[i] - x[j];
+        var dy = y[i] - y[j];
+        var d2 = dx * dx + dy * dy + 0.01;
+        var mag = dt / (d2 * Math.sqrt(d2));
+        vx[i] -= dx * mag;
+        vy[i] -= dy * mag;
+        vx[j] += dx * mag;
+        vy[j] += dy * mag;
+      }
+    }
+    for (var k = 0; k < 4; k++) {
+      x[k] += dt * vx[k];
+      y[k] += dt * vy[k];
+    }
+  }
+  return x[0] + y[0];
+}
+
+function polynomial(n) {
+  var sum = 0;
+  for (var i = 0; i < n; i++) {
+    var t = i * 1e-6;
+    var t2 = t * t;
+    var t3 = t2 * t;
+    sum += (1.5 + 2.25 * t - 0.75 * t2 + 0.125 * t3) / (1 + t2);
+  }
+  return sum;
+}
+
+function matmul(n) {
+  var size = 16;
+  var a = new Float64Array(size * size);
+  var b = new Float64Array(size * size);
+  var c = new Float64Array(size * size);
+  for (var i = 0; i < a.length; i++) {
+    a[i] = i * 0.5;
+    b[i] = a.length - i;
+  }
+  var iterations = Math.max(1, Math.floor(n / (size * size * size)));
+  for (var it = 0; it < iterations; it++) {
+    for (var r = 0; r < size; r++) {
+      for (var col = 0; col < size; col++) {
+        var acc = 0;
+        for (var k = 0; k < size; k++)
+          acc += a[r * size + k] * b[k * size + col];
+        c[r * size + col] = acc;
+      }
+    }
+  }
+  return c[0];
+}
+
+const kernels = { nbody, polynomial, matmul };
+
+function main(conf) {
+  var kernel = kernels[conf.kernel];
+  var n = +conf.n;
+  if (conf.kernel === 'nbody')
+    n = Math.floor(n / 10);
+
+  bench.start();
+  var result = kernel(n);
+  bench.end(n);
+  if (!Number.isFinite(result))
+    throw new Error('Unexpected result');
+}
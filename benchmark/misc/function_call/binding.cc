@@ -9,9 +9,24 @@ void Hello(const FunctionCallbackInfo<Value>& args) {
   args.GetReturnValue().Set(c++);
 }
 
+void New(const FunctionCallbackInfo<Value>& args) {
+}
+
+void Noop(const FunctionCallbackInfo<Value>& args) {
+}
+
 extern "C" void init (Local<Object> target) {
-  HandleScope scope(Isolate::GetCurrent());
+  Isolate* isolate = Isolate::GetCurrent();
+  HandleScope scope(isolate);
   NODE_SET_METHOD(target, "hello", Hello);
+
+  // A prototype method has a signature to check on every call, like the
+  // methods of most native handles.
+  Local<FunctionTemplate> t = FunctionTemplate::New(isolate, New);
+  t->InstanceTemplate()->SetInternalFieldCount(1);
+  t->SetClassName(String::NewFromUtf8(isolate, "Handle"));
+  NODE_SET_PROTOTYPE_METHOD(t, "noop", Noop);
+  target->Set(String::NewFromUtf8(isolate, "Handle"), t->GetFunction());
 }
 
 NODE_MODULE(binding, init);
@@ -18,6 +18,7 @@ try {
   process.exit(0);
 }
 var cxx = binding.hello;
+var handle = new binding.Handle();
 
 var c = 0;
 function js() {
@@ -27,16 +28,27 @@ function js() {
 assert(js() === cxx());
 
 var bench = common.createBenchmark(main, {
-  type: ['js', 'cxx'],
+  type: ['js', 'cxx', 'cxx-method'],
   millions: [1, 10, 50]
 });
 
 function main(conf) {
   var n = +conf.millions * 1e6;
 
+  var i;
+  if (conf.type === 'cxx-method') {
+    // No-op native method, so only the cost of entering it is measured
+    bench.start();
+    for (i = 0; i < n; i++) {
+      handle.noop();
+    }
+    bench.end(+conf.millions);
+    return;
+  }
+
   var fn = conf.type === 'cxx' ? cxx : js;
   bench.start();
-  for (var i = 0; i < n; i++) {
+  for (i = 0; i < n; i++) {
     fn();
   }
   bench.end(+conf.millions);
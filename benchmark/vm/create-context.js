@@ -0,0 +1,23 @@
+'use strict';
+
+var common = require('../common.js');
+var vm = require('vm');
+
+var bench = common.createBenchmark(main, {
+  n: [1000],
+  run: ['none', 'script']
+});
+
+function main(conf) {
+  var n = +conf.n;
+  var script = conf.run === 'script' ?
+    new vm.Script('i + 1') : null;
+
+  bench.start();
+  for (var i = 0; i < n; i++) {
+    var context = vm.createContext({ i: i });
+    if (script)
+      script.runInContext(context);
+  }
+  bench.end(n);
+}
@@ -69,6 +69,10 @@
         'src/jsrtcontextcachedobj.inc',
         'src/jsrtcontextshim.cc',
         'src/jsrtcontextshim.h',
+        'src/jsrtcpuprofiler.cc',
+        'src/jsrtcpuprofiler.h',
+        'src/jsrthandleslab.cc',
+        'src/jsrthandleslab.h',
         'src/jsrtisolateshim.cc',
         'src/jsrtisolateshim.h',
         'src/jsrtpromise.cc',
@@ -78,6 +82,8 @@
         'src/jsrtstringutils.h',
         'src/jsrtutils.cc',
         'src/jsrtutils.h',
+        'src/jsrtweakreferencetable.cc',
+        'src/jsrtweakreferencetable.h',
         'src/v8array.cc',
         'src/v8arraybuffer.cc',
         'src/v8boolean.cc',
@@ -85,8 +91,10 @@
         'src/v8chakra.cc',
         'src/v8chakra.h',
         'src/v8context.cc',
+        'src/v8cpuprofiler.cc',
         'src/v8date.cc',
         'src/v8debug.cc',
+        'src/v8enginestatistics.cc',
         'src/v8exception.cc',
         'src/v8external.cc',
         'src/v8function.cc',
@@ -96,7 +104,9 @@
         'src/v8int32.cc',
         'src/v8integer.cc',
         'src/v8isolate.cc',
+        'src/v8jittelemetry.cc',
         'src/v8message.cc',
+        'src/v8messagechannel.cc',
         'src/v8number.cc',
         'src/v8numberobject.cc',
         'src/v8object.cc',
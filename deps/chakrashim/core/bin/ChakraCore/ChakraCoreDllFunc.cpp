@@ -15,6 +15,9 @@
 #ifdef VTUNE_PROFILING
 #include "Base/VTuneChakraProfile.h"
 #endif
+#ifdef PERF_JIT_PROFILING
+#include "Base/PerfJitProfile.h"
+#endif
 
 extern HANDLE g_hInstance;
 #ifdef _WIN32
@@ -62,6 +65,9 @@ static BOOL AttachProcess(HANDLE hmod)
 #ifdef VTUNE_PROFILING
     VTuneChakraProfile::Register();
 #endif 
+#ifdef PERF_JIT_PROFILING
+    PerfJitProfile::Register();
+#endif
     ValueType::Initialize();
     ThreadContext::GlobalInitialize();
 
@@ -167,6 +173,9 @@ EXTERN_C BOOL WINAPI DllMain(HINSTANCE hmod, DWORD dwReason, PVOID pvReserved)
 #ifdef VTUNE_PROFILING
         VTuneChakraProfile::UnRegister();
 #endif 
+#ifdef PERF_JIT_PROFILING
+        PerfJitProfile::UnRegister();
+#endif
 
         // don't do anything if we are in forceful shutdown
         // try to clean up handles in graceful shutdown
@@ -10,7 +10,7 @@
 BackwardPass::BackwardPass(Func * func, GlobOpt * globOpt, Js::Phase tag)
     : func(func), globOpt(globOpt), tag(tag), currentPrePassLoop(nullptr), tempAlloc(nullptr),
     preOpBailOutInstrToProcess(nullptr),
-    considerSymAsRealUseInNoImplicitCallUses(nullptr),
+    considerSymAsRealUseInNoImplicitCallUses(nullptr), scalarReplaceObjectGroups(nullptr),
     isCollectionPass(false), currentRegion(nullptr)
 {
     // Those are the only two phase dead store will be used currently
@@ -18,6 +18,7 @@ BackwardPass::BackwardPass(Func * func, GlobOpt * globOpt, Js::Phase tag)
 
     this->implicitCallBailouts = 0;
     this->fieldOpts = 0;
+    this->numScalarReplacedObject = 0;
 
 #if DBG_DUMP
     this->numDeadStore = 0;
@@ -133,6 +134,15 @@ BackwardPass::DoDeadStoreSlots() const
         && (!this->func->HasTry()));
 }
 
+bool
+BackwardPass::DoScalarReplaceObjects() const
+{
+    // Only on the dead store pass: glob opt has copy-propped the field loads by then,
+    // so the field stores and the allocation are often all that is left of the object.
+    return this->DoDeadStore() && this->func->DoGlobOpt() && !this->func->HasTry() &&
+        !this->func->IsJitInDebugMode() && !PHASE_OFF(Js::ScalarReplaceObjectPhase, this->func);
+}
+
 // Whether dead store is enabled for given func and sym.
 // static
 bool
@@ -393,6 +403,11 @@ BackwardPass::Optimize()
     NumberTempRepresentativePropertySymMap localNumberTempRepresentativePropertySym(tempAlloc);
     numberTempRepresentativePropertySym = &localNumberTempRepresentativePropertySym;
 
+    if (this->DoScalarReplaceObjects())
+    {
+        this->CollectScalarReplaceObjectCandidates();
+    }
+
     FOREACH_BLOCK_BACKWARD_IN_FUNC_DEAD_OR_ALIVE(block, this->func)
     {
         this->OptBlock(block);
@@ -405,6 +420,11 @@ BackwardPass::Optimize()
     }
     this->func->m_fg->hasBackwardPassInfo = true;
 
+    if (this->DoScalarReplaceObjects())
+    {
+        this->ReportScalarReplacedObjects();
+    }
+
     if(DoTrackCompoundedIntOverflow())
     {
         // Tracking int overflow makes use of a scratch field in stack syms, which needs to be cleared
@@ -429,6 +449,10 @@ BackwardPass::Optimize()
         {
             Output::Print(_u("  Temp Object            : %3d\n"), this->numMarkTempObject);
         }
+        if (this->DoScalarReplaceObjects())
+        {
+            Output::Print(_u("  Scalar Replaced Object : %3d\n"), this->numScalarReplacedObject);
+        }
     }
 #endif
 }
@@ -2544,6 +2568,11 @@ BackwardPass::ProcessBlock(BasicBlock * block)
             continue;
         }
 
+        if (this->DeadStoreInstrForScalarReplaceObject())
+        {
+            continue;
+        }
+
         bool hasLiveFields = (block->upwardExposedFields && !block->upwardExposedFields->IsEmpty());
 
         IR::Opnd * opnd = instr->GetDst();
@@ -2975,6 +3004,310 @@ BackwardPass::DeadStoreOrChangeInstrForScopeObjRemoval()
     return false;
 }
 
+/*
+* Scalar replacement of object literals.
+*
+* An object literal that is only ever accessed through loads and stores of its own properties can't escape:
+* nothing else holds a reference to it, and since those properties are all own data properties, the field
+* accesses can't call out (no getters, setters or prototype lookups). Glob opt copy-props the field loads, so
+* once the object is dead its remaining field stores are dead too, and so is the allocation.
+*
+* Syms that are copied from one another with Ld_A (an inlinee's Ret becomes "Ld_A retOpnd, s", for instance)
+* form a group that stands for the same object. A field store can only go once no sym of its group is live.
+*
+* Liveness already covers bailouts: a bailout that needs to restore the object makes its sym upward exposed,
+* so objects that are live across a bailout keep their allocation and the stores that precede the bailout.
+*/
+void
+BackwardPass::CollectScalarReplaceObjectCandidates()
+{
+    typedef JsUtil::BaseDictionary<SymID, const Js::PropertyIdArray *, JitArenaAllocator> LiteralPropertyIdsMap;
+    typedef JsUtil::BaseDictionary<SymID, SymID, JitArenaAllocator> CopyGroupMap;
+    LiteralPropertyIdsMap literalPropertyIds(this->tempAlloc);
+    LiteralPropertyIdsMap groupPropertyIds(this->tempAlloc);
+    CopyGroupMap copyGroupParents(this->tempAlloc);
+    BVSparse<JitArenaAllocator> candidates(this->tempAlloc);
+    BVSparse<JitArenaAllocator> nonCandidates(this->tempAlloc);
+
+    auto findGroup = [&](SymID symId) -> SymID
+    {
+        SymID parentId;
+        while (copyGroupParents.TryGetValue(symId, &parentId) && parentId != symId)
+        {
+            symId = parentId;
+        }
+        return symId;
+    };
+
+    // Every def of a candidate sym has to be an object literal with the same shape, or a copy of another candidate
+    FOREACH_INSTR_IN_FUNC(instr, this->func)
+    {
+        IR::Opnd * dst = instr->GetDst();
+        if (dst == nullptr || !dst->IsRegOpnd())
+        {
+            continue;
+        }
+
+        SymID symId = dst->AsRegOpnd()->m_sym->m_id;
+        if (instr->m_opcode == Js::OpCode::Ld_A && instr->GetSrc1()->IsRegOpnd())
+        {
+            SymID srcGroupId = findGroup(instr->GetSrc1()->AsRegOpnd()->m_sym->m_id);
+            SymID dstGroupId = findGroup(symId);
+            copyGroupParents.Item(srcGroupId, srcGroupId);
+            copyGroupParents.Item(dstGroupId, srcGroupId);
+            candidates.Set(symId);
+            continue;
+        }
+
+        if (instr->m_opcode != Js::OpCode::NewScObjectLiteral)
+        {
+            nonCandidates.Set(symId);
+            continue;
+        }
+
+        const Js::PropertyIdArray * propIds = Js::ByteCodeReader::ReadPropertyIdArrayWithLock(
+            instr->GetSrc1()->AsIntConstOpnd()->AsUint32(), instr->m_func->GetJnFunction());
+        const Js::PropertyIdArray * otherPropIds;
+        if (propIds->has__proto__ ||
+            (literalPropertyIds.TryGetValue(symId, &otherPropIds) && otherPropIds != propIds))
+        {
+            nonCandidates.Set(symId);
+            continue;
+        }
+        literalPropertyIds.Item(symId, propIds);
+        candidates.Set(symId);
+    }
+    NEXT_INSTR_IN_FUNC;
+
+    // A copied sym that has no def of its own (a parameter, for instance) can be any object
+    copyGroupParents.Map([&](SymID symId, SymID)
+    {
+        if (!candidates.Test(symId))
+        {
+            nonCandidates.Set(symId);
+        }
+    });
+
+    // All the literals of a group have to have the same shape, as field accesses through any of its syms may see any of them
+    literalPropertyIds.Map([&](SymID symId, const Js::PropertyIdArray * propIds)
+    {
+        SymID groupId = findGroup(symId);
+        const Js::PropertyIdArray * otherPropIds;
+        if (groupPropertyIds.TryGetValue(groupId, &otherPropIds) && otherPropIds != propIds)
+        {
+            nonCandidates.Set(symId);
+            return;
+        }
+        groupPropertyIds.Item(groupId, propIds);
+    });
+
+    // Every use of a candidate sym has to be a load or store of one of the literal's properties, or a copy to another sym
+    auto processUse = [&](IR::Instr * instr, IR::Opnd * opnd, bool isDst)
+    {
+        switch (opnd->GetKind())
+        {
+        case IR::OpndKindReg:
+            if (!isDst && (instr->m_opcode != Js::OpCode::Ld_A || !instr->GetDst()->IsRegOpnd()))
+            {
+                nonCandidates.Set(opnd->AsRegOpnd()->m_sym->m_id);
+            }
+            break;
+
+        case IR::OpndKindIndir:
+        {
+            IR::IndirOpnd * indirOpnd = opnd->AsIndirOpnd();
+            nonCandidates.Set(indirOpnd->GetBaseOpnd()->m_sym->m_id);
+            if (indirOpnd->GetIndexOpnd())
+            {
+                nonCandidates.Set(indirOpnd->GetIndexOpnd()->m_sym->m_id);
+            }
+            break;
+        }
+
+        case IR::OpndKindSym:
+        {
+            Sym * sym = opnd->AsSymOpnd()->m_sym;
+            if (!sym->IsPropertySym())
+            {
+                nonCandidates.Set(sym->m_id);
+                break;
+            }
+
+            PropertySym * propertySym = sym->AsPropertySym();
+            SymID objectSymId = propertySym->m_stackSym->m_id;
+            if (!candidates.Test(objectSymId))
+            {
+                break;
+            }
+
+            bool isFieldAccess = isDst ?
+                (instr->m_opcode == Js::OpCode::InitFld ||
+                    instr->m_opcode == Js::OpCode::StFld ||
+                    instr->m_opcode == Js::OpCode::StFldStrict) :
+                instr->m_opcode == Js::OpCode::LdFld;
+            const Js::PropertyIdArray * propIds;
+            if (!isFieldAccess || !groupPropertyIds.TryGetValue(findGroup(objectSymId), &propIds))
+            {
+                nonCandidates.Set(objectSymId);
+                break;
+            }
+
+            uint32 i = 0;
+            while (i < propIds->count && propIds->elements[i] != propertySym->m_propertyId)
+            {
+                i++;
+            }
+            if (i == propIds->count)
+            {
+                nonCandidates.Set(objectSymId);
+            }
+            break;
+        }
+        }
+    };
+
+    FOREACH_INSTR_IN_FUNC(instr, this->func)
+    {
+        if (instr->IsByteCodeUsesInstr())
+        {
+            continue;
+        }
+
+        IR::Opnd * opnd = instr->GetDst();
+        if (opnd)
+        {
+            processUse(instr, opnd, true);
+        }
+        opnd = instr->GetSrc1();
+        if (opnd)
+        {
+            processUse(instr, opnd, false);
+            opnd = instr->GetSrc2();
+            if (opnd)
+            {
+                processUse(instr, opnd, false);
+            }
+        }
+    }
+    NEXT_INSTR_IN_FUNC;
+
+    // A sym that isn't a candidate takes its whole group with it
+    BVSparse<JitArenaAllocator> nonCandidateGroups(this->tempAlloc);
+    FOREACH_BITSET_IN_SPARSEBV(symId, &nonCandidates)
+    {
+        nonCandidateGroups.Set(findGroup(symId));
+    }
+    NEXT_BITSET_IN_SPARSEBV;
+
+    ScalarReplaceObjectGroupMap * groups = nullptr;
+    FOREACH_BITSET_IN_SPARSEBV(symId, &candidates)
+    {
+        SymID groupId = findGroup(symId);
+        if (nonCandidateGroups.Test(groupId) || !groupPropertyIds.ContainsKey(groupId))
+        {
+            continue;
+        }
+
+        if (groups == nullptr)
+        {
+            groups = JitAnew(this->tempAlloc, ScalarReplaceObjectGroupMap, this->tempAlloc);
+        }
+        BVSparse<JitArenaAllocator> * group;
+        if (!groups->TryGetValue(groupId, &group))
+        {
+            group = JitAnew(this->tempAlloc, BVSparse<JitArenaAllocator>, this->tempAlloc);
+            groups->Item(groupId, group);
+        }
+        group->Set(symId);
+        if (symId != groupId)
+        {
+            groups->Item(symId, group);
+        }
+    }
+    NEXT_BITSET_IN_SPARSEBV;
+
+    this->scalarReplaceObjectGroups = groups;
+}
+
+bool
+BackwardPass::DeadStoreInstrForScalarReplaceObject()
+{
+    IR::Instr * instr = this->currentInstr;
+    if (this->scalarReplaceObjectGroups == nullptr || this->IsPrePass() || instr->HasBailOutInfo())
+    {
+        return false;
+    }
+
+    StackSym * objectSym;
+    switch (instr->m_opcode)
+    {
+        case Js::OpCode::InitFld:
+        case Js::OpCode::StFld:
+        case Js::OpCode::StFldStrict:
+            objectSym = instr->GetDst()->AsSymOpnd()->m_sym->AsPropertySym()->m_stackSym;
+            break;
+
+        case Js::OpCode::NewScObjectLiteral:
+            objectSym = instr->GetDst()->AsRegOpnd()->m_sym;
+            break;
+
+        default:
+            return false;
+    }
+
+    BVSparse<JitArenaAllocator> * group;
+    if (!this->scalarReplaceObjectGroups->TryGetValue(objectSym->m_id, &group) ||
+        this->currentBlock->upwardExposedUses->Test(group))
+    {
+        return false;
+    }
+
+    if (instr->m_opcode == Js::OpCode::NewScObjectLiteral)
+    {
+        // Let the def end the byte code liveness of the sym; the allocation itself has side effects
+        // as far as ProcessDef is concerned, so it won't be removed there.
+        bool isRemoved = this->ProcessDef(instr->GetDst());
+        Assert(!isRemoved);
+
+        this->numScalarReplacedObject++;
+        if (PHASE_TRACE(Js::ScalarReplaceObjectPhase, this->func))
+        {
+            // The literal may come from an inlinee, name both functions
+            Js::FunctionBody * functionBody = this->func->GetJnFunction();
+            Js::FunctionBody * literalFunctionBody = instr->m_func->GetJnFunction();
+            Output::Print(_u("ScalarReplaceObject: %s (%d): removed object literal allocation in %s (%d)\n"),
+                functionBody->GetDisplayName(), functionBody->GetFunctionNumber(),
+                literalFunctionBody->GetDisplayName(), literalFunctionBody->GetFunctionNumber());
+            Output::Flush();
+        }
+    }
+
+    return this->DeadStoreInstr(instr);
+}
+
+void
+BackwardPass::ReportScalarReplacedObjects()
+{
+    if (this->numScalarReplacedObject == 0)
+    {
+        return;
+    }
+
+    Js::FunctionBody * functionBody = this->func->GetJnFunction();
+    Js::FunctionJitTelemetry * jitTelemetry = functionBody->GetJitTelemetryWithLock();
+    if (jitTelemetry != nullptr)
+    {
+        jitTelemetry->LogScalarReplacedObjects(this->numScalarReplacedObject);
+    }
+
+    if (PHASE_TRACE(Js::ScalarReplaceObjectPhase, this->func))
+    {
+        Output::Print(_u("ScalarReplaceObject: %s (%d): removed %u object literal allocation(s)\n"),
+            functionBody->GetDisplayName(), functionBody->GetFunctionNumber(), this->numScalarReplacedObject);
+        Output::Flush();
+    }
+}
+
 IR::Instr *
 BackwardPass::TryChangeInstrForStackArgOpt()
 {
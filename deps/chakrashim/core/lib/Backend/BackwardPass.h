@@ -31,6 +31,9 @@ private:
     void InsertArgInsForFormals();
     void ProcessBailOnStackArgsOutOfActualsRange();
     bool DeadStoreOrChangeInstrForScopeObjRemoval();
+    void CollectScalarReplaceObjectCandidates();
+    bool DeadStoreInstrForScalarReplaceObject();
+    void ReportScalarReplacedObjects();
     void ProcessUse(IR::Opnd * opnd);
     bool ProcessDef(IR::Opnd * opnd);
     void ProcessTransfers(IR::Instr * instr);
@@ -117,6 +120,7 @@ private:
     static bool DoDeadStore(Func* func);
     bool DoDeadStore() const;
     bool DoDeadStoreSlots() const;
+    bool DoScalarReplaceObjects() const;
     bool DoTrackNegativeZero() const;
     bool DoTrackBitOpsOrNumber()const;
     bool DoTrackIntOverflow() const;
@@ -180,6 +184,11 @@ private:
     BVSparse<JitArenaAllocator> * intOverflowDoesNotMatterInRangeBySymId;
     BVSparse<JitArenaAllocator> * candidateSymsRequiredToBeInt;
     BVSparse<JitArenaAllocator> * candidateSymsRequiredToBeLossyInt;
+
+    // Syms of non-escaping object literals, mapped to the group of syms that are copies of the same object
+    typedef JsUtil::BaseDictionary<SymID, BVSparse<JitArenaAllocator> *, JitArenaAllocator> ScalarReplaceObjectGroupMap;
+    ScalarReplaceObjectGroupMap * scalarReplaceObjectGroups;
+
     StackSym *considerSymAsRealUseInNoImplicitCallUses;
     bool intOverflowCurrentlyMattersInRange;
     bool isCollectionPass;
@@ -238,6 +247,8 @@ private:
     uint32 numMarkTempObject;
 #endif
 
+    uint32 numScalarReplacedObject;
+
     uint32 implicitCallBailouts;
     uint32 fieldOpts;
 };
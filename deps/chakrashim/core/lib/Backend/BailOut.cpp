@@ -1747,6 +1747,12 @@ void BailOutRecord::ScheduleFunctionCodeGen(Js::ScriptFunction * function, Js::S
     BailOutRecord * bailOutRecordNotConst = (BailOutRecord *)(void *)bailOutRecord;
     bailOutRecordNotConst->bailOutCount++;
 
+    Js::FunctionJitTelemetry * jitTelemetry = executeFunction->GetJitTelemetry();
+    if (jitTelemetry != nullptr)
+    {
+        jitTelemetry->LogBailOut(bailOutKind);
+    }
+
     Js::FunctionEntryPointInfo *entryPointInfo = function->GetFunctionEntryPointInfo();
     uint8 callsCount = entryPointInfo->callsCount;
     RejitReason rejitReason = RejitReason::None;
@@ -2230,6 +2236,10 @@ void BailOutRecord::ScheduleFunctionCodeGen(Js::ScriptFunction * function, Js::S
             executeFunction->GetScriptContext()->LogRejit(executeFunction, rejitReason);
         }
 #endif
+        if (jitTelemetry != nullptr)
+        {
+            jitTelemetry->LogRejit();
+        }
         executeFunction->ClearDontRethunkAfterBailout();
 
         GenerateFunction(executeFunction->GetScriptContext()->GetNativeCodeGenerator(), executeFunction, function);
@@ -2290,6 +2300,12 @@ void BailOutRecord::ScheduleLoopBodyCodeGen(Js::ScriptFunction * function, Js::S
     BailOutRecord * bailOutRecordNotConst = (BailOutRecord *)(void *)bailOutRecord;
     bailOutRecordNotConst->bailOutCount++;
 
+    Js::FunctionJitTelemetry * jitTelemetry = executeFunction->GetJitTelemetry();
+    if (jitTelemetry != nullptr)
+    {
+        jitTelemetry->LogBailOut(bailOutKind);
+    }
+
     RejitReason rejitReason = RejitReason::None;
     Assert(bailOutKind != IR::BailOutInvalid);
 
@@ -2556,6 +2572,10 @@ void BailOutRecord::ScheduleLoopBodyCodeGen(Js::ScriptFunction * function, Js::S
             executeFunction->GetScriptContext()->LogRejit(executeFunction, rejitReason);
         }
 #endif
+        if (jitTelemetry != nullptr)
+        {
+            jitTelemetry->LogRejit();
+        }
         // Single bailout triggers re-JIT of loop body. the actual codegen scheduling of the new
         // loop body happens in the interpreter
         loopHeader->interpretCount = executeFunction->GetLoopInterpretCount(loopHeader) - 2;
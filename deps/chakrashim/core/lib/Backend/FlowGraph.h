@@ -598,6 +598,7 @@ public:
                                          // For example, in the lowerer, it'll be set to true when we process the loopTop for a certain loop
     struct MemCopyCandidate;
     struct MemSetCandidate;
+    struct MemVectorCandidate;
     struct MemOpCandidate
     {
         SymID base;
@@ -607,12 +608,15 @@ public:
         enum MemOpType
         {
             MEMSET,
-            MEMCOPY
+            MEMCOPY,
+            MEMVECTOR
         } type;
         bool IsMemSet() const { return type == MEMSET; }
         bool IsMemCopy() const { return type == MEMCOPY; }
+        bool IsMemVector() const { return type == MEMVECTOR; }
         struct Loop::MemCopyCandidate* AsMemCopy();
         struct Loop::MemSetCandidate* AsMemSet();
+        struct Loop::MemVectorCandidate* AsMemVector();
         MemOpCandidate(MemOpType type) :
             type(type)
         {
@@ -635,6 +639,18 @@ public:
         MemCopyCandidate() : MemOpCandidate(MemOpCandidate::MEMCOPY) {}
     };
 
+    // dst[i] = ld0[i] op ld1[i], or dst[i] = ld0[i] op scalar when ldBase[1] is invalid
+    struct MemVectorCandidate : public MemOpCandidate
+    {
+        SymID ldBase[2];
+        StackSym* transferSym[2];
+        StackSym* resultSym;
+        Js::MemvectorOp op;
+        BailoutConstantValue constant;
+        StackSym* srcSym;
+        MemVectorCandidate() : MemOpCandidate(MemOpCandidate::MEMVECTOR), resultSym(nullptr), srcSym(nullptr) {}
+    };
+
 #define FOREACH_MEMOP_CANDIDATES_EDITING(data, loop, iterator) FOREACH_SLISTCOUNTED_ENTRY_EDITING(Loop::MemOpCandidate*, data, loop->memOpInfo->candidates, iterator)
 #define NEXT_MEMOP_CANDIDATE_EDITING NEXT_SLISTCOUNTED_ENTRY_EDITING
 #define FOREACH_MEMOP_CANDIDATES(data, loop) FOREACH_SLISTCOUNTED_ENTRY(Loop::MemOpCandidate*, data, loop->memOpInfo->candidates)
@@ -770,6 +786,12 @@ struct MemCopyEmitData : public MemOpEmitData
     IR::Instr* ldElemInstr;
 };
 
+struct MemVectorEmitData : public MemOpEmitData
+{
+    IR::Instr* ldElemInstr[2];
+    IR::Instr* arithInstr;
+};
+
 #define FOREACH_BLOCK_IN_FUNC(block, func)\
     FOREACH_BLOCK(block, func->m_fg)
 #define NEXT_BLOCK_IN_FUNC\
@@ -8,6 +8,9 @@
 #ifdef VTUNE_PROFILING
 #include "Base/VTuneChakraProfile.h"
 #endif
+#ifdef PERF_JIT_PROFILING
+#include "Base/PerfJitProfile.h"
+#endif
 
 Func::Func(JitArenaAllocator *alloc, CodeGenWorkItem* workItem, const Js::FunctionCodeGenRuntimeData *const runtimeData,
     Js::PolymorphicInlineCacheInfo * const polymorphicInlineCacheInfo, CodeGenAllocators *const codeGenAllocators,
@@ -212,7 +215,7 @@ Func::Func(JitArenaAllocator *alloc, CodeGenWorkItem* workItem, const Js::Functi
         m_nonTempLocalVars = Anew(this->m_alloc, BVSparse<JitArenaAllocator>, this->m_alloc);
     }
 
-    if (this->m_jnFunction->IsGenerator())
+    if (this->IsGeneratorFunc())
     {
         m_yieldOffsetResumeLabelList = YieldOffsetResumeLabelList::New(this->m_alloc);
     }
@@ -226,6 +229,14 @@ Func::IsLoopBody() const
     return this->m_workItem->Type() == JsLoopBodyWorkItemType;
 }
 
+bool
+Func::IsGeneratorFunc() const
+{
+    // Loop bodies of a generator don't yield and are entered from the interpreter frame like any
+    // other loop body, so only the full function body needs the generator prolog/epilog and args.
+    return this->m_jnFunction->IsGenerator() && !this->IsLoopBody();
+}
+
 bool
 Func::IsLoopBodyInTry() const
 {
@@ -845,7 +856,7 @@ bool
 Func::DoGlobOptsForGeneratorFunc()
 {
     // Disable GlobOpt optimizations for generators initially. Will visit and enable each one by one.
-    return !m_jnFunction->IsGenerator();
+    return !this->IsGeneratorFunc();
 }
 
 void
@@ -1900,6 +1911,12 @@ bool Func::DoRecordNativeMap() const
         return true;
     }
 #endif
+#if defined(PERF_JIT_PROFILING)
+    if (PerfJitProfile::IsJitDumpActive())
+    {
+        return true;
+    }
+#endif
 #if DBG_DUMP
     return PHASE_DUMP(Js::EncoderPhase, this) && Js::Configuration::Global.flags.Verbose;
 #else
@@ -118,7 +118,8 @@
 #if DBG_DUMP
 #define DO_MEMOP_TRACE() (PHASE_TRACE(Js::MemOpPhase, this->func->GetJnFunction()) ||\
         PHASE_TRACE(Js::MemSetPhase, this->func->GetJnFunction()) ||\
-        PHASE_TRACE(Js::MemCopyPhase, this->func->GetJnFunction()))
+        PHASE_TRACE(Js::MemCopyPhase, this->func->GetJnFunction()) ||\
+        PHASE_TRACE(Js::MemVectorPhase, this->func->GetJnFunction()))
 #define DO_MEMOP_TRACE_PHASE(phase) (PHASE_TRACE(Js::MemOpPhase, this->func->GetJnFunction()) || PHASE_TRACE(Js::phase ## Phase, this->func->GetJnFunction()))
 
 #define OUTPUT_MEMOP_TRACE(loop, instr, ...) {\
@@ -4623,11 +4624,213 @@ bool GlobOpt::CollectMemcopyStElementI(IR::Instr *instr, Loop *loop)
     return true;
 }
 
+bool
+GlobOpt::IsMemvectorValueType(const ValueType valueType)
+{
+    return valueType.IsObject() &&
+        (valueType.GetObjectType() == ObjectType::Float32Array || valueType.GetObjectType() == ObjectType::Float64Array);
+}
+
+bool
+GlobOpt::CollectMemvectorArithmetic(IR::Instr *instr, Loop *loop)
+{
+    if (PHASE_OFF(Js::MemVectorPhase, this->func) || !loop->memOpInfo || loop->memOpInfo->candidates->Empty())
+    {
+        return false;
+    }
+
+    Js::MemvectorOp op;
+    switch (instr->m_opcode)
+    {
+    case Js::OpCode::Add_A:
+        op = Js::MemvectorOp_Add;
+        break;
+    case Js::OpCode::Sub_A:
+        op = Js::MemvectorOp_Sub;
+        break;
+    case Js::OpCode::Mul_A:
+        op = Js::MemvectorOp_Mul;
+        break;
+    case Js::OpCode::Div_A:
+        op = Js::MemvectorOp_Div;
+        break;
+    default:
+        return false;
+    }
+
+    // Only float specialized operations can be done on the elements without checks
+    IR::Opnd *dst = instr->GetDst();
+    IR::Opnd *src1 = instr->GetSrc1();
+    IR::Opnd *src2 = instr->GetSrc2();
+    if (!dst || !dst->IsRegOpnd() || !dst->IsFloat64() || !src1->IsFloat64() || !src2->IsFloat64() || instr->HasBailOutInfo())
+    {
+        return false;
+    }
+
+    // The loaded elements are still pending memcopy candidates at the head of the list
+    Loop::MemCopyCandidate* loads[2] = { nullptr, nullptr };
+    int loadCount = 0;
+    FOREACH_MEMOP_CANDIDATES(candidate, loop)
+    {
+        if (loadCount == 2 || !candidate->IsMemCopy() || candidate->AsMemCopy()->base != Js::Constants::InvalidSymID)
+        {
+            break;
+        }
+        loads[loadCount++] = candidate->AsMemCopy();
+    } NEXT_MEMOP_CANDIDATE;
+
+    const auto FindLoad = [&](IR::Opnd *opnd) -> Loop::MemCopyCandidate*
+    {
+        if (!opnd->IsRegOpnd() || !opnd->AsRegOpnd()->GetIsDead())
+        {
+            return nullptr;
+        }
+        const SymID symID = GetVarSymID(opnd->GetStackSym());
+        for (int i = 0; i < loadCount; ++i)
+        {
+            if (GetVarSymID(loads[i]->transferSym) == symID)
+            {
+                return loads[i];
+            }
+        }
+        return nullptr;
+    };
+
+    Loop::MemCopyCandidate* load1 = FindLoad(src1);
+    Loop::MemCopyCandidate* load2 = FindLoad(src2);
+    IR::Opnd *scalarOpnd = nullptr;
+    if (!load1)
+    {
+        // scalar op ld[i] only commutes for add and mul
+        if (op != Js::MemvectorOp_Add && op != Js::MemvectorOp_Mul)
+        {
+            return false;
+        }
+        load1 = load2;
+        load2 = nullptr;
+        scalarOpnd = src1;
+    }
+    else if (!load2)
+    {
+        scalarOpnd = src2;
+    }
+
+    if (!load1 || load1 == load2 || loadCount != (load2 ? 2 : 1))
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemVector, loop, instr, _u("Operands are not the pending LdElemI values"));
+        return false;
+    }
+    if (load2 && (load1->index != load2->index || load1->bIndexAlreadyChanged != load2->bIndexAlreadyChanged))
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemVector, loop, instr, _u("Index value changed between the two ldElem"));
+        return false;
+    }
+
+    Loop::MemVectorCandidate* memvectorInfo = JitAnewStruct(this->func->GetTopFunc()->m_fg->alloc, Loop::MemVectorCandidate);
+    if (scalarOpnd)
+    {
+        if (scalarOpnd->IsRegOpnd())
+        {
+            IR::RegOpnd* opnd = scalarOpnd->AsRegOpnd();
+            if (!this->OptIsInvariant(opnd, this->currentBlock, loop, this->FindValue(opnd->m_sym), true, true))
+            {
+                TRACE_MEMOP_PHASE_VERBOSE(MemVector, loop, instr, _u("Scalar operand is not an invariant"));
+                return false;
+            }
+            memvectorInfo->srcSym = opnd->GetStackSym();
+        }
+        else if (scalarOpnd->IsFloatConstOpnd())
+        {
+            memvectorInfo->constant.InitFloatConstValue(scalarOpnd->AsFloatConstOpnd()->m_value);
+        }
+        else
+        {
+            return false;
+        }
+        op = (Js::MemvectorOp)(op | Js::MemvectorOp_ScalarSrc);
+    }
+
+    memvectorInfo->base = Js::Constants::InvalidSymID; //need to find the stElem first
+    memvectorInfo->index = load1->index;
+    memvectorInfo->count = 0;
+    memvectorInfo->bIndexAlreadyChanged = load1->bIndexAlreadyChanged;
+    memvectorInfo->ldBase[0] = load1->ldBase;
+    memvectorInfo->ldBase[1] = load2 ? load2->ldBase : Js::Constants::InvalidSymID;
+    memvectorInfo->transferSym[0] = load1->transferSym;
+    memvectorInfo->transferSym[1] = load2 ? load2->transferSym : nullptr;
+    memvectorInfo->resultSym = dst->AsRegOpnd()->GetStackSym();
+    memvectorInfo->op = op;
+
+    // The loads are now part of the vector operation
+    for (int i = 0; i < loadCount; ++i)
+    {
+        loop->memOpInfo->candidates->Pop();
+    }
+    loop->memOpInfo->candidates->Prepend(memvectorInfo);
+    return true;
+}
+
+bool
+GlobOpt::CollectMemvectorStElementI(IR::Instr *instr, Loop *loop)
+{
+    if (!loop->memOpInfo || loop->memOpInfo->candidates->Empty())
+    {
+        // There is no vector operation matching this stElem
+        return false;
+    }
+
+    Loop::MemOpCandidate* previousCandidate = loop->memOpInfo->candidates->Head();
+    if (!previousCandidate->IsMemVector() || previousCandidate->base != Js::Constants::InvalidSymID)
+    {
+        return false;
+    }
+    Loop::MemVectorCandidate* memvectorInfo = previousCandidate->AsMemVector();
+
+    Assert(instr->GetDst()->IsIndirOpnd());
+    IR::IndirOpnd *dst = instr->GetDst()->AsIndirOpnd();
+    IR::Opnd *indexOp = dst->GetIndexOpnd();
+    IR::RegOpnd *baseOp = dst->GetBaseOpnd()->AsRegOpnd();
+    SymID baseSymID = GetVarSymID(baseOp->GetStackSym());
+
+    if (!instr->GetSrc1()->IsRegOpnd())
+    {
+        return false;
+    }
+    IR::RegOpnd* src1 = instr->GetSrc1()->AsRegOpnd();
+    if (!src1->GetIsDead() || GetVarSymID(src1->GetStackSym()) != GetVarSymID(memvectorInfo->resultSym))
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemVector, loop, instr, _u("Source (s%d) is not the result of the vector operation"), baseSymID);
+        return false;
+    }
+
+    if (!IsAllowedForMemOpt(instr, false, baseOp, indexOp) || !IsMemvectorValueType(baseOp->GetValueType()))
+    {
+        return false;
+    }
+
+    Assert(indexOp->GetStackSym());
+    SymID inductionSymID = GetVarSymID(indexOp->GetStackSym());
+    Assert(IsSymIDInductionVariable(inductionSymID, loop));
+    bool isIndexPreIncr = loop->memOpInfo->inductionVariableChangeInfoMap->ContainsKey(inductionSymID);
+    if (isIndexPreIncr != memvectorInfo->bIndexAlreadyChanged)
+    {
+        // The index changed between the loads and the store
+        TRACE_MEMOP_PHASE_VERBOSE(MemVector, loop, instr, _u("Index value changed between ldElem and stElem"));
+        return false;
+    }
+
+    memvectorInfo->count++;
+    memvectorInfo->base = baseSymID;
+
+    return true;
+}
+
 bool
 GlobOpt::CollectMemOpLdElementI(IR::Instr *instr, Loop *loop)
 {
     Assert(instr->m_opcode == Js::OpCode::LdElemI_A);
-    return (!PHASE_OFF(Js::MemCopyPhase, this->func) && CollectMemcopyLdElementI(instr, loop));
+    // Vector operations start out as memcopy candidates for their loads
+    return ((!PHASE_OFF(Js::MemCopyPhase, this->func) || !PHASE_OFF(Js::MemVectorPhase, this->func)) && CollectMemcopyLdElementI(instr, loop));
 }
 
 bool
@@ -4636,7 +4839,8 @@ GlobOpt::CollectMemOpStElementI(IR::Instr *instr, Loop *loop)
     Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict);
     Assert(instr->GetSrc1());
     return (!PHASE_OFF(Js::MemSetPhase, this->func) && CollectMemsetStElementI(instr, loop)) ||
-        (!PHASE_OFF(Js::MemCopyPhase, this->func) && CollectMemcopyStElementI(instr, loop));
+        (!PHASE_OFF(Js::MemCopyPhase, this->func) && CollectMemcopyStElementI(instr, loop)) ||
+        (!PHASE_OFF(Js::MemVectorPhase, this->func) && CollectMemvectorStElementI(instr, loop));
 }
 
 bool
@@ -4766,6 +4970,11 @@ MemOpCheckInductionVariable:
         // Fallthrough if not an induction variable
     }
     default:
+        if (CollectMemvectorArithmetic(instr, loop))
+        {
+            break;
+        }
+
         if (IsInstrInvalidForMemOp(instr, loop, src1Val, src2Val))
         {
             loop->doMemOp = false;
@@ -21196,14 +21405,12 @@ GlobOpt::FindArraySegmentLoadInstr(IR::Instr* fromInstr)
 }
 
 void
-GlobOpt::RemoveMemOpSrcInstr(IR::Instr* memopInstr, IR::Instr* srcInstr, BasicBlock* block)
+GlobOpt::RemoveMemOpSrcInstr(IR::RegOpnd* memopBaseOpnd, IR::Instr* srcInstr, BasicBlock* block)
 {
     Assert(srcInstr && (srcInstr->m_opcode == Js::OpCode::LdElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A_Strict));
-    Assert(memopInstr && (memopInstr->m_opcode == Js::OpCode::Memcopy || memopInstr->m_opcode == Js::OpCode::Memset));
+    Assert(memopBaseOpnd);
     Assert(block);
-    const bool isDst = srcInstr->m_opcode == Js::OpCode::StElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A_Strict;
-    IR::RegOpnd* opnd = (isDst ? memopInstr->GetDst() : memopInstr->GetSrc1())->AsIndirOpnd()->GetBaseOpnd();
-    IR::ArrayRegOpnd* arrayOpnd = opnd->IsArrayRegOpnd() ? opnd->AsArrayRegOpnd() : nullptr;
+    IR::ArrayRegOpnd* arrayOpnd = memopBaseOpnd->IsArrayRegOpnd() ? memopBaseOpnd->AsArrayRegOpnd() : nullptr;
 
     IR::Instr* topInstr = srcInstr;
     if (srcInstr->extractedUpperBoundCheckWithoutHoisting)
@@ -21326,7 +21533,10 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
     IR::IndirOpnd* dstOpnd = IR::IndirOpnd::New(baseOpnd, startIndexOpnd, dstType, localFunc);
 
     IR::Opnd *src1;
+    IR::Opnd *src2 = sizeOpnd;
+    IR::Instr *vectorSrcInstr = nullptr;
     const bool isMemset = emitData->candidate->IsMemSet();
+    const bool isMemvector = emitData->candidate->IsMemVector();
 
     // Get the source according to the memop type
     if (isMemset)
@@ -21344,6 +21554,50 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
             src1 = IR::AddrOpnd::New(candidate->constant.ToVar(localFunc, func->GetScriptContext()), IR::AddrOpndKindConstant, localFunc);
         }
     }
+    else if (isMemvector)
+    {
+        MemVectorEmitData* data = (MemVectorEmitData*)emitData;
+        const Loop::MemVectorCandidate* candidate = data->candidate->AsMemVector();
+        Assert(data->ldElemInstr[0] && data->arithInstr);
+
+        IR::RegOpnd *srcBaseOpnd = nullptr;
+        IR::RegOpnd *srcIndexOpnd = nullptr;
+        IRType srcType;
+        GetMemOpSrcInfo(loop, data->ldElemInstr[0], srcBaseOpnd, srcIndexOpnd, srcType);
+        Assert(GetVarSymID(srcIndexOpnd->GetStackSym()) == GetVarSymID(indexOpnd->GetStackSym()));
+        src1 = IR::IndirOpnd::New(srcBaseOpnd, startIndexOpnd, srcType, localFunc);
+
+        IR::Opnd *vectorSrc;
+        if (data->ldElemInstr[1])
+        {
+            GetMemOpSrcInfo(loop, data->ldElemInstr[1], srcBaseOpnd, srcIndexOpnd, srcType);
+            Assert(GetVarSymID(srcIndexOpnd->GetStackSym()) == GetVarSymID(indexOpnd->GetStackSym()));
+            vectorSrc = srcBaseOpnd;
+        }
+        else if (candidate->srcSym)
+        {
+            IR::RegOpnd* regSrc = IR::RegOpnd::New(candidate->srcSym, candidate->srcSym->GetType(), func);
+            regSrc->SetIsJITOptimizedReg(true);
+            vectorSrc = regSrc;
+        }
+        else
+        {
+            vectorSrc = IR::AddrOpnd::New(candidate->constant.ToVar(localFunc, func->GetScriptContext()), IR::AddrOpndKindConstant, localFunc);
+        }
+
+        // The operation, the size and the second source do not fit in the instruction, chain them like an inlined built-in:
+        // (dst)opArg:   ExtendArg_A (src1)op
+        // (dst)sizeArg: ExtendArg_A (src1)size (src2)opArg
+        // (dst)srcArg:  ExtendArg_A (src1)vectorSrc (src2)sizeArg
+        // [dst]:        Memvector [src1] (src2)srcArg
+        IR::Instr *opArgInstr = IR::Instr::New(Js::OpCode::ExtendArg_A, IR::RegOpnd::New(TyVar, localFunc), IR::IntConstOpnd::New(candidate->op, TyInt32, localFunc, true), localFunc);
+        insertBeforeInstr->InsertBefore(opArgInstr);
+        IR::Instr *sizeArgInstr = IR::Instr::New(Js::OpCode::ExtendArg_A, IR::RegOpnd::New(TyVar, localFunc), sizeOpnd, opArgInstr->GetDst(), localFunc);
+        insertBeforeInstr->InsertBefore(sizeArgInstr);
+        vectorSrcInstr = IR::Instr::New(Js::OpCode::ExtendArg_A, IR::RegOpnd::New(TyVar, localFunc), vectorSrc, sizeArgInstr->GetDst(), localFunc);
+        insertBeforeInstr->InsertBefore(vectorSrcInstr);
+        src2 = vectorSrcInstr->GetDst();
+    }
     else
     {
         Assert(emitData->candidate->IsMemCopy());
@@ -21362,10 +21616,11 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
     }
 
     // Generate memcopy
-    IR::Instr* memopInstr = IR::BailOutInstr::New(isMemset ? Js::OpCode::Memset : Js::OpCode::Memcopy, bailOutKind, bailOutInfo, localFunc);
+    Js::OpCode memopOpcode = isMemset ? Js::OpCode::Memset : isMemvector ? Js::OpCode::Memvector : Js::OpCode::Memcopy;
+    IR::Instr* memopInstr = IR::BailOutInstr::New(memopOpcode, bailOutKind, bailOutInfo, localFunc);
     memopInstr->SetDst(dstOpnd);
     memopInstr->SetSrc1(src1);
-    memopInstr->SetSrc2(sizeOpnd);
+    memopInstr->SetSrc2(src2);
     insertBeforeInstr->InsertBefore(memopInstr);
 
 #if DBG_DUMP
@@ -21424,6 +21679,34 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
                               loopCountBuf,
                               bIndexAlreadyChanged);
         }
+        else if (isMemvector)
+        {
+            const Loop::MemVectorCandidate* candidate = emitData->candidate->AsMemVector();
+            const int srcBufSize = 32;
+            char16 srcBuf[srcBufSize];
+            if (candidate->ldBase[1] != Js::Constants::InvalidSymID)
+            {
+                _snwprintf_s(srcBuf, srcBufSize, _u("s%u[]"), candidate->ldBase[1]);
+            }
+            else if (candidate->srcSym)
+            {
+                _snwprintf_s(srcBuf, srcBufSize, _u("s%u"), candidate->srcSym->m_id);
+            }
+            else
+            {
+                _snwprintf_s(srcBuf, srcBufSize, _u("%.4f"), candidate->constant.u.floatConst.value);
+            }
+            TRACE_MEMOP_PHASE(MemVector, loop, emitData->stElemInstr,
+                              _u("ValueType: %S, StBase: s%u, Index: s%u, LdBase: s%u, Op: %s, Src2: %s, LoopCount: %s, IsIndexChangedBeforeUse: %d"),
+                              valueTypeStr,
+                              candidate->base,
+                              candidate->index,
+                              candidate->ldBase[0],
+                              Js::OpCodeUtil::GetOpCodeName(((MemVectorEmitData*)emitData)->arithInstr->m_opcode),
+                              srcBuf,
+                              loopCountBuf,
+                              bIndexAlreadyChanged);
+        }
         else
         {
             const Loop::MemCopyCandidate* candidate = emitData->candidate->AsMemCopy();
@@ -21440,10 +21723,20 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
     }
 #endif
 
-    RemoveMemOpSrcInstr(memopInstr, emitData->stElemInstr, emitData->block);
-    if (!isMemset)
+    RemoveMemOpSrcInstr(memopInstr->GetDst()->AsIndirOpnd()->GetBaseOpnd(), emitData->stElemInstr, emitData->block);
+    if (isMemvector)
     {
-        RemoveMemOpSrcInstr(memopInstr, ((MemCopyEmitData*)emitData)->ldElemInstr, emitData->block);
+        MemVectorEmitData* data = (MemVectorEmitData*)emitData;
+        this->ConvertToByteCodeUses(data->arithInstr);
+        if (data->ldElemInstr[1])
+        {
+            RemoveMemOpSrcInstr(vectorSrcInstr->GetSrc1()->AsRegOpnd(), data->ldElemInstr[1], emitData->block);
+        }
+        RemoveMemOpSrcInstr(memopInstr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd(), data->ldElemInstr[0], emitData->block);
+    }
+    else if (!isMemset)
+    {
+        RemoveMemOpSrcInstr(memopInstr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd(), ((MemCopyEmitData*)emitData)->ldElemInstr, emitData->block);
     }
 }
 
@@ -21531,6 +21824,75 @@ GlobOpt::InspectInstrForMemCopyCandidate(Loop* loop, IR::Instr* instr, MemCopyEm
     return false;
 }
 
+bool
+GlobOpt::InspectInstrForMemVectorCandidate(Loop* loop, IR::Instr* instr, MemVectorEmitData* emitData, bool& errorInInstr)
+{
+    Assert(emitData && emitData->candidate && emitData->candidate->IsMemVector());
+    Loop::MemVectorCandidate* candidate = (Loop::MemVectorCandidate*)emitData->candidate;
+    if (instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict)
+    {
+        if (
+            !emitData->stElemInstr &&
+            instr->GetDst()->IsIndirOpnd() &&
+            (GetVarSymID(instr->GetDst()->AsIndirOpnd()->GetBaseOpnd()->GetStackSym()) == candidate->base) &&
+            (GetVarSymID(instr->GetDst()->AsIndirOpnd()->GetIndexOpnd()->GetStackSym()) == candidate->index)
+            )
+        {
+            Assert(instr->IsProfiledInstr());
+            emitData->stElemInstr = instr;
+            emitData->bailOutKind = instr->GetBailOutKind();
+            // Still need to find the operation and the LdElems
+            return false;
+        }
+        TRACE_MEMOP_PHASE_VERBOSE(MemVector, loop, instr, _u("Orphan StElemI_A detected"));
+        errorInInstr = true;
+    }
+    else if (instr->GetDst() && instr->GetDst()->IsRegOpnd() && GetVarSymID(instr->GetDst()->GetStackSym()) == GetVarSymID(candidate->resultSym))
+    {
+        if (!emitData->stElemInstr || emitData->arithInstr)
+        {
+            TRACE_MEMOP_PHASE_VERBOSE(MemVector, loop, instr, _u("Unexpected definition of the vector operation result"));
+            errorInInstr = true;
+            return false;
+        }
+        emitData->arithInstr = instr;
+    }
+    else if (instr->m_opcode == Js::OpCode::LdElemI_A)
+    {
+        if (emitData->arithInstr && instr->GetSrc1()->IsIndirOpnd())
+        {
+            const SymID baseSymID = GetVarSymID(instr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->GetStackSym());
+            const SymID indexSymID = GetVarSymID(instr->GetSrc1()->AsIndirOpnd()->GetIndexOpnd()->GetStackSym());
+            const SymID dstSymID = GetVarSymID(instr->GetDst()->GetStackSym());
+            for (int i = 0; i < 2; ++i)
+            {
+                if (!emitData->ldElemInstr[i] &&
+                    candidate->transferSym[i] &&
+                    baseSymID == candidate->ldBase[i] &&
+                    indexSymID == candidate->index &&
+                    dstSymID == GetVarSymID(candidate->transferSym[i]))
+                {
+                    Assert(instr->IsProfiledInstr());
+                    emitData->ldElemInstr[i] = instr;
+                    ValueType stValueType = emitData->stElemInstr->GetDst()->AsIndirOpnd()->GetBaseOpnd()->GetValueType();
+                    ValueType ldValueType = instr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->GetValueType();
+                    if (stValueType != ldValueType || !IsMemvectorValueType(ldValueType))
+                    {
+                        TRACE_MEMOP_PHASE_VERBOSE(MemVector, loop, instr, _u("Load and store value types do not match"));
+                        errorInInstr = true;
+                        return false;
+                    }
+                    // We found all the instructions once every load is found
+                    return emitData->ldElemInstr[0] && (!candidate->transferSym[1] || emitData->ldElemInstr[1]);
+                }
+            }
+        }
+        TRACE_MEMOP_PHASE_VERBOSE(MemVector, loop, instr, _u("Orphan LdElemI_A detected"));
+        errorInInstr = true;
+    }
+    return false;
+}
+
 // The caller is responsible to free the memory allocated between inOrderEmitData[iEmitData -> end]
 bool
 GlobOpt::ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) MemOpEmitData** inOrderEmitData, int& iEmitData)
@@ -21582,6 +21944,16 @@ GlobOpt::ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) MemOpEmitD
                 Assert(!PHASE_OFF(Js::MemSetPhase, this->func));
                 emitData = JitAnew(this->alloc, MemSetEmitData);
             }
+            else if (candidate->IsMemVector())
+            {
+                Assert(!PHASE_OFF(Js::MemVectorPhase, this->func));
+                if (candidate->base == Js::Constants::InvalidSymID)
+                {
+                    TRACE_MEMOP_PHASE(MemVector, loop, nullptr, _u("Vector operation without a matching stElem"));
+                    return false;
+                }
+                emitData = JitAnew(this->alloc, MemVectorEmitData);
+            }
             else
             {
                 Assert(!PHASE_OFF(Js::MemCopyPhase, this->func));
@@ -21606,6 +21978,8 @@ GlobOpt::ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) MemOpEmitD
         bool errorInInstr = false;
         bool candidateFound = candidate->IsMemSet() ?
             InspectInstrForMemSetCandidate(loop, instr, (MemSetEmitData*)emitData, errorInInstr)
+            : candidate->IsMemVector() ?
+            InspectInstrForMemVectorCandidate(loop, instr, (MemVectorEmitData*)emitData, errorInInstr)
             : InspectInstrForMemCopyCandidate(loop, instr, (MemCopyEmitData*)emitData, errorInInstr);
         if (errorInInstr)
         {
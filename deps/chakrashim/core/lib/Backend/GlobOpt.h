@@ -1444,8 +1444,11 @@ private:
     bool                    CollectMemOpStElementI(IR::Instr *, Loop *);
     bool                    CollectMemsetStElementI(IR::Instr *, Loop *);
     bool                    CollectMemcopyStElementI(IR::Instr *, Loop *);
+    bool                    CollectMemvectorStElementI(IR::Instr *, Loop *);
     bool                    CollectMemOpLdElementI(IR::Instr *, Loop *);
     bool                    CollectMemcopyLdElementI(IR::Instr *, Loop *);
+    bool                    CollectMemvectorArithmetic(IR::Instr *, Loop *);
+    static bool             IsMemvectorValueType(const ValueType valueType);
     SymID                   GetVarSymID(StackSym *);
     const InductionVariable* GetInductionVariable(SymID, Loop *);
     bool                    IsSymIDInductionVariable(SymID, Loop *);
@@ -1454,6 +1457,7 @@ private:
     void                    ProcessMemOp();
     bool                    InspectInstrForMemSetCandidate(Loop* loop, IR::Instr* instr, struct MemSetEmitData* emitData, bool& errorInInstr);
     bool                    InspectInstrForMemCopyCandidate(Loop* loop, IR::Instr* instr, struct MemCopyEmitData* emitData, bool& errorInInstr);
+    bool                    InspectInstrForMemVectorCandidate(Loop* loop, IR::Instr* instr, struct MemVectorEmitData* emitData, bool& errorInInstr);
     bool                    ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) struct MemOpEmitData** emitData, int& iEmitData);
     void                    HoistHeadSegmentForMemOp(IR::Instr *instr, IR::ArrayRegOpnd *arrayRegOpnd, IR::Instr *insertBeforeInstr);
     void                    EmitMemop(Loop * loop, LoopCount *loopCount, const struct MemOpEmitData* emitData);
@@ -1462,7 +1466,7 @@ private:
     LoopCount*              GetOrGenerateLoopCountForMemOp(Loop *loop);
     IR::Instr*              FindUpperBoundsCheckInstr(IR::Instr* instr);
     IR::Instr*              FindArraySegmentLoadInstr(IR::Instr* instr);
-    void                    RemoveMemOpSrcInstr(IR::Instr* memopInstr, IR::Instr* srcInstr, BasicBlock* block);
+    void                    RemoveMemOpSrcInstr(IR::RegOpnd* memopBaseOpnd, IR::Instr* srcInstr, BasicBlock* block);
     void                    GetMemOpSrcInfo(Loop* loop, IR::Instr* instr, IR::RegOpnd*& base, IR::RegOpnd*& index, IRType& arrayType);
     bool                    HasMemOp(Loop * loop);
 
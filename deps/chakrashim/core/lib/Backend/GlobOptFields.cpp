@@ -270,7 +270,8 @@ bool GlobOpt::HasMemOp(Loop *loop)
         loop->doMemOp &&
         (
             !PHASE_OFF(Js::MemSetPhase, this->func) ||
-            !PHASE_OFF(Js::MemCopyPhase, this->func)
+            !PHASE_OFF(Js::MemCopyPhase, this->func) ||
+            !PHASE_OFF(Js::MemVectorPhase, this->func)
         ) &&
         loop->memOpInfo &&
         loop->memOpInfo->candidates &&
@@ -206,7 +206,10 @@ Inline::Optimize(Func *func, __in_ecount_opt(callerArgOutCount) IR::Instr *calle
                             TryDisableRuntimePolymorphicCacheOn(methodValueOpnd);
                             break;
                         }
-                        if (!PHASE_OFF(Js::FixedMethodsPhase, this->topFunc) && !PHASE_OFF(Js::PolymorphicInlineFixedMethodsPhase, this->topFunc))
+                        // Fixed method dispatch bails out on a type check failure, so it isn't used when some targets
+                        // weren't inlined and need the fallback call
+                        if (!PHASE_OFF(Js::FixedMethodsPhase, this->topFunc) && !PHASE_OFF(Js::PolymorphicInlineFixedMethodsPhase, this->topFunc) &&
+                            !inlinerData->HasPolymorphicCallFallback(profileId))
                         {
                             instrNext = InlinePolymorphicFunctionUsingFixedMethods(instr, inlinerData, symThis, profileId, methodValueOpnd, &isInlined, recursiveInlineDepth);
                         }
@@ -969,6 +972,12 @@ Inline::InlinePolymorphicFunction(IR::Instr *callInstr, const Js::FunctionCodeGe
                     inlineeFunctionBody->GetDisplayName(), inlineeFunctionBody->GetDebugNumberSet(debugStringBuffer),
                     inlinerData->GetFunctionBody()->GetDisplayName(), inlinerData->GetFunctionBody()->GetDebugNumberSet(debugStringBuffer2));
     }
+    const bool hasFallbackCall = inlinerData->HasPolymorphicCallFallback(profileId);
+    if (hasFallbackCall)
+    {
+        POLYMORPHIC_INLINE_TESTTRACE(_u("INLINING (Polymorphic): Fallback call for the targets that weren't inlined\tCaller: %s (%s)\n"),
+                    inlinerData->GetFunctionBody()->GetDisplayName(), inlinerData->GetFunctionBody()->GetDebugNumberSet(debugStringBuffer2));
+    }
     POLYMORPHIC_INLINE_TESTTRACE(_u("------------------------------------------------\n"));
 
     *pIsInlined = true;
@@ -1015,7 +1024,14 @@ Inline::InlinePolymorphicFunction(IR::Instr *callInstr, const Js::FunctionCodeGe
             IR::AddrOpnd::New(inlineesDataArray[i].functionBody, IR::AddrOpndKindDynamicFunctionBody, dispatchStartLabel->m_func), dispatchStartLabel->m_func));
     }
 
-    CompletePolymorphicInlining(callInstr, returnValueOpnd, doneLabel, dispatchStartLabel, /*ldMethodFldInstr*/nullptr, IR::BailOutOnPolymorphicInlineFunction);
+    if (hasFallbackCall)
+    {
+        CompletePolymorphicInliningWithFallbackCall(callInstr, returnValueOpnd, doneLabel, dispatchStartLabel);
+    }
+    else
+    {
+        CompletePolymorphicInlining(callInstr, returnValueOpnd, doneLabel, dispatchStartLabel, /*ldMethodFldInstr*/nullptr, IR::BailOutOnPolymorphicInlineFunction);
+    }
 
     this->topFunc->SetHasInlinee();
     InsertStatementBoundary(instrNext);
@@ -1072,6 +1088,39 @@ void Inline::CompletePolymorphicInlining(IR::Instr* callInstr, IR::RegOpnd* retu
     callInstr->Remove(); // We don't need callInstr anymore.
 }
 
+void Inline::CompletePolymorphicInliningWithFallbackCall(IR::Instr* callInstr, IR::RegOpnd* returnValueOpnd, IR::LabelInstr* doneLabel, IR::Instr* dispatchStartLabel)
+{
+    // Label $fallback:
+    // ArgOut_A (cloned)
+    // returnValueOpnd = CallI
+    // Label $done:
+    IR::LabelInstr* fallbackLabel = IR::LabelInstr::New(Js::OpCode::Label, callInstr->m_func);
+    callInstr->InsertBefore(fallbackLabel);
+    dispatchStartLabel->InsertBefore(IR::BranchInstr::New(Js::OpCode::Br, fallbackLabel, callInstr->m_func));
+
+    IR::Instr* fallbackCallInstr = IR::Instr::New(callInstr->m_opcode, callInstr->m_func);
+    fallbackCallInstr->SetSrc1(callInstr->GetSrc1());
+    if (returnValueOpnd)
+    {
+        StackSym* returnValueSym = returnValueOpnd->m_sym->AsStackSym();
+        IR::Opnd* dstOpnd = IR::RegOpnd::New(returnValueSym, returnValueSym->GetType(), callInstr->m_func);
+        dstOpnd->SetValueType(returnValueOpnd->GetValueType());
+        fallbackCallInstr->SetDst(dstOpnd);
+    }
+    fallbackCallInstr->SetIsCloned(true);
+    callInstr->InsertBefore(fallbackCallInstr);
+    this->CloneCallSequence(callInstr, fallbackCallInstr);
+
+    callInstr->IterateArgInstrs([&](IR::Instr* argInstr) {
+        // Remove the original args
+        argInstr->Remove();
+        return false;
+    });
+
+    callInstr->InsertBefore(doneLabel);
+    callInstr->Remove(); // We don't need callInstr anymore.
+}
+
 //
 // Inlines a function if it is a polymorphic inlining candidate.
 // otherwise introduces a call to it.
@@ -3186,6 +3235,18 @@ Inline::SetupInlineInstrForCallDirect(Js::BuiltinFunction builtInId, IR::Instr*
         callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperString_PadEnd, callInstr->m_func));
         break;
 
+    case Js::BuiltinFunction::Map_Get:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperMap_Get, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::Map_Has:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperMap_Has, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::Map_Set:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperMap_Set, callInstr->m_func));
+        break;
+
     case Js::BuiltinFunction::GlobalObject_ParseInt:
         callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperGlobalObject_ParseInt, callInstr->m_func));
         break;
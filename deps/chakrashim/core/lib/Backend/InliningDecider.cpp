@@ -126,17 +126,24 @@ Js::FunctionInfo *InliningDecider::InlineCallSite(Js::FunctionBody *const inline
 }
 
 uint InliningDecider::InlinePolymorphicCallSite(Js::FunctionBody *const inliner, const Js::ProfileId profiledCallSiteId,
-    Js::FunctionBody** functionBodyArray, uint functionBodyArrayLength, bool* canInlineArray, uint recursiveInlineDepth)
+    Js::FunctionBody** functionBodyArray, uint functionBodyArrayLength, bool* canInlineArray, bool* hasFallbackCall, uint recursiveInlineDepth)
 {
     Assert(inliner);
     Assert(profiledCallSiteId < inliner->GetProfiledCallSiteCount());
     Assert(functionBodyArray);
+    Assert(hasFallbackCall);
+
+    *hasFallbackCall = false;
 
     const auto profileData = inliner->GetAnyDynamicProfileInfo();
     Assert(profileData);
 
+    // Only the hottest targets are inlined. The array holds at most maxPolymorphicInliningSize of them.
+    uint inlineTargetLimit = min((uint)max(CONFIG_FLAG(PolymorphicInlineTargetCount), 2), functionBodyArrayLength);
+
     bool isConstructorCall;
-    if (!profileData->GetPolymorphicCallSiteInfo(inliner, profiledCallSiteId, &isConstructorCall, functionBodyArray, functionBodyArrayLength))
+    uint targetCount;
+    if (!profileData->GetPolymorphicCallSiteInfo(inliner, profiledCallSiteId, &isConstructorCall, functionBodyArray, inlineTargetLimit, &targetCount))
     {
         return false;
     }
@@ -144,7 +151,7 @@ uint InliningDecider::InlinePolymorphicCallSite(Js::FunctionBody *const inliner,
     uint inlineeCount = 0;
     uint actualInlineeCount  = 0;
 
-    for (inlineeCount = 0; inlineeCount < functionBodyArrayLength; inlineeCount++)
+    for (inlineeCount = 0; inlineeCount < inlineTargetLimit; inlineeCount++)
     {
         if (!functionBodyArray[inlineeCount])
         {
@@ -177,6 +184,15 @@ uint InliningDecider::InlinePolymorphicCallSite(Js::FunctionBody *const inliner,
             return 0;
         }
     }
+
+    // Calls to the targets that weren't inlined don't match any inlinee and go through a fallback call rather than
+    // bailing out.
+    if (targetCount > inlineeCount)
+    {
+        POLYMORPHIC_INLINE_TESTTRACE(_u("INLINING (Polymorphic): Call site with %d targets: dispatching to the hottest %d, with a fallback call\tCallSiteId: %d\tCaller: %s\n"),
+            targetCount, inlineeCount, profiledCallSiteId, inliner->GetDisplayName());
+        *hasFallbackCall = true;
+    }
     return inlineeCount;
 }
 
@@ -423,6 +439,9 @@ bool InliningDecider::GetBuiltInInfo(
 
     case Js::JavascriptBuiltInFunction::JavascriptString_Link:
     case Js::JavascriptBuiltInFunction::JavascriptString_LocaleCompare:
+
+    case Js::JavascriptBuiltInFunction::JavascriptMap_Get:
+    case Js::JavascriptBuiltInFunction::JavascriptMap_Set:
         goto CallDirectCommon;
 
     case Js::JavascriptBuiltInFunction::JavascriptArray_Join:
@@ -447,6 +466,7 @@ bool InliningDecider::GetBuiltInInfo(
         goto CallDirectCommon;
 
     case Js::JavascriptBuiltInFunction::JavascriptArray_Includes:
+    case Js::JavascriptBuiltInFunction::JavascriptMap_Has:
         *returnType = ValueType::Boolean;
         goto CallDirectCommon;
 
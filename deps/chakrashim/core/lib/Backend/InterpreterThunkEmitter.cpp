@@ -3,6 +3,9 @@
 // Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
 //-------------------------------------------------------------------------------------------------------
 #include "Backend.h"
+#ifdef PERF_JIT_PROFILING
+#include "Base/PerfJitProfile.h"
+#endif
 
 #ifdef ENABLE_NATIVE_CODEGEN
 #ifdef _M_X64
@@ -361,6 +364,10 @@ void InterpreterThunkEmitter::NewThunkBlock()
     // Call to set VALID flag for CFG check
     ThreadContext::GetContextForCurrentThread()->SetValidCallTargetForCFG(buffer);
 
+#ifdef PERF_JIT_PROFILING
+    PerfJitProfile::LogInterpreterThunkBlockLoadEvent(buffer, bufferSize);
+#endif
+
     // Update object state only at the end when everything has succeeded - and no exceptions can be thrown.
     ThunkBlock* block = this->thunkBlocks.PrependNode(allocator, buffer);
     UNREFERENCED_PARAMETER(block);
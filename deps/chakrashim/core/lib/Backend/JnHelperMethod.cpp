@@ -8,6 +8,9 @@
 #include "RegexCommon.h"
 
 #include "Library/RegexHelper.h"
+#include "Library/SameValueComparer.h"
+#include "Library/MapOrSetDataTable.h"
+#include "Library/JavascriptMap.h"
 
 #include "Debug/DiagHelperMethodWrapper.h"
 #include "Math/JavascriptSSE2MathOperators.h"
@@ -476,6 +479,9 @@ const char16 *GetVtableName(VTableValue value)
     case VtableJavascriptRegExp:
         return _u("vtable JavascriptRegExp");
         break;
+    case VtableJavascriptMap:
+        return _u("vtable JavascriptMap");
+        break;
     case VtableStackScriptFunction:
         return _u("vtable StackScriptFunction");
         break;
@@ -204,6 +204,7 @@ HELPERCALL(Op_DeleteElementI_Int32, Js::JavascriptOperators::OP_DeleteElementI_I
 
 HELPERCALL(Op_Memset, Js::JavascriptOperators::OP_Memset, AttrCanThrow)
 HELPERCALL(Op_Memcopy, Js::JavascriptOperators::OP_Memcopy, AttrCanThrow)
+HELPERCALL(Op_Memvector, Js::JavascriptOperators::OP_Memvector, AttrCanThrow)
 
 HELPERCALL(Op_PatchGetValue, ((Js::Var (*)(Js::FunctionBody *const, Js::InlineCache *const, const Js::InlineCacheIndex, Js::Var, Js::PropertyId))Js::JavascriptOperators::PatchGetValue<true, Js::InlineCache>), AttrCanThrow)
 HELPERCALL(Op_PatchGetValueWithThisPtr, ((Js::Var(*)(Js::FunctionBody *const, Js::InlineCache *const, const Js::InlineCacheIndex, Js::Var, Js::PropertyId, Js::Var))Js::JavascriptOperators::PatchGetValueWithThisPtr<true, Js::InlineCache>), AttrCanThrow)
@@ -467,6 +468,16 @@ HELPERCALL(GlobalObject_ParseInt, Js::GlobalObject::EntryParseInt, 0)
 HELPERCALL(String_PadStart, Js::JavascriptString::EntryPadStart, 0)
 HELPERCALL(String_PadEnd, Js::JavascriptString::EntryPadEnd, 0)
 
+HELPERCALL(Map_Get, Js::JavascriptMap::EntryGet, 0)
+HELPERCALL(Map_Has, Js::JavascriptMap::EntryHas, 0)
+HELPERCALL(Map_Set, Js::JavascriptMap::EntrySet, 0)
+HELPERCALL(Map_DirectGet, Js::JavascriptMap::DirectGet, 0)
+HELPERCALL(Map_DirectHas, Js::JavascriptMap::DirectHas, 0)
+HELPERCALL(Map_DirectSet, Js::JavascriptMap::DirectSet, 0)
+HELPERCALL(Array_DirectIndexOf, Js::JavascriptArray::DirectIndexOf, 0)
+HELPERCALL(String_DirectIndexOf, Js::JavascriptString::DirectIndexOf, 0)
+HELPERCALL(String_DirectSlice, Js::JavascriptString::DirectSlice, 0)
+
 HELPERCALL(RegExp_SplitResultUsed, Js::RegexHelper::RegexSplitResultUsed, 0)
 HELPERCALL(RegExp_SplitResultUsedAndMayBeTemp, Js::RegexHelper::RegexSplitResultUsedAndMayBeTemp, 0)
 HELPERCALL(RegExp_SplitResultNotUsed, Js::RegexHelper::RegexSplitResultNotUsed, 0)
@@ -686,6 +686,24 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
             case IR::JnHelperMethod::HelperString_Replace:
                 GenerateFastInlineStringReplace(instr);
                 break;
+            case IR::JnHelperMethod::HelperMap_Get:
+                GenerateFastInlineMapMethod(instr, IR::HelperMap_DirectGet, 2);
+                break;
+            case IR::JnHelperMethod::HelperMap_Has:
+                GenerateFastInlineMapMethod(instr, IR::HelperMap_DirectHas, 2);
+                break;
+            case IR::JnHelperMethod::HelperMap_Set:
+                GenerateFastInlineMapMethod(instr, IR::HelperMap_DirectSet, 3);
+                break;
+            case IR::JnHelperMethod::HelperArray_IndexOf:
+                GenerateFastInlineArrayIndexOf(instr);
+                break;
+            case IR::JnHelperMethod::HelperString_IndexOf:
+                GenerateFastInlineStringIndexOf(instr);
+                break;
+            case IR::JnHelperMethod::HelperString_Slice:
+                GenerateFastInlineStringSlice(instr);
+                break;
             }
             instrPrev = LowerCallDirect(instr);
             break;
@@ -1503,6 +1521,7 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
 
         case Js::OpCode::Memset:
         case Js::OpCode::Memcopy:
+        case Js::OpCode::Memvector:
         {
             instrPrev = LowerMemOp(instr);
             break;
@@ -5058,7 +5077,7 @@ Lowerer::LowerNewScObjArrayNoArg(IR::Instr *newObjInstr)
 void
 Lowerer::LowerPrologEpilog()
 {
-    if (m_func->GetJnFunction()->IsGenerator())
+    if (m_func->IsGeneratorFunc())
     {
         LowerGeneratorResumeJumpTable();
     }
@@ -5095,7 +5114,7 @@ Lowerer::LowerPrologEpilogAsmJs()
 void
 Lowerer::LowerGeneratorResumeJumpTable()
 {
-    Assert(m_func->GetJnFunction()->IsGenerator());
+    Assert(m_func->IsGeneratorFunc());
 
     IR::Instr * jumpTableInstr = m_func->m_headInstr;
     AssertMsg(jumpTableInstr->IsEntryInstr(), "First instr isn't an EntryInstr...");
@@ -5150,7 +5169,7 @@ Lowerer::DoInterruptProbes()
                 //   bgt $continue
                 // $helper:
                 //   call JavascriptOperators::ScriptAbort
-                //   b $exit
+                //   b $continue
                 // $continue:
 
                 IR::LabelInstr *newLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func);
@@ -5190,7 +5209,7 @@ Lowerer::DoLoopProbeAndNumber(IR::BranchInstr *branchInstr)
         // beq $loop
         // $helper:
         // call abort
-        // b $exit
+        // b $loop
 
         this->InsertOneLoopProbe(branchInstr, labelInstr);
         branchInstr->Remove();
@@ -5204,7 +5223,7 @@ Lowerer::DoLoopProbeAndNumber(IR::BranchInstr *branchInstr)
         // beq $loop
         // $helper:
         // call abort
-        // b $exit
+        // b $loop
         // $notloop:
 
         IR::LabelInstr *loopExitLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func);
@@ -5248,21 +5267,10 @@ Lowerer::InsertOneLoopProbe(IR::Instr *insertInstr, IR::LabelInstr *loopLabel)
     insertInstr->InsertBefore(instr);
     this->m_lowererMD.LowerCall(instr, 0);
 
-    // Jump to the exit after the helper call. This instruction will never be reached, but the jump
-    // indicates that nothing is live after the call (to avoid useless spills in code that will
-    // be executed).
-    instr = this->m_func->m_exitInstr->GetPrevRealInstrOrLabel();
-    if (instr->IsLabelInstr())
-    {
-        helperLabel = instr->AsLabelInstr();
-    }
-    else
-    {
-        helperLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func);
-        this->m_func->m_exitInstr->InsertBefore(helperLabel);
-    }
-
-    instr = IR::BranchInstr::New(LowererMD::MDUncondBranchOpcode, helperLabel, this->m_func);
+    // The helper returns, rather than throwing, when the probe failed for a stack sample request.
+    // Resume where the probe succeeds; values live there are spilled around the call on this
+    // helper path only.
+    instr = IR::BranchInstr::New(LowererMD::MDUncondBranchOpcode, loopLabel, this->m_func);
     insertInstr->InsertBefore(instr);
 }
 
@@ -7542,7 +7550,7 @@ Lowerer::LoadArgumentCount(IR::Instr *const instr)
         instr->SetSrc1(IR::IntConstOpnd::New(instr->m_func->actualCount, TyUint32, instr->m_func, true));
         LowererMD::ChangeToAssign(instr);
     }
-    else if (instr->m_func->GetJnFunction()->IsGenerator())
+    else if (instr->m_func->IsGeneratorFunc())
     {
         IR::SymOpnd* symOpnd = LoadCallInfo(instr);
         instr->SetSrc1(symOpnd);
@@ -8484,10 +8492,83 @@ Lowerer::LowerMemcopy(IR::Instr * instr, IR::RegOpnd * helperRet)
     return nullptr;
 }
 
+/*
+    Lower the Memvector opcode. The glob opt chains the extra operands:
+    (dst)opArg:   ExtendArg_A (src1)op
+    (dst)sizeArg: ExtendArg_A (src1)size (src2)opArg
+    (dst)srcArg:  ExtendArg_A (src1)src2 (src2)sizeArg
+    [dst]:        Memvector [src1] (src2)srcArg
+
+    We'll convert it to:
+    CALL Op_Memvector dstBase, startIndex, src1Base, src2, size, op
+*/
+IR::Instr *
+Lowerer::LowerMemvector(IR::Instr * instr, IR::RegOpnd * helperRet)
+{
+    IR::Opnd * dst = instr->UnlinkDst();
+    IR::Opnd * src = instr->UnlinkSrc1();
+    IR::Opnd * linkOpnd = instr->UnlinkSrc2();
+
+    Assert(dst->IsIndirOpnd());
+    Assert(src->IsIndirOpnd());
+    Assert(linkOpnd->IsRegOpnd());
+
+    IR::Opnd *dstBaseOpnd = dst->AsIndirOpnd()->UnlinkBaseOpnd();
+    IR::Opnd *dstIndexOpnd = dst->AsIndirOpnd()->UnlinkIndexOpnd();
+    IR::Opnd *srcBaseOpnd = src->AsIndirOpnd()->UnlinkBaseOpnd();
+
+    IR::Instr *argInstr = linkOpnd->AsRegOpnd()->m_sym->m_instrDef;
+    Assert(argInstr->m_opcode == Js::OpCode::ExtendArg_A);
+    IR::Opnd *src2Opnd = argInstr->GetSrc1()->Copy(m_func);
+
+    argInstr = argInstr->GetSrc2()->AsRegOpnd()->m_sym->m_instrDef;
+    Assert(argInstr->m_opcode == Js::OpCode::ExtendArg_A);
+    IR::Opnd *sizeOpnd = argInstr->GetSrc1()->Copy(m_func);
+
+    argInstr = argInstr->GetSrc2()->AsRegOpnd()->m_sym->m_instrDef;
+    Assert(argInstr->m_opcode == Js::OpCode::ExtendArg_A);
+    Assert(argInstr->GetSrc2() == nullptr);
+    IR::Opnd *opOpnd = argInstr->GetSrc1()->Copy(m_func);
+
+    // The ExtendArg_A instructions are removed when they are lowered, keep their sources alive across the loop.
+    if (src2Opnd->IsRegOpnd())
+    {
+        this->addToLiveOnBackEdgeSyms->Set(src2Opnd->AsRegOpnd()->m_sym->m_id);
+    }
+    if (sizeOpnd->IsRegOpnd())
+    {
+        this->addToLiveOnBackEdgeSyms->Set(sizeOpnd->AsRegOpnd()->m_sym->m_id);
+    }
+
+    IR::Instr *instrPrev = nullptr;
+    if (src2Opnd->IsRegOpnd() && !src2Opnd->IsVar())
+    {
+        IR::RegOpnd* varOpnd = IR::RegOpnd::New(TyVar, instr->m_func);
+        instrPrev = IR::Instr::New(Js::OpCode::ToVar, varOpnd, src2Opnd, instr->m_func);
+        instr->InsertBefore(instrPrev);
+        src2Opnd = varOpnd;
+    }
+
+    instr->SetDst(helperRet);
+    LoadScriptContext(instr);
+    m_lowererMD.LoadHelperArgument(instr, opOpnd);
+    m_lowererMD.LoadHelperArgument(instr, sizeOpnd);
+    m_lowererMD.LoadHelperArgument(instr, src2Opnd);
+    m_lowererMD.LoadHelperArgument(instr, srcBaseOpnd);
+    m_lowererMD.LoadHelperArgument(instr, dstIndexOpnd);
+    m_lowererMD.LoadHelperArgument(instr, dstBaseOpnd);
+    m_lowererMD.ChangeToHelperCall(instr, IR::HelperOp_Memvector);
+    dst->Free(m_func);
+    src->Free(m_func);
+    linkOpnd->Free(m_func);
+
+    return instrPrev;
+}
+
 IR::Instr *
 Lowerer::LowerMemOp(IR::Instr * instr)
 {
-    Assert(instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy || instr->m_opcode == Js::OpCode::Memvector);
     IR::Instr *instrPrev = instr->m_prev;
 
     IR::RegOpnd* helperRet = IR::RegOpnd::New(TyInt8, instr->m_func);
@@ -8553,6 +8634,10 @@ Lowerer::LowerMemOp(IR::Instr * instr)
     {
         newInstrPrev = LowerMemcopy(instr, helperRet);
     }
+    else if (instr->m_opcode == Js::OpCode::Memvector)
+    {
+        newInstrPrev = LowerMemvector(instr, helperRet);
+    }
 
     if (newInstrPrev != nullptr)
     {
@@ -9580,7 +9665,7 @@ IR::Instr *Lowerer::LowerRestParameter(IR::Opnd *formalsOpnd, IR::Opnd *dstOpnd,
 
     LoadScriptContext(helperCallInstr);
 
-    BOOL isGenerator = this->m_func->GetJnFunction()->IsGenerator();
+    BOOL isGenerator = this->m_func->IsGeneratorFunc();
 
     // Elements pointer = ebp + (formals count + formals offset + 1)*sizeof(Var)
     IR::RegOpnd *srcOpnd = isGenerator ? generatorArgsPtrOpnd : IR::Opnd::CreateFramePointerOpnd(this->m_func);
@@ -9688,7 +9773,7 @@ Lowerer::LowerArgIn(IR::Instr *instrArgIn)
             // $createRestArray
             instrArgIn->InsertBefore(createRestArrayLabel);
 
-            if (m_func->GetJnFunction()->IsGenerator())
+            if (m_func->IsGeneratorFunc())
             {
                 generatorArgsPtrOpnd = LoadGeneratorArgsPtr(instrArgIn);
             }
@@ -9707,7 +9792,7 @@ Lowerer::LowerArgIn(IR::Instr *instrArgIn)
     if (argIndex == 1)
     {
         // The "this" argument is not source-dependent and doesn't need to be checked.
-        if (m_func->GetJnFunction()->IsGenerator())
+        if (m_func->IsGeneratorFunc())
         {
             generatorArgsPtrOpnd = LoadGeneratorArgsPtr(instrArgIn);
             ConvertArgOpndIfGeneratorFunction(instrArgIn, generatorArgsPtrOpnd);
@@ -9761,7 +9846,7 @@ Lowerer::LowerArgIn(IR::Instr *instrArgIn)
 
     // Now insert all the checks and undef-assigns.
 
-    if (m_func->GetJnFunction()->IsGenerator())
+    if (m_func->IsGeneratorFunc())
     {
         generatorArgsPtrOpnd = LoadGeneratorArgsPtr(instrInsert);
     }
@@ -9931,7 +10016,7 @@ Lowerer::LowerArgIn(IR::Instr *instrArgIn)
 void
 Lowerer::ConvertArgOpndIfGeneratorFunction(IR::Instr *instrArgIn, IR::RegOpnd *generatorArgsPtrOpnd)
 {
-    if (this->m_func->GetJnFunction()->IsGenerator())
+    if (this->m_func->IsGeneratorFunc())
     {
         // Replace stack param operand with offset into arguments array held by
         // the generator object.
@@ -10630,7 +10715,7 @@ Lowerer::LoadCallInfo(IR::Instr * instrInsert)
     IR::SymOpnd * srcOpnd;
     Func * func = instrInsert->m_func;
 
-    if (func->GetJnFunction()->IsGenerator())
+    if (func->IsGeneratorFunc())
     {
         // Generator function arguments and ArgumentsInfo are not on the stack.  Instead they
         // are accessed off the generator object (which is prm1).
@@ -17389,6 +17474,330 @@ Lowerer::GenerateFastInlineStringReplace(IR::Instr * instr)
     return true;
 }
 
+bool
+Lowerer::GenerateFastInlineMapMethod(IR::Instr * instr, IR::JnHelperMethod helperMethod, uint argCount)
+{
+    // map.get(key), map.has(key), map.set(key, value)
+    // When 'map' has the JavascriptMap vtable, call the runtime directly with the map and the arguments
+    // instead of going through the entry point. The vtable check doesn't tell which script context the map
+    // belongs to; the direct helpers use the map's own context:
+    //
+    //      test map, tag mask
+    //      jne $helper
+    //      cmp [map], JavascriptMap vtable
+    //      jne $helper
+    //      dst = CALL Map_DirectGet/Has/Set(map, key [, value])
+    //      jmp $done
+    //  $helper:
+    //      dst = CallDirect Map_Get/Has/Set
+    //  $done:
+
+    Assert(instr->m_opcode == Js::OpCode::CallDirect);
+    Assert(argCount <= 3);
+
+    IR::Opnd * argsOpnd[3] = {0};
+    bool result = instr->FetchOperands(argsOpnd, argCount);
+    Assert(result);
+    AnalysisAssert(argsOpnd[0] && argsOpnd[1]);
+
+    IR::Opnd * mapOpnd = argsOpnd[0];
+    if (mapOpnd->GetValueType().IsNotObject())
+    {
+        return false;
+    }
+
+    IR::LabelInstr *doneLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func);
+    instr->InsertAfter(doneLabel);
+
+    IR::LabelInstr *labelHelper = IR::LabelInstr::New(Js::OpCode::Label, this->m_func, true);
+
+    if (!mapOpnd->IsRegOpnd())
+    {
+        IR::RegOpnd *mapReg = IR::RegOpnd::New(TyVar, m_func);
+        LowererMD::CreateAssign(mapReg, mapOpnd, instr);
+        mapOpnd = mapReg;
+    }
+
+    if (!mapOpnd->IsNotTaggedValue())
+    {
+        m_lowererMD.GenerateObjectTest(mapOpnd, instr, labelHelper);
+    }
+
+    // cmp  [map], vtableAddress
+    // jne  $labelHelper
+    InsertCompareBranch(
+        IR::IndirOpnd::New(mapOpnd->AsRegOpnd(), 0, TyMachPtr, instr->m_func),
+        LoadVTableValueOpnd(instr, VTableValue::VtableJavascriptMap),
+        Js::OpCode::BrNeq_A,
+        labelHelper,
+        instr);
+
+    argsOpnd[0] = mapOpnd;
+    GenerateFastInlineDirectHelperCall(instr, helperMethod, argsOpnd, argCount, labelHelper, doneLabel);
+
+    return true;
+}
+
+bool
+Lowerer::GenerateFastInlineArrayIndexOf(IR::Instr * instr)
+{
+    // arr.indexOf(search)
+    // When 'arr' has the var, native int or native float array vtable, call the runtime directly instead of
+    // going through the entry point. A fromIndex argument takes the entry point. So does a call with bailout
+    // info: searching the missing values of an array looks them up on the prototype, which may make implicit
+    // calls, and only the helper path resets and checks the implicit call flags for BailOutOnImplicitCalls.
+    //
+    //      test arr, tag mask
+    //      jne $helper
+    //      cmp [arr], JavascriptArray vtable
+    //      je $fast
+    //      cmp [arr], JavascriptNativeIntArray vtable
+    //      je $fast
+    //      cmp [arr], JavascriptNativeFloatArray vtable
+    //      jne $helper
+    //  $fast:
+    //      dst = CALL Array_DirectIndexOf(arr, search)
+    //      jmp $done
+    //  $helper:
+    //      dst = CallDirect Array_IndexOf
+    //  $done:
+
+    Assert(instr->m_opcode == Js::OpCode::CallDirect);
+
+    if (instr->HasBailOutInfo())
+    {
+        return false;
+    }
+
+    IR::Opnd * argsOpnd[2] = {0};
+    if (!instr->FetchOperands(argsOpnd, 2))
+    {
+        return false;
+    }
+    AnalysisAssert(argsOpnd[0] && argsOpnd[1]);
+
+    if (!argsOpnd[0]->GetValueType().IsLikelyArray())
+    {
+        return false;
+    }
+
+    IR::LabelInstr *doneLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func);
+    instr->InsertAfter(doneLabel);
+
+    IR::LabelInstr *labelHelper = IR::LabelInstr::New(Js::OpCode::Label, this->m_func, true);
+    IR::LabelInstr *labelFast = IR::LabelInstr::New(Js::OpCode::Label, this->m_func);
+
+    if (!argsOpnd[0]->IsRegOpnd())
+    {
+        IR::RegOpnd *arrayReg = IR::RegOpnd::New(TyVar, m_func);
+        LowererMD::CreateAssign(arrayReg, argsOpnd[0], instr);
+        argsOpnd[0] = arrayReg;
+    }
+    IR::RegOpnd * arrayOpnd = argsOpnd[0]->AsRegOpnd();
+
+    if (!arrayOpnd->IsNotTaggedValue())
+    {
+        m_lowererMD.GenerateObjectTest(arrayOpnd, instr, labelHelper);
+    }
+
+    InsertCompareBranch(
+        IR::IndirOpnd::New(arrayOpnd, 0, TyMachPtr, instr->m_func),
+        LoadVTableValueOpnd(instr, VTableValue::VtableJavascriptArray),
+        Js::OpCode::BrEq_A,
+        labelFast,
+        instr);
+    InsertCompareBranch(
+        IR::IndirOpnd::New(arrayOpnd, 0, TyMachPtr, instr->m_func),
+        LoadVTableValueOpnd(instr, VTableValue::VtableJavascriptNativeIntArray),
+        Js::OpCode::BrEq_A,
+        labelFast,
+        instr);
+    InsertCompareBranch(
+        IR::IndirOpnd::New(arrayOpnd, 0, TyMachPtr, instr->m_func),
+        LoadVTableValueOpnd(instr, VTableValue::VtableNativeFloatArray),
+        Js::OpCode::BrNeq_A,
+        labelHelper,
+        instr);
+    instr->InsertBefore(labelFast);
+
+    GenerateFastInlineDirectHelperCall(instr, IR::HelperArray_DirectIndexOf, argsOpnd, 2, labelHelper, doneLabel);
+
+    return true;
+}
+
+bool
+Lowerer::GenerateFastInlineStringIndexOf(IR::Instr * instr)
+{
+    // str.indexOf(search [, position])
+    // When 'str' and 'search' are strings and 'position' is a tagged int, call the runtime directly instead
+    // of going through the entry point:
+    //
+    //      string test str
+    //      string test search
+    //      test position, tagged int
+    //      je $helper
+    //      dst = CALL String_DirectIndexOf(str, search, position or 0)
+    //      jmp $done
+    //  $helper:
+    //      dst = CallDirect String_IndexOf
+    //  $done:
+
+    Assert(instr->m_opcode == Js::OpCode::CallDirect);
+
+    IR::Opnd * argsOpnd[3] = {0};
+    uint argCount = 3;
+    if (!instr->FetchOperands(argsOpnd, argCount))
+    {
+        argCount = 2;
+        if (!instr->FetchOperands(argsOpnd, argCount))
+        {
+            return false;
+        }
+    }
+    AnalysisAssert(argsOpnd[0] && argsOpnd[1]);
+
+    if (!argsOpnd[0]->GetValueType().IsLikelyString()
+        || !argsOpnd[1]->GetValueType().IsLikelyString()
+        || (argCount == 3 && !argsOpnd[2]->GetValueType().IsLikelyInt()))
+    {
+        return false;
+    }
+
+    IR::LabelInstr *doneLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func);
+    instr->InsertAfter(doneLabel);
+
+    IR::LabelInstr *labelHelper = IR::LabelInstr::New(Js::OpCode::Label, this->m_func, true);
+
+    for (uint i = 0; i < 2; i++)
+    {
+        if (!argsOpnd[i]->IsRegOpnd())
+        {
+            IR::RegOpnd *opndReg = IR::RegOpnd::New(TyVar, m_func);
+            LowererMD::CreateAssign(opndReg, argsOpnd[i], instr);
+            argsOpnd[i] = opndReg;
+        }
+        this->GenerateStringTest(argsOpnd[i]->AsRegOpnd(), instr, labelHelper);
+    }
+
+    if (argCount == 3)
+    {
+        if (!argsOpnd[2]->IsTaggedInt())
+        {
+            this->m_lowererMD.GenerateSmIntTest(argsOpnd[2], instr, labelHelper);
+        }
+    }
+    else
+    {
+        argsOpnd[2] = IR::AddrOpnd::New(Js::TaggedInt::ToVarUnchecked(0), IR::AddrOpndKindConstantVar, m_func);
+    }
+
+    GenerateFastInlineDirectHelperCall(instr, IR::HelperString_DirectIndexOf, argsOpnd, 3, labelHelper, doneLabel);
+
+    return true;
+}
+
+bool
+Lowerer::GenerateFastInlineStringSlice(IR::Instr * instr)
+{
+    // str.slice(start [, end])
+    // When 'str' is a string and the indices are tagged ints, call the runtime directly instead of going
+    // through the entry point:
+    //
+    //      string test str
+    //      test start, tagged int
+    //      je $helper
+    //      test end, tagged int
+    //      je $helper
+    //      dst = CALL String_DirectSlice(str, start, end or undefined)
+    //      jmp $done
+    //  $helper:
+    //      dst = CallDirect String_Slice
+    //  $done:
+
+    Assert(instr->m_opcode == Js::OpCode::CallDirect);
+
+    IR::Opnd * argsOpnd[3] = {0};
+    uint argCount = 3;
+    if (!instr->FetchOperands(argsOpnd, argCount))
+    {
+        argCount = 2;
+        if (!instr->FetchOperands(argsOpnd, argCount))
+        {
+            return false;
+        }
+    }
+    AnalysisAssert(argsOpnd[0] && argsOpnd[1]);
+
+    if (!argsOpnd[0]->GetValueType().IsLikelyString()
+        || !argsOpnd[1]->GetValueType().IsLikelyInt()
+        || (argCount == 3 && !argsOpnd[2]->GetValueType().IsLikelyInt()))
+    {
+        return false;
+    }
+
+    IR::LabelInstr *doneLabel = IR::LabelInstr::New(Js::OpCode::Label, this->m_func);
+    instr->InsertAfter(doneLabel);
+
+    IR::LabelInstr *labelHelper = IR::LabelInstr::New(Js::OpCode::Label, this->m_func, true);
+
+    if (!argsOpnd[0]->IsRegOpnd())
+    {
+        IR::RegOpnd *opndReg = IR::RegOpnd::New(TyVar, m_func);
+        LowererMD::CreateAssign(opndReg, argsOpnd[0], instr);
+        argsOpnd[0] = opndReg;
+    }
+    this->GenerateStringTest(argsOpnd[0]->AsRegOpnd(), instr, labelHelper);
+
+    for (uint i = 1; i < argCount; i++)
+    {
+        if (!argsOpnd[i]->IsTaggedInt())
+        {
+            this->m_lowererMD.GenerateSmIntTest(argsOpnd[i], instr, labelHelper);
+        }
+    }
+
+    if (argCount == 2)
+    {
+        argsOpnd[2] = LoadLibraryValueOpnd(instr, LibraryValue::ValueUndefined);
+    }
+
+    GenerateFastInlineDirectHelperCall(instr, IR::HelperString_DirectSlice, argsOpnd, 3, labelHelper, doneLabel);
+
+    return true;
+}
+
+void
+Lowerer::GenerateFastInlineDirectHelperCall(IR::Instr * instr, IR::JnHelperMethod helperMethod, IR::Opnd ** argsOpnd, uint argCount,
+    IR::LabelInstr * labelHelper, IR::LabelInstr * doneLabel)
+{
+    // Emits the fast path call of a CallDirect whose arguments have been type checked, and moves the
+    // original call and its arguments to the helper path.
+
+    //CallDirect src2
+    IR::Opnd * linkOpnd = instr->GetSrc2();
+    //ArgOut_A_InlineSpecialized
+    IR::Instr * tmpInstr = linkOpnd->AsSymOpnd()->m_sym->AsStackSym()->m_instrDef;
+
+    // Helper arguments are pushed in reverse order
+    for (uint i = argCount; i > 0; i--)
+    {
+        this->m_lowererMD.LoadHelperArgument(instr, argsOpnd[i - 1]);
+    }
+
+    IR::Instr * helperCallInstr = IR::Instr::New(LowererMD::MDCallOpcode, instr->m_func);
+    if (instr->GetDst())
+    {
+        helperCallInstr->SetDst(instr->GetDst());
+    }
+    instr->InsertBefore(helperCallInstr);
+    m_lowererMD.ChangeToHelperCall(helperCallInstr, helperMethod);
+
+    instr->InsertBefore(labelHelper);
+    InsertBranch(Js::OpCode::Br, true, doneLabel, labelHelper);
+
+    RelocateCallDirectToHelperPath(tmpInstr, labelHelper);
+}
+
 #ifdef ENABLE_DOM_FAST_PATH
 /*
     Lower the DOMFastPathGetter opcode
@@ -18076,7 +18485,7 @@ IR::IndirOpnd*
 Lowerer::GetArgsIndirOpndForTopFunction(IR::Instr* ldElem, IR::Opnd* valueOpnd)
 {
     // Load argument set dst = [ebp + index] (or grab from the generator object if m_func is a generator function).
-    IR::RegOpnd *baseOpnd = m_func->GetJnFunction()->IsGenerator() ? LoadGeneratorArgsPtr(ldElem) : IR::Opnd::CreateFramePointerOpnd(m_func);
+    IR::RegOpnd *baseOpnd = m_func->IsGeneratorFunc() ? LoadGeneratorArgsPtr(ldElem) : IR::Opnd::CreateFramePointerOpnd(m_func);
     IR::IndirOpnd* argIndirOpnd = nullptr;
     // The stack looks like this:
     //       ...
@@ -18090,8 +18499,8 @@ Lowerer::GetArgsIndirOpndForTopFunction(IR::Instr* ldElem, IR::Opnd* valueOpnd)
 
     //actual arguments offset is LowererMD::GetFormalParamOffset() + 1 (this)
 
-    uint16 actualOffset = m_func->GetJnFunction()->IsGenerator() ? 1 : GetFormalParamOffset() + 1; //5
-    Assert(actualOffset == 5 || m_func->GetJnFunction()->IsGenerator());
+    uint16 actualOffset = m_func->IsGeneratorFunc() ? 1 : GetFormalParamOffset() + 1; //5
+    Assert(actualOffset == 5 || m_func->IsGeneratorFunc());
     if (valueOpnd->IsIntConstOpnd())
     {
         IntConstType offset = (valueOpnd->AsIntConstOpnd()->GetValue() + actualOffset) * MachPtr;
@@ -20324,7 +20733,7 @@ Lowerer::GenerateLoadNewTarget(IR::Instr* instrInsert)
 
     Assert(!func->IsInlinee());
 
-    if (func->GetJnFunction()->IsGenerator())
+    if (func->IsGeneratorFunc())
     {
         instrInsert->SetSrc1(opndUndefAddress);
         LowererMD::ChangeToAssign(instrInsert);
@@ -21059,7 +21468,7 @@ void Lowerer::GenerateNullOutGeneratorFrame(IR::Instr* insertInstr)
 
 void Lowerer::LowerFunctionExit(IR::Instr* funcExit)
 {
-    if (m_func->GetJnFunction()->IsGenerator())
+    if (m_func->IsGeneratorFunc())
     {
         GenerateNullOutGeneratorFrame(funcExit->m_prev);
     }
@@ -160,6 +160,7 @@ private:
     IR::Instr *     LowerMemOp(IR::Instr * instr);
     IR::Instr *     LowerMemset(IR::Instr * instr, IR::RegOpnd * helperRet);
     IR::Instr *     LowerMemcopy(IR::Instr * instr, IR::RegOpnd * helperRet);
+    IR::Instr *     LowerMemvector(IR::Instr * instr, IR::RegOpnd * helperRet);
 
     IR::Instr *     LowerLdArrViewElem(IR::Instr * instr);
     IR::Instr *     LowerStArrViewElem(IR::Instr * instr);
@@ -355,6 +356,11 @@ private:
     void            GenerateFastInlineStringCodePointAt(IR::Instr* doneLabel, Func* func, IR::Opnd *strLength, IR::Opnd *srcIndex, IR::RegOpnd *lowerChar, IR::RegOpnd *strPtr);
     bool            GenerateFastInlineStringCharCodeAt(IR::Instr* instr, Js::BuiltinFunction index);
     bool            GenerateFastInlineStringReplace(IR::Instr* instr);
+    bool            GenerateFastInlineMapMethod(IR::Instr* instr, IR::JnHelperMethod helperMethod, uint argCount);
+    bool            GenerateFastInlineArrayIndexOf(IR::Instr* instr);
+    bool            GenerateFastInlineStringIndexOf(IR::Instr* instr);
+    bool            GenerateFastInlineStringSlice(IR::Instr* instr);
+    void            GenerateFastInlineDirectHelperCall(IR::Instr* instr, IR::JnHelperMethod helperMethod, IR::Opnd** argsOpnd, uint argCount, IR::LabelInstr* labelHelper, IR::LabelInstr* doneLabel);
     void            GenerateFastInlineArrayPush(IR::Instr * instr);
     void            GenerateFastInlineArrayPop(IR::Instr * instr);
     void            GenerateFastInlineStringSplitMatch(IR::Instr * instr);
@@ -1638,7 +1638,10 @@ LowererMD::Legalize(IR::Instr *const instr, bool fPostRegAlloc)
         case Js::OpCode::PUNPCKLDQ:
         case Js::OpCode::PUNPCKLWD:
 
-            MakeDstEquSrc1<verify>(instr);
+            if (verify || !TryChangeToVexForm(instr))
+            {
+                MakeDstEquSrc1<verify>(instr);
+            }
             LegalizeOpnds<verify>(
                 instr,
                 L_Reg,
@@ -1646,6 +1649,32 @@ LowererMD::Legalize(IR::Instr *const instr, bool fPostRegAlloc)
                 L_Reg | L_Mem);
             break;
 
+#ifdef _M_X64
+        case Js::OpCode::VADDPD:
+        case Js::OpCode::VADDPS:
+        case Js::OpCode::VADDSD:
+        case Js::OpCode::VADDSS:
+        case Js::OpCode::VDIVPD:
+        case Js::OpCode::VDIVPS:
+        case Js::OpCode::VDIVSD:
+        case Js::OpCode::VDIVSS:
+        case Js::OpCode::VMULPD:
+        case Js::OpCode::VMULPS:
+        case Js::OpCode::VMULSD:
+        case Js::OpCode::VMULSS:
+        case Js::OpCode::VSUBPD:
+        case Js::OpCode::VSUBPS:
+        case Js::OpCode::VSUBSD:
+        case Js::OpCode::VSUBSS:
+            Assert(AutoSystemInfo::Data.AVXAvailable());
+            LegalizeOpnds<verify>(
+                instr,
+                L_Reg,
+                L_Reg,
+                L_Reg | L_Mem);
+            break;
+#endif
+
         case Js::OpCode::SHL:
         case Js::OpCode::SHR:
         case Js::OpCode::SAR:
@@ -2041,6 +2070,51 @@ template void LowererMD::LegalizeOpnds<true>(IR::Instr *const instr, const uint
 template void LowererMD::LegalizeDst<true>(IR::Instr *const instr, const uint forms);
 template void LowererMD::LegalizeSrc<true>(IR::Instr *const instr, IR::Opnd *src, const uint forms);
 template void LowererMD::MakeDstEquSrc1<true>(IR::Instr *const instr);
+
+// With AVX, float arithmetic uses the VEX encoded 3-operand forms on x64. These don't overwrite
+// src1, so the copy MakeDstEquSrc1 would insert for (a = b op c) is not needed.
+bool
+LowererMD::TryChangeToVexForm(IR::Instr *const instr)
+{
+#ifdef _M_X64
+    Assert(instr);
+    Assert(instr->IsLowered());
+    Assert(instr->GetDst());
+    Assert(instr->GetSrc1());
+
+    if (instr->GetDst()->IsEqual(instr->GetSrc1()) ||
+        !AutoSystemInfo::Data.AVXAvailable() ||
+        PHASE_OFF(Js::AvxPhase, instr->m_func))
+    {
+        return false;
+    }
+
+    switch (instr->m_opcode)
+    {
+    case Js::OpCode::ADDPD: instr->m_opcode = Js::OpCode::VADDPD; break;
+    case Js::OpCode::ADDPS: instr->m_opcode = Js::OpCode::VADDPS; break;
+    case Js::OpCode::ADDSD: instr->m_opcode = Js::OpCode::VADDSD; break;
+    case Js::OpCode::ADDSS: instr->m_opcode = Js::OpCode::VADDSS; break;
+    case Js::OpCode::DIVPD: instr->m_opcode = Js::OpCode::VDIVPD; break;
+    case Js::OpCode::DIVPS: instr->m_opcode = Js::OpCode::VDIVPS; break;
+    case Js::OpCode::DIVSD: instr->m_opcode = Js::OpCode::VDIVSD; break;
+    case Js::OpCode::DIVSS: instr->m_opcode = Js::OpCode::VDIVSS; break;
+    case Js::OpCode::MULPD: instr->m_opcode = Js::OpCode::VMULPD; break;
+    case Js::OpCode::MULPS: instr->m_opcode = Js::OpCode::VMULPS; break;
+    case Js::OpCode::MULSD: instr->m_opcode = Js::OpCode::VMULSD; break;
+    case Js::OpCode::MULSS: instr->m_opcode = Js::OpCode::VMULSS; break;
+    case Js::OpCode::SUBPD: instr->m_opcode = Js::OpCode::VSUBPD; break;
+    case Js::OpCode::SUBPS: instr->m_opcode = Js::OpCode::VSUBPS; break;
+    case Js::OpCode::SUBSD: instr->m_opcode = Js::OpCode::VSUBSD; break;
+    case Js::OpCode::SUBSS: instr->m_opcode = Js::OpCode::VSUBSS; break;
+    default:
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
 #endif
 
 IR::Instr *
@@ -8520,7 +8594,10 @@ LowererMD::LowerToFloat(IR::Instr *instr)
         Assume(UNREACHED);
     }
 
-    this->MakeDstEquSrc1(instr);
+    if (!TryChangeToVexForm(instr))
+    {
+        this->MakeDstEquSrc1(instr);
+    }
 
     return instr;
 }
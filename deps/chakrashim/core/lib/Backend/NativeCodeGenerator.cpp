@@ -516,6 +516,9 @@ NativeCodeGenerator::GenerateFunction(Js::FunctionBody *fn, Js::ScriptFunction *
         return false;
     }
 
+    // The JIT thread only updates telemetry, so allocate it here
+    fn->EnsureJitTelemetry();
+
     // Create a work item with null entry point- we'll set it once its allocated
     AutoPtr<JsFunctionCodeGen> workItemAutoPtr(this->NewFunctionCodeGen(fn, nullptr));
     if ((JsFunctionCodeGen*) workItemAutoPtr == nullptr)
@@ -645,6 +648,7 @@ void NativeCodeGenerator::GenerateLoopBody(Js::FunctionBody * fn, Js::LoopHeader
         loopEntryPointInfo->SetIsAsmJSFunction(true);
         loopEntryPointInfo->SetModuleAddress(functionEntryPointInfo->GetModuleAddress());
     }
+    fn->EnsureJitTelemetry();
     JsLoopBodyCodeGen * workitem = this->NewLoopBodyCodeGen(fn, entryPoint);
     if (!workitem)
     {
@@ -870,6 +874,8 @@ NativeCodeGenerator::CodeGen(PageAllocator * pageAllocator, CodeGenWorkItem* wor
     ThreadContext *threadContext = scriptContext->GetThreadContext();
     double startTime = threadContext->JITTelemetry.Now();
 #endif
+    LARGE_INTEGER codeGenStartTime;
+    QueryPerformanceCounter(&codeGenStartTime);
 
     do
     {
@@ -964,6 +970,12 @@ NativeCodeGenerator::CodeGen(PageAllocator * pageAllocator, CodeGenWorkItem* wor
                     ex.ReasonName());
             }
 
+            Js::FunctionJitTelemetry *const jitTelemetry = body->GetJitTelemetryWithLock();
+            if (jitTelemetry != nullptr)
+            {
+                jitTelemetry->LogRejit();
+            }
+
             rejit = true;
             funcAlloc.Reset();
             if(!foreground)
@@ -989,6 +1001,19 @@ NativeCodeGenerator::CodeGen(PageAllocator * pageAllocator, CodeGenWorkItem* wor
     threadContext->JITTelemetry.LogTime(threadContext->JITTelemetry.Now() - startTime);
 #endif
 
+    Js::FunctionJitTelemetry *const jitTelemetry = body->GetJitTelemetryWithLock();
+    if (jitTelemetry != nullptr)
+    {
+        LARGE_INTEGER codeGenEndTime;
+        LARGE_INTEGER frequency;
+        QueryPerformanceCounter(&codeGenEndTime);
+        QueryPerformanceFrequency(&frequency);
+        jitTelemetry->LogCodeGen(
+            workItem->GetJitMode(),
+            workItem->Type() == JsLoopBodyWorkItemType,
+            (codeGenEndTime.QuadPart - codeGenStartTime.QuadPart) * 1000000 / frequency.QuadPart);
+    }
+
 #ifdef BGJIT_STATS
     // Must be interlocked because the following data may be modified from the background and foreground threads concurrently
     Js::ScriptContext *scriptContext = workItem->GetScriptContext();
@@ -2217,12 +2242,18 @@ NativeCodeGenerator::GatherCodeGenData(
             //Try and see if this polymorphic call
             Js::FunctionBody* inlineeFunctionBodyArray[Js::DynamicProfileInfo::maxPolymorphicInliningSize] = {0};
             bool canInlineArray[Js::DynamicProfileInfo::maxPolymorphicInliningSize] = { 0 };
+            bool hasFallbackCall;
             uint polyInlineeCount = inliningDecider.InlinePolymorphicCallSite(functionBody, profiledCallSiteId, inlineeFunctionBodyArray,
-                Js::DynamicProfileInfo::maxPolymorphicInliningSize, canInlineArray);
+                Js::DynamicProfileInfo::maxPolymorphicInliningSize, canInlineArray, &hasFallbackCall);
 
             //We should be able to inline at least two functions here.
             if (polyInlineeCount >= 2)
             {
+                if (hasFallbackCall && !isJitTimeDataComputed)
+                {
+                    jitTimeData->SetHasPolymorphicCallFallback(recycler, profiledCallSiteId);
+                }
+
                 for (uint id = 0; id < polyInlineeCount; id++)
                 {
                     bool isInlined = canInlineArray[id];
@@ -2749,6 +2780,15 @@ void NativeCodeGenerator::FreeLoopBodyJobManager::QueueFreeLoopBodyJob(void* cod
 {
     Assert(!this->isClosed);
 
+    {
+        AutoOptionalCriticalSection lock(Processor()->GetCriticalSection());
+        if (this->queuedJob != nullptr && this->queuedJob->codeAddressCount < FreeLoopBodyJob::MaxCodeAddressCount)
+        {
+            this->queuedJob->codeAddresses[this->queuedJob->codeAddressCount++] = codeAddress;
+            return;
+        }
+    }
+
     FreeLoopBodyJob* job = HeapNewNoThrow(FreeLoopBodyJob, this, codeAddress);
 
     if (job == nullptr)
@@ -2768,6 +2808,10 @@ void NativeCodeGenerator::FreeLoopBodyJobManager::QueueFreeLoopBodyJob(void* cod
         AutoOptionalCriticalSection lock(Processor()->GetCriticalSection());
         if (Processor()->HasManager(this))
         {
+            if (Processor()->ProcessesInBackground())
+            {
+                this->queuedJob = job;
+            }
             Processor()->AddJobAndProcessProactively<FreeLoopBodyJobManager, FreeLoopBodyJob*>(this, job);
         }
         else
@@ -3110,11 +3154,12 @@ bool NativeCodeGenerator::TryAggressiveInlining(Js::FunctionBody *const topFunct
                 //Try and see if this polymorphic call
                 Js::FunctionBody* inlineeFunctionBodyArray[Js::DynamicProfileInfo::maxPolymorphicInliningSize] = { 0 };
                 bool canInlineArray[Js::DynamicProfileInfo::maxPolymorphicInliningSize] = { 0 };
+                bool hasFallbackCall;
                 uint polyInlineeCount = inliningDecider.InlinePolymorphicCallSite(inlineeFunctionBody, profiledCallSiteId, inlineeFunctionBodyArray,
-                    Js::DynamicProfileInfo::maxPolymorphicInliningSize, canInlineArray);
+                    Js::DynamicProfileInfo::maxPolymorphicInliningSize, canInlineArray, &hasFallbackCall);
 
                 //We should be able to inline everything here.
-                if (polyInlineeCount >= 2)
+                if (polyInlineeCount >= 2 && !hasFallbackCall)
                 {
                     for (uint i = 0; i < polyInlineeCount; i++)
                     {
@@ -193,15 +193,20 @@ private:
     class FreeLoopBodyJob: public JsUtil::Job
     {
     public:
+        // Loop bodies freed while the job is waiting to be processed are added to it, up to this many
+        static const uint MaxCodeAddressCount = 32;
+
         FreeLoopBodyJob(JsUtil::JobManager *const manager, void* address, bool isHeapAllocated = true):
           JsUtil::Job(manager),
-          codeAddress(address),
-          heapAllocated(isHeapAllocated)
+          heapAllocated(isHeapAllocated),
+          codeAddressCount(1)
         {
+            codeAddresses[0] = address;
         }
 
         bool heapAllocated;
-        void* codeAddress;
+        uint codeAddressCount;
+        void* codeAddresses[MaxCodeAddressCount];
     };
 
     class FreeLoopBodyJobManager sealed: public WaitableJobManager
@@ -213,6 +218,7 @@ private:
             , isClosed(false)
             , stackJobProcessed(false)
             , waitingForStackJob(false)
+            , queuedJob(nullptr)
         {
             Processor()->AddManager(this);
         }
@@ -268,8 +274,20 @@ private:
         {
             FreeLoopBodyJob* freeLoopBodyJob = static_cast<FreeLoopBodyJob*>(job);
 
-            // Free Loop Body
-            nativeCodeGen->FreeNativeCodeGenAllocation(freeLoopBodyJob->codeAddress);
+            // Stop adding loop bodies to the job once it's being processed
+            {
+                AutoOptionalCriticalSection lock(Processor()->GetCriticalSection());
+                if (this->queuedJob == freeLoopBodyJob)
+                {
+                    this->queuedJob = nullptr;
+                }
+            }
+
+            // Free Loop Bodies
+            for (uint i = 0; i < freeLoopBodyJob->codeAddressCount; i++)
+            {
+                nativeCodeGen->FreeNativeCodeGenAllocation(freeLoopBodyJob->codeAddresses[i]);
+            }
 
             return true;
         }
@@ -278,6 +296,12 @@ private:
         {
             FreeLoopBodyJob* freeLoopBodyJob = static_cast<FreeLoopBodyJob*>(job);
 
+            // Jobs that are removed with the manager are never processed
+            if (this->queuedJob == freeLoopBodyJob)
+            {
+                this->queuedJob = nullptr;
+            }
+
             if (freeLoopBodyJob->heapAllocated)
             {
                 HeapDelete(freeLoopBodyJob);
@@ -297,6 +321,7 @@ private:
         bool isClosed;
         bool stackJobProcessed;
         bool waitingForStackJob;
+        FreeLoopBodyJob* queuedJob;         // Background job that hasn't started yet, loop bodies freed meanwhile are added to it
     };
 
     FreeLoopBodyJobManager freeLoopBodyManager;
@@ -593,6 +593,11 @@ EncoderMD::Encode(IR::Instr *instr, BYTE *pc, BYTE* beginCodeAddress)
     const uint32 leadIn = EncoderMD::GetLeadIn(instr);
     uint32 opdope = EncoderMD::GetOpdope(instr);
 
+    if (opdope & DVEX)
+    {
+        return this->EncodeVex(instr, leadIn, opdope);
+    }
+
     //
     // Canonicalize operands.
     //
@@ -1339,6 +1344,101 @@ EncoderMD::Encode(IR::Instr *instr, BYTE *pc, BYTE* beginCodeAddress)
     }
 }
 
+///----------------------------------------------------------------------------
+///
+/// EncoderMD::EncodeVex
+///
+///     Emit a VEX encoded 3-operand instruction (dst = src1 op src2). dst goes
+///     in ModRM.reg, src1 in VEX.vvvv and src2 in ModRM.r/m. Only the 128-bit
+///     forms (VEX.L = 0) are emitted, so the upper YMM state is never dirtied
+///     and mixing with legacy SSE code carries no transition penalty.
+///
+///----------------------------------------------------------------------------
+
+ptrdiff_t
+EncoderMD::EncodeVex(IR::Instr *instr, uint32 leadIn, uint32 opdope)
+{
+    IR::Opnd *dst = instr->GetDst();
+    IR::Opnd *src1 = instr->GetSrc1();
+    IR::Opnd *src2 = instr->GetSrc2();
+    BYTE *instrStart = m_pc;
+
+    AssertMsg(dst->IsRegOpnd() && src1->IsRegOpnd(), "VEX forms expect register dst and src1");
+    AssertMsg(src2 && !src2->IsImmediateOpnd(), "VEX forms expect a reg/mem src2");
+    Assert(leadIn == OLB_0F);
+    Assert((opdope & (DOPEQ | DSSE)) == 0);
+
+    // Reserve room for the 3-byte prefix. The 2-byte form is used when REX.X and REX.B
+    // are not needed, in which case the opcode and ModRM are moved down by one byte below.
+    BYTE *pvex = m_pc;
+    m_pc += 3;
+    *(m_pc++) = *EncoderMD::GetOpbyte(instr);
+
+    BYTE rexByte = this->GetRexByte(this->REXR, dst);
+    rexByte |= this->EmitModRM(instr, src2, this->GetRegEncode(dst->AsRegOpnd()));
+
+    RegNum src1Reg = src1->AsRegOpnd()->GetReg();
+    BYTE vvvv = (this->GetRegEncode(src1Reg) & 7) | (this->IsExtendedRegister(src1Reg) ? 8 : 0);
+
+    // VEX.pp is the implied legacy prefix
+    BYTE pp = 0;
+    if (opdope & D66)
+    {
+        pp = 1;
+    }
+    else if (opdope & DF3)
+    {
+        pp = 2;
+    }
+    else if (opdope & DF2)
+    {
+        pp = 3;
+    }
+
+    // R, X, B and vvvv are stored inverted. VEX.L = 0 selects the 128-bit form.
+    BYTE lastByte = (BYTE)(((~vvvv & 0xF) << 3) | pp);
+    BYTE invR = (rexByte & this->REXR) ? 0 : 0x80;
+
+    if ((rexByte & (this->REXX | this->REXB)) == 0)
+    {
+        BYTE* current = pvex + 2;
+        while (current < m_pc - 1)
+        {
+            *current = *(current + 1);
+            current++;
+        }
+        m_pc--;
+
+        if (m_relocList != nullptr && m_relocList->Count() > 0)
+        {
+            // if a reloc record was added as part of encoding this instruction - fix the pc in the reloc
+            EncodeRelocAndLabels &lastRelocEntry = m_relocList->Item(m_relocList->Count() - 1);
+            if (lastRelocEntry.m_ptr > pvex && lastRelocEntry.m_ptr <= m_pc)
+            {
+                Assert(lastRelocEntry.m_type != RelocTypeLabel);
+                lastRelocEntry.m_ptr = (BYTE*)lastRelocEntry.m_ptr - 1;
+                lastRelocEntry.m_origPtr = (BYTE*)lastRelocEntry.m_origPtr - 1;
+            }
+        }
+
+        pvex[0] = 0xC5;
+        pvex[1] = invR | lastByte;
+    }
+    else
+    {
+        // mmmmm = 00001 selects the 0F opcode map; VEX.W is ignored by these instructions.
+        pvex[0] = 0xC4;
+        pvex[1] = invR |
+            ((rexByte & this->REXX) ? 0 : 0x40) |
+            ((rexByte & this->REXB) ? 0 : 0x20) |
+            0x01;
+        pvex[2] = lastByte;
+    }
+
+    AssertMsg(m_pc - instrStart <= MachMaxInstrSize, "MachMaxInstrSize not set correctly");
+    return m_pc - instrStart;
+}
+
 void
 EncoderMD::EmitRexByte(BYTE * prexByte, BYTE rexByte, bool skipRexByte, bool reservedRexByte)
 {
@@ -212,6 +212,7 @@ private:
     BYTE            GetRexByte(BYTE rexCode, RegNum reg);
     int             GetOpndSize(IR::Opnd * opnd);
 
+    ptrdiff_t       EncodeVex(IR::Instr * instr, uint32 leadIn, uint32 opdope);
     void            EmitRexByte(BYTE * prexByte, BYTE rexByte, bool skipRexByte, bool reservedRexByte);
 
     enum
@@ -258,6 +258,24 @@ MACRO(SUBSS,    Reg3,   None,          RNON,   f(MODRM),   o(SUBSS),   DNO16|DOP
 MACRO(TEST,     Empty,  OpSideEffect,  R000,   f(TEST),    o(TEST),    DSETCC|DCOMMOP,              OLB_NONE)
 MACRO(UCOMISD,  Empty,  None,          RNON,   f(MODRM),   o(UCOMISD), DNO16|D66|DSETCC,            OLB_0F)
 MACRO(UCOMISS,  Empty,  None,          RNON,   f(MODRM),   o(UCOMISS), DNO16|DSETCC,                OLB_0F)
+
+// AVX non-destructive forms: dst = src1 op src2, with src1 encoded in VEX.vvvv
+MACRO(VADDPD,   Reg3,   None,          RNON,   f(MODRM),   o(ADDPD),   DNO16|DVEX|D66|DCOMMOP,      OLB_0F)
+MACRO(VADDPS,   Reg3,   None,          RNON,   f(MODRM),   o(ADDPS),   DNO16|DVEX|DCOMMOP,          OLB_0F)
+MACRO(VADDSD,   Reg3,   None,          RNON,   f(MODRM),   o(ADDSD),   DNO16|DVEX|DF2|DCOMMOP,      OLB_0F)
+MACRO(VADDSS,   Reg3,   None,          RNON,   f(MODRM),   o(ADDSS),   DNO16|DVEX|DF3|DCOMMOP,      OLB_0F)
+MACRO(VDIVPD,   Reg3,   None,          RNON,   f(MODRM),   o(DIVPD),   DNO16|DVEX|D66,              OLB_0F)
+MACRO(VDIVPS,   Reg3,   None,          RNON,   f(MODRM),   o(DIVPS),   DNO16|DVEX,                  OLB_0F)
+MACRO(VDIVSD,   Reg3,   None,          RNON,   f(MODRM),   o(DIVSD),   DNO16|DVEX|DF2,              OLB_0F)
+MACRO(VDIVSS,   Reg3,   None,          RNON,   f(MODRM),   o(DIVSS),   DNO16|DVEX|DF3,              OLB_0F)
+MACRO(VMULPD,   Reg3,   None,          RNON,   f(MODRM),   o(MULPD),   DNO16|DVEX|D66|DCOMMOP,      OLB_0F)
+MACRO(VMULPS,   Reg3,   None,          RNON,   f(MODRM),   o(MULPS),   DNO16|DVEX|DCOMMOP,          OLB_0F)
+MACRO(VMULSD,   Reg3,   None,          RNON,   f(MODRM),   o(MULSD),   DNO16|DVEX|DF2|DCOMMOP,      OLB_0F)
+MACRO(VMULSS,   Reg3,   None,          RNON,   f(MODRM),   o(MULSS),   DNO16|DVEX|DF3|DCOMMOP,      OLB_0F)
+MACRO(VSUBPD,   Reg3,   None,          RNON,   f(MODRM),   o(SUBPD),   DNO16|DVEX|D66,              OLB_0F)
+MACRO(VSUBPS,   Reg3,   None,          RNON,   f(MODRM),   o(SUBPS),   DNO16|DVEX,                  OLB_0F)
+MACRO(VSUBSD,   Reg3,   None,          RNON,   f(MODRM),   o(SUBSD),   DNO16|DVEX|DF2,              OLB_0F)
+MACRO(VSUBSS,   Reg3,   None,          RNON,   f(MODRM),   o(SUBSS),   DNO16|DVEX|DF3,              OLB_0F)
 MACRO(XCHG,     Reg2,   None,          R000,   f(XCHG),    o(XCHG),    DOPEQ,                       OLB_NONE)
 MACRO(XOR,      Reg2,   OpSideEffect,  R110,   f(BINOP),   o(XOR),     DOPEQ|DSETCC|DCOMMOP,        OLB_NONE)
 MACRO(XORPS,    Reg3,   None,          RNON,   f(MODRM),   o(XORPS),   DNO16|DOPEQ|DCOMMOP,         OLB_0F)
@@ -1990,7 +1990,7 @@ LowererMD::Init(Lowerer *lowerer)
 IR::Instr *
 LowererMD::LoadInputParamPtr(IR::Instr * instrInsert, IR::RegOpnd * optionalDstOpnd /* = nullptr */)
 {
-    if (this->m_func->GetJnFunction()->IsGenerator())
+    if (this->m_func->IsGeneratorFunc())
     {
         IR::RegOpnd * argPtrRegOpnd = Lowerer::LoadGeneratorArgsPtr(instrInsert);
         IR::IndirOpnd * indirOpnd = IR::IndirOpnd::New(argPtrRegOpnd, 1 * MachPtr, TyMachPtr, this->m_func);
@@ -2084,7 +2084,7 @@ LowererMD::LoadStackArgPtr(IR::Instr * instr)
         instr->SetSrc1(tmpOpnd);
         instr->SetSrc2(IR::IntConstOpnd::New(sizeof(Js::Var), TyMachReg, this->m_func));
     }
-    else if (this->m_func->GetJnFunction()->IsGenerator())
+    else if (this->m_func->IsGeneratorFunc())
     {
         IR::Instr *instr2 = LoadInputParamPtr(instr, instr->UnlinkDst()->AsRegOpnd());
         instr->Remove();
@@ -2271,7 +2271,7 @@ LowererMD::LoadHeapArguments(IR::Instr * instrArgs, bool force /* = false */, IR
 IR::Instr *
 LowererMD::LoadHeapArgsCached(IR::Instr * instrArgs)
 {
-    Assert(!this->m_func->GetJnFunction()->IsGenerator());
+    Assert(!this->m_func->IsGeneratorFunc());
     ASSERT_INLINEE_FUNC(instrArgs);
     Func *func = instrArgs->m_func;
     IR::Instr * instrPrev = instrArgs->m_prev;
@@ -2383,6 +2383,19 @@ LowererMD::LoadFuncExpression(IR::Instr * instrFuncExpr)
         StackSym * paramSym = GetImplicitParamSlotSym(0);
         paramOpnd = IR::SymOpnd::New(paramSym, TyMachReg, this->m_func);
     }
+
+    if (func->GetJnFunction()->IsGenerator())
+    {
+        // the function object for generator calls is a GeneratorVirtualScriptFunction object
+        // and we need to return the real JavascriptGeneratorFunction object so grab it before
+        // assigning to the dst. Loop bodies of a generator are passed the same object by the
+        // interpreter, so they unwrap it too.
+        IR::RegOpnd *tmpOpnd = IR::RegOpnd::New(TyMachReg, func);
+        LowererMD::CreateAssign(tmpOpnd, paramOpnd, instrFuncExpr);
+
+        paramOpnd = IR::IndirOpnd::New(tmpOpnd, Js::GeneratorVirtualScriptFunction::GetRealFunctionOffset(), TyMachPtr, func);
+    }
+
     instrFuncExpr->SetSrc1(paramOpnd);
     this->ChangeToAssign(instrFuncExpr);
     return instrFuncExpr;
@@ -137,7 +137,7 @@ LowererMDArch::Init(LowererMD *lowererMD)
 IR::Instr *
 LowererMDArch::LoadInputParamPtr(IR::Instr *instrInsert, IR::RegOpnd *optionalDstOpnd /* = nullptr */)
 {
-    if (this->m_func->GetJnFunction()->IsGenerator())
+    if (this->m_func->IsGeneratorFunc())
     {
         IR::RegOpnd * argPtrRegOpnd = Lowerer::LoadGeneratorArgsPtr(instrInsert);
         IR::IndirOpnd * indirOpnd = IR::IndirOpnd::New(argPtrRegOpnd, 1 * MachPtr, TyMachPtr, this->m_func);
@@ -334,7 +334,7 @@ LowererMDArch::LoadHeapArguments(IR::Instr *instrArgs, bool force, IR::Opnd* opn
             this->m_func->SetArgOffset(paramSym, 2 * MachPtr);
             IR::Opnd *srcOpnd = IR::SymOpnd::New(paramSym, TyMachReg, func);
 
-            if (this->m_func->GetJnFunction()->IsGenerator())
+            if (this->m_func->IsGeneratorFunc())
             {
                 // the function object for generator calls is a GeneratorVirtualScriptFunction object
                 // and we need to pass the real JavascriptGeneratorFunction object so grab it instead
@@ -505,7 +505,8 @@ LowererMDArch::LoadFuncExpression(IR::Instr *instrFuncExpr)
     {
         // the function object for generator calls is a GeneratorVirtualScriptFunction object
         // and we need to return the real JavascriptGeneratorFunction object so grab it before
-        // assigning to the dst
+        // assigning to the dst. Loop bodies of a generator are passed the same object by the
+        // interpreter, so they unwrap it too.
         IR::RegOpnd *tmpOpnd = IR::RegOpnd::New(TyMachReg, func);
         LowererMD::CreateAssign(tmpOpnd, paramOpnd, instrFuncExpr);
 
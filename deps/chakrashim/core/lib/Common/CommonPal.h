@@ -62,6 +62,8 @@ typedef wchar_t char16;
 #define INIT_PRIORITY(x)
 
 #define get_cpuid __cpuid
+#define get_cpuidex __cpuidex
+#define get_xcr0() _xgetbv(0)
 
 #if defined(__clang__)
 __forceinline void  __int2c()
@@ -109,6 +111,24 @@ inline int get_cpuid(int cpuInfo[4], int function_id)
             reinterpret_cast<unsigned int*>(&cpuInfo[3]));
 }
 
+inline void get_cpuidex(int cpuInfo[4], int function_id, int subfunction_id)
+{
+    __cpuid_count(
+            static_cast<unsigned int>(function_id),
+            static_cast<unsigned int>(subfunction_id),
+            reinterpret_cast<unsigned int&>(cpuInfo[0]),
+            reinterpret_cast<unsigned int&>(cpuInfo[1]),
+            reinterpret_cast<unsigned int&>(cpuInfo[2]),
+            reinterpret_cast<unsigned int&>(cpuInfo[3]));
+}
+
+inline unsigned __int64 get_xcr0()
+{
+    unsigned int eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((unsigned __int64)edx << 32) | eax;
+}
+
 inline void DebugBreak()
 {
     __builtin_trap();
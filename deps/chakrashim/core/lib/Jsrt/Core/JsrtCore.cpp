@@ -7,6 +7,9 @@
 #include "jsrtHelper.h"
 #include "JsrtContextCore.h"
 #include "chakracore.h"
+#ifdef PERF_JIT_PROFILING
+#include "Base/PerfJitProfile.h"
+#endif
 
 CHAKRA_API
 JsInitializeModuleRecord(
@@ -209,3 +212,742 @@ JsGetModuleHostInfo(
     });
     return errorCode;
 }
+
+CHAKRA_API
+JsCopyStringUtf8(
+    _In_ JsValueRef stringValue,
+    _Out_writes_bytes_opt_(bufferSize) char* buffer,
+    _In_ size_t bufferSize,
+    _In_ bool replaceUnpairedSurrogates,
+    _Out_opt_ size_t* written,
+    _Out_opt_ size_t* charsWritten)
+{
+    VALIDATE_JSREF(stringValue);
+    if (written != nullptr)
+    {
+        *written = 0;
+    }
+    if (charsWritten != nullptr)
+    {
+        *charsWritten = 0;
+    }
+
+    if (!Js::JavascriptString::Is(stringValue))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        Js::JavascriptString *jsString = Js::JavascriptString::FromVar(stringValue);
+        Js::ScriptContext *scriptContext = jsString->GetScriptContext();
+
+        size_t byteCount = 0;
+        size_t charCount = 0;
+        bool isFull = false;
+
+        // Writes one code point made of 'units' UTF-16 code units, unless it doesn't fit
+        auto write = [&](codepoint_t codePoint, char16 high, char16 low, size_t units) -> bool
+        {
+            const size_t size = codePoint < 0x80 ? 1 : codePoint < 0x800 ? 2 : codePoint < 0x10000 ? 3 : 4;
+            if (buffer != nullptr)
+            {
+                if (bufferSize - byteCount < size)
+                {
+                    isFull = true;
+                    return false;
+                }
+
+                LPUTF8 dest = reinterpret_cast<LPUTF8>(buffer + byteCount);
+                if (size == 1)
+                {
+                    *dest = static_cast<utf8char_t>(codePoint);
+                }
+                else if (units == 2)
+                {
+                    utf8::EncodeSurrogatePair(high, low, dest);
+                }
+                else
+                {
+                    utf8::EncodeFull(static_cast<char16>(codePoint), dest);
+                }
+            }
+            byteCount += size;
+            charCount += units;
+            return true;
+        };
+
+        BEGIN_TEMP_ALLOCATOR(tempAllocator, scriptContext, _u("JsCopyStringUtf8"));
+        {
+            Js::StringPieceReader reader(jsString, tempAllocator);
+            const char16 *chars;
+            charcount_t length;
+
+            auto unpaired = [&](char16 surrogate) -> codepoint_t
+            {
+                return replaceUnpairedSurrogates ? UNICODE_UNKNOWN_CHAR_MARK : surrogate;
+            };
+
+            // A high surrogate at the end of a piece may be paired with a low surrogate at the start of the next one
+            char16 pendingHigh = 0;
+            while (!isFull && reader.Read(&chars, &length))
+            {
+                for (charcount_t i = 0; i < length; i++)
+                {
+                    const char16 ch = chars[i];
+                    if (pendingHigh != 0)
+                    {
+                        if (Js::NumberUtilities::IsSurrogateLowerPart(ch))
+                        {
+                            if (!write(Js::NumberUtilities::SurrogatePairAsCodePoint(pendingHigh, ch), pendingHigh, ch, 2))
+                            {
+                                break;
+                            }
+                            pendingHigh = 0;
+                            continue;
+                        }
+                        if (!write(unpaired(pendingHigh), 0, 0, 1))
+                        {
+                            break;
+                        }
+                        pendingHigh = 0;
+                    }
+
+                    if (Js::NumberUtilities::IsSurrogateUpperPart(ch))
+                    {
+                        pendingHigh = ch;
+                    }
+                    else if (!write(Js::NumberUtilities::IsSurrogateLowerPart(ch) ? unpaired(ch) : ch, 0, 0, 1))
+                    {
+                        break;
+                    }
+                }
+            }
+
+            if (pendingHigh != 0 && !isFull)
+            {
+                write(unpaired(pendingHigh), 0, 0, 1);
+            }
+        }
+        END_TEMP_ALLOCATOR(tempAllocator, scriptContext);
+
+        if (written != nullptr)
+        {
+            *written = byteCount;
+        }
+        if (charsWritten != nullptr)
+        {
+            *charsWritten = charCount;
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsAddRootRange(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _In_ JsValueRef* const* start,
+    _In_ JsValueRef* const* end,
+    _Out_ JsRootRangeHandle* rootRange)
+{
+    PARAM_NOT_NULL(start);
+    PARAM_NOT_NULL(end);
+    PARAM_NOT_NULL(rootRange);
+    *rootRange = nullptr;
+
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Recycler::ExternalRootRange * range = threadContext->EnsureRecycler()->RegisterExternalRootRange(
+            reinterpret_cast<void ** const *>(start), reinterpret_cast<void ** const *>(end));
+        if (range == nullptr)
+        {
+            return JsErrorOutOfMemory;
+        }
+        *rootRange = range;
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsRemoveRootRange(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _In_ JsRootRangeHandle rootRange)
+{
+    PARAM_NOT_NULL(rootRange);
+
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        threadContext->GetRecycler()->UnregisterExternalRootRange(static_cast<Recycler::ExternalRootRange *>(rootRange));
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsAddWeakRootRange(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _In_ JsValueRef* const* start,
+    _In_ JsValueRef* const* end,
+    _Out_ JsRootRangeHandle* weakRootRange)
+{
+    PARAM_NOT_NULL(start);
+    PARAM_NOT_NULL(end);
+    PARAM_NOT_NULL(weakRootRange);
+    *weakRootRange = nullptr;
+
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Recycler::ExternalRootRange * range = threadContext->EnsureRecycler()->RegisterExternalWeakRootRange(
+            reinterpret_cast<void ** const *>(start), reinterpret_cast<void ** const *>(end));
+        if (range == nullptr)
+        {
+            return JsErrorOutOfMemory;
+        }
+        *weakRootRange = range;
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsRemoveWeakRootRange(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _In_ JsRootRangeHandle weakRootRange)
+{
+    PARAM_NOT_NULL(weakRootRange);
+
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        threadContext->GetRecycler()->UnregisterExternalWeakRootRange(static_cast<Recycler::ExternalRootRange *>(weakRootRange));
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsSetWeakRootsClearedCallback(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _In_opt_ void *callbackState,
+    _In_opt_ JsWeakRootsClearedCallback weakRootsClearedCallback)
+{
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        threadContext->EnsureRecycler()->SetExternalWeakRootsClearedCallback(
+            reinterpret_cast<Recycler::ExternalWeakRootsClearedCallback>(weakRootsClearedCallback), callbackState);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsSetStackSampleCallback(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _In_opt_ void *callbackState,
+    _In_opt_ JsStackSampleCallback stackSampleCallback,
+    _In_ unsigned short maxFrameCount)
+{
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        if (stackSampleCallback != nullptr && maxFrameCount == 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        JsrtRuntime * runtime = JsrtRuntime::FromHandle(runtimeHandle);
+        ThreadContextScope scope(runtime->GetThreadContext());
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        runtime->SetStackSampleCallback(stackSampleCallback, callbackState, maxFrameCount);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsRequestStackSample(
+    _In_ JsRuntimeHandle runtimeHandle)
+{
+    // Called from the sampler's thread, so like JsDisableRuntimeExecution this doesn't enter the runtime
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+    JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext()->RequestStackSample();
+    return JsNoError;
+}
+
+CHAKRA_API
+JsEnablePerfJitProfiling(
+    _In_ bool writePerfMap,
+    _In_ bool writeJitDump)
+{
+    VALIDATE_ENTER_CURRENT_THREAD();
+
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+#if defined(PERF_JIT_PROFILING) && ENABLE_NATIVE_CODEGEN
+        PerfJitProfile::Enable(writePerfMap, writeJitDump);
+        return JsNoError;
+#else
+        return JsErrorNotImplemented;
+#endif
+    });
+}
+
+CHAKRA_API
+JsSetLoopBodyJitThreshold(
+    _In_ unsigned int iterationCount)
+{
+    VALIDATE_ENTER_CURRENT_THREAD();
+
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+#if ENABLE_NATIVE_CODEGEN
+        if (iterationCount > INT_MAX)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::Configuration::Global.flags.LoopInterpretCount = static_cast<Js::Number>(iterationCount);
+        return JsNoError;
+#else
+        return JsErrorNotImplemented;
+#endif
+    });
+}
+
+CHAKRA_API
+JsEnumerateJitTelemetry(
+    _In_ JsJitTelemetryCallback callback,
+    _In_opt_ void *callbackState)
+{
+    PARAM_NOT_NULL(callback);
+
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+#if ENABLE_NATIVE_CODEGEN
+        // GetBailOutKindName reuses its buffer, so the names are copied out for each function
+        const uint slotCount = Js::FunctionJitTelemetry::BailOutKindSlotCount;
+        char kindNames[slotCount][512];
+        JsJitBailOutCount bailOutKinds[slotCount];
+
+        scriptContext->MapFunction([&](Js::FunctionBody* body)
+        {
+            Js::FunctionJitTelemetry * jitTelemetry = body->GetJitTelemetry();
+            if (jitTelemetry == nullptr)
+            {
+                return;
+            }
+
+            JsFunctionJitTelemetry telemetry;
+            telemetry.functionKey = body;
+            telemetry.functionName = body->GetExternalDisplayName();
+            telemetry.sourceName = body->GetSourceName();
+            telemetry.line = body->GetLineNumber();
+            telemetry.column = body->GetColumnNumber();
+
+            telemetry.tier = JsFunctionTierInterpreter;
+            Js::FunctionEntryPointInfo * entryPointInfo = body->GetDefaultFunctionEntryPointInfo();
+            if (entryPointInfo != nullptr && entryPointInfo->IsCodeGenDone())
+            {
+                telemetry.tier = entryPointInfo->GetJitMode() == ExecutionMode::SimpleJit ? JsFunctionTierSimpleJit : JsFunctionTierFullJit;
+            }
+
+            telemetry.simpleJitCount = jitTelemetry->GetSimpleJitCount();
+            telemetry.fullJitCount = jitTelemetry->GetFullJitCount();
+            telemetry.loopBodyJitCount = jitTelemetry->GetLoopBodyJitCount();
+            telemetry.rejitCount = jitTelemetry->GetRejitCount();
+            telemetry.bailOutCount = jitTelemetry->GetBailOutCount();
+            telemetry.codeGenTime = jitTelemetry->GetCodeGenTime() / 1000.0;
+            telemetry.otherBailOutCount = jitTelemetry->GetOtherBailOutCount();
+            telemetry.loopBodyEntryCount = jitTelemetry->GetLoopBodyEntryCount();
+            telemetry.scalarReplacedObjectCount = jitTelemetry->GetScalarReplacedObjectCount();
+
+            uint kindCount = 0;
+            jitTelemetry->MapBailOutKinds([&](uint kind, uint count)
+            {
+                strcpy_s(kindNames[kindCount], _countof(kindNames[kindCount]), ::GetBailOutKindName(static_cast<IR::BailOutKind>(kind)));
+                bailOutKinds[kindCount].kind = kind;
+                bailOutKinds[kindCount].kindName = kindNames[kindCount];
+                bailOutKinds[kindCount].count = count;
+                ++kindCount;
+            });
+            telemetry.bailOutKindCount = kindCount;
+            telemetry.bailOutKinds = bailOutKinds;
+
+            callback(&telemetry, callbackState);
+        });
+        return JsNoError;
+#else
+        return JsErrorNotImplemented;
+#endif
+    });
+}
+
+CHAKRA_API
+JsGetRuntimeBackgroundParseCount(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _Out_ unsigned int *functionCount)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(functionCount);
+
+    *functionCount = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext()->GetBackgroundParsedFunctionCount();
+    return JsNoError;
+}
+
+CHAKRA_API
+JsGetPropertyIdFromKey(
+    _In_ JsValueRef key,
+    _Out_ JsPropertyIdRef* propertyId)
+{
+    PARAM_NOT_NULL(propertyId);
+    *propertyId = nullptr;
+
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        VALIDATE_JSREF(key);
+
+        // Numbers are tagged on some platforms and have no vtable to compare, and aren't keys anyway
+        if (Js::TaggedNumber::Is(key))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::PropertyRecord const * propertyRecord;
+        if (VirtualTableInfo<Js::PropertyString>::HasVirtualTable(key))
+        {
+            propertyRecord = static_cast<Js::PropertyString*>(key)->GetPropertyRecord();
+        }
+        else if (Js::JavascriptSymbol::Is(key))
+        {
+            propertyRecord = Js::JavascriptSymbol::FromVar(key)->GetValue();
+        }
+        else if (Js::JavascriptString::Is(key))
+        {
+            Js::JavascriptString* name = Js::JavascriptString::FromVar(key);
+            scriptContext->GetOrAddPropertyRecord(name->GetString(), name->GetLength(), &propertyRecord);
+        }
+        else
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        *propertyId = (JsPropertyIdRef)propertyRecord;
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsCreatePropertyString(
+    _In_reads_(length) const wchar_t* name,
+    _In_ size_t length,
+    _Out_ JsValueRef* result)
+{
+    PARAM_NOT_NULL(name);
+    PARAM_NOT_NULL(result);
+    *result = nullptr;
+
+    if (length > INT_MAX)
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        Js::PropertyRecord const * propertyRecord;
+        scriptContext->GetOrAddPropertyRecord(name, static_cast<int>(length), &propertyRecord);
+        *result = scriptContext->GetPropertyString(propertyRecord->GetPropertyId());
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsDetachArrayBuffer(
+    _In_ JsValueRef arrayBuffer,
+    _Out_ JsArrayBufferContentsHandle* contents)
+{
+    PARAM_NOT_NULL(contents);
+    *contents = nullptr;
+
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        VALIDATE_INCOMING_REFERENCE(arrayBuffer, scriptContext);
+
+        if (!Js::ArrayBuffer::Is(arrayBuffer))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::ArrayBuffer* buffer = Js::ArrayBuffer::FromVar(arrayBuffer);
+        if (buffer->IsDetached() || !buffer->IsTransferable())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::ArrayBufferDetachedStateBase* state = buffer->DetachAndGetState();
+
+        // The memory may be adopted by another runtime, which reports it again
+        scriptContext->GetRecycler()->ReportExternalMemoryFree(state->bufferLength);
+
+        *contents = state;
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsGetArrayBufferDetachState(
+    _In_ JsValueRef arrayBuffer,
+    _Out_ bool* isDetached,
+    _Out_ bool* isDetachable)
+{
+    PARAM_NOT_NULL(isDetached);
+    PARAM_NOT_NULL(isDetachable);
+    *isDetached = false;
+    *isDetachable = false;
+
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        VALIDATE_INCOMING_REFERENCE(arrayBuffer, scriptContext);
+
+        if (!Js::ArrayBuffer::Is(arrayBuffer))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::ArrayBuffer* buffer = Js::ArrayBuffer::FromVar(arrayBuffer);
+        *isDetached = buffer->IsDetached();
+        *isDetachable = !buffer->IsDetached() && buffer->IsTransferable();
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsCreateArrayBufferFromContents(
+    _In_ JsArrayBufferContentsHandle contents,
+    _Out_ JsValueRef* result)
+{
+    PARAM_NOT_NULL(contents);
+    PARAM_NOT_NULL(result);
+    *result = nullptr;
+
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        Js::ArrayBufferDetachedStateBase* state = static_cast<Js::ArrayBufferDetachedStateBase*>(contents);
+        Recycler* recycler = scriptContext->GetRecycler();
+        if (!recycler->ReportExternalMemoryAllocation(state->bufferLength))
+        {
+            return JsErrorOutOfMemory;
+        }
+
+        Js::ArrayBuffer* buffer = Js::ArrayBuffer::NewFromDetachedState(state, scriptContext->GetLibrary());
+        state->MarkAsClaimed();
+        state->CleanUp();
+
+        *result = buffer;
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsReleaseArrayBufferContents(
+    _In_ JsArrayBufferContentsHandle contents)
+{
+    PARAM_NOT_NULL(contents);
+
+    return GlobalAPIWrapper([&]() -> JsErrorCode {
+        static_cast<Js::ArrayBufferDetachedStateBase*>(contents)->CleanUp();
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsGetValueLayout(
+    _Out_ JsValueLayout* layout)
+{
+    PARAM_NOT_NULL(layout);
+
+    CompileAssert(sizeof(Js::TypeId) == sizeof(int));
+    CompileAssert(sizeof(BOOL) == sizeof(int));
+    CompileAssert(Js::TypeIds_Int8Array + JsArrayTypeUint8 == Js::TypeIds_Uint8Array);
+    CompileAssert(Js::TypeIds_Int8Array + JsArrayTypeUint8Clamped == Js::TypeIds_Uint8ClampedArray);
+    CompileAssert(Js::TypeIds_Int8Array + JsArrayTypeInt16 == Js::TypeIds_Int16Array);
+    CompileAssert(Js::TypeIds_Int8Array + JsArrayTypeUint16 == Js::TypeIds_Uint16Array);
+    CompileAssert(Js::TypeIds_Int8Array + JsArrayTypeInt32 == Js::TypeIds_Int32Array);
+    CompileAssert(Js::TypeIds_Int8Array + JsArrayTypeUint32 == Js::TypeIds_Uint32Array);
+    CompileAssert(Js::TypeIds_Int8Array + JsArrayTypeFloat32 == Js::TypeIds_Float32Array);
+    CompileAssert(Js::TypeIds_Int8Array + JsArrayTypeFloat64 == Js::TypeIds_Float64Array);
+
+#if INT32VAR
+    layout->intTagMask = ~(uintptr_t)0 << Js::VarTag_Shift;
+    layout->intValueShift = 0;
+#else
+    layout->intTagMask = Js::AtomTag;
+    layout->intValueShift = Js::VarTag_Shift;
+#endif
+    layout->intTag = Js::AtomTag_IntPtr;
+#if FLOATVAR
+    // Matches JavascriptNumber::Is_NoTaggedIntCheck
+    layout->floatTagMask = ~(uintptr_t)0 << 50;
+#else
+    layout->floatTagMask = 0;
+#endif
+
+    layout->typeOffset = Js::RecyclableObject::GetOffsetOfType();
+    layout->typeIdOffset = Js::Type::GetOffsetOfTypeId();
+    layout->booleanValueOffset = Js::JavascriptBoolean::GetOffsetOfValue();
+    layout->typedArrayBufferOffset = Js::TypedArrayBase::GetOffsetOfBuffer();
+    layout->typedArrayLengthOffset = Js::TypedArrayBase::GetOffsetOfLength();
+
+    layout->undefinedTypeId = Js::TypeIds_Undefined;
+    layout->nullTypeId = Js::TypeIds_Null;
+    layout->booleanTypeId = Js::TypeIds_Boolean;
+    layout->integerTypeId = Js::TypeIds_Integer;
+    layout->numberTypeId = Js::TypeIds_Number;
+    layout->firstNumberTypeId = Js::TypeIds_FirstNumberType;
+    layout->lastNumberTypeId = Js::TypeIds_LastNumberType;
+    layout->stringTypeId = Js::TypeIds_String;
+    layout->symbolTypeId = Js::TypeIds_Symbol;
+    layout->lastPrimitiveTypeId = Js::TypeIds_LastJavascriptPrimitiveType;
+    layout->functionTypeId = Js::TypeIds_Function;
+    layout->errorTypeId = Js::TypeIds_Error;
+    layout->firstArrayTypeId = Js::TypeIds_ArrayFirst;
+    layout->lastArrayTypeId = Js::TypeIds_ArrayLast;
+    layout->es5ArrayTypeId = Js::TypeIds_ES5Array;
+    layout->arrayBufferTypeId = Js::TypeIds_ArrayBuffer;
+    layout->firstTypedArrayTypeId = Js::TypeIds_TypedArrayMin;
+    layout->lastTypedArrayTypeId = Js::TypeIds_TypedArrayMax;
+    layout->dataViewTypeId = Js::TypeIds_DataView;
+    return JsNoError;
+}
+
+static bool IsIndexPropertyName(Js::JavascriptString* name, Js::PropertyId propertyId, Js::ScriptContext* scriptContext)
+{
+    if (propertyId != Js::Constants::NoProperty)
+    {
+        return scriptContext->GetPropertyName(propertyId)->IsNumeric();
+    }
+
+    uint32 index;
+    return Js::JavascriptOperators::TryConvertToUInt32(name->GetString(), name->GetLength(), &index) &&
+        index != Js::JavascriptArray::InvalidIndex;
+}
+
+CHAKRA_API
+JsGetFilteredPropertyNames(
+    _In_ JsValueRef object,
+    _In_ JsPropertyNameFlags flags,
+    _Out_ JsValueRef* propertyNames)
+{
+    PARAM_NOT_NULL(propertyNames);
+    *propertyNames = nullptr;
+
+    const bool ownOnly = (flags & JsPropertyNameOwnOnly) != 0;
+    const bool includeNonEnumerable = (flags & JsPropertyNameIncludeNonEnumerable) != 0;
+    const bool skipIndices = (flags & JsPropertyNameSkipIndices) != 0;
+    const bool skipNonIndices = (flags & JsPropertyNameSkipNonIndices) != 0;
+    if (includeNonEnumerable && !ownOnly)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        VALIDATE_INCOMING_OBJECT(object, scriptContext);
+
+        Js::RecyclableObject* instance = Js::RecyclableObject::FromVar(object);
+        Js::JavascriptArray* result = scriptContext->GetLibrary()->CreateArray(0);
+        uint32 resultLength = 0;
+        auto addName = [&](Js::Var name, Js::PropertyId propertyId)
+        {
+            if (!Js::JavascriptString::Is(name))
+            {
+                // Some enumerators hand out undefined for holes
+                return;
+            }
+            bool isIndex = IsIndexPropertyName(Js::JavascriptString::FromVar(name), propertyId, scriptContext);
+            if (isIndex ? skipIndices : skipNonIndices)
+            {
+                return;
+            }
+            result->DirectSetItemAt(resultLength++, Js::CrossSite::MarshalVar(scriptContext, name));
+        };
+
+        Js::PropertyId propertyId;
+        Js::Var name;
+        if (!ownOnly)
+        {
+            Js::ForInObjectEnumerator enumerator(instance, scriptContext);
+            while ((name = enumerator.GetCurrentAndMoveNext(propertyId)) != nullptr)
+            {
+                addName(name, propertyId);
+            }
+            enumerator.Clear();
+        }
+        else if (Js::JavascriptProxy::Is(instance))
+        {
+            // The keys come from the proxy's ownKeys trap, which already returns an array
+            Js::JavascriptArray* keys = includeNonEnumerable ?
+                Js::JavascriptOperators::GetOwnPropertyNames(instance, scriptContext) :
+                Js::JavascriptOperators::GetOwnEnumerablePropertyNames(instance, scriptContext);
+            uint32 length = keys->GetLength();
+            for (uint32 i = 0; i < length; i++)
+            {
+                Js::Var key;
+                if (keys->DirectGetItemAt(i, &key))
+                {
+                    addName(key, Js::Constants::NoProperty);
+                }
+            }
+        }
+        else
+        {
+            Js::Var enumeratorVar;
+            if (instance->GetEnumerator(includeNonEnumerable, &enumeratorVar, scriptContext, false, false))
+            {
+                Js::JavascriptEnumerator* enumerator = Js::JavascriptEnumerator::FromVar(enumeratorVar);
+                while (true)
+                {
+                    // Not every enumerator sets the ID of names it has no property record for
+                    propertyId = Js::Constants::NoProperty;
+                    name = enumerator->GetCurrentAndMoveNext(propertyId);
+                    if (name == nullptr)
+                    {
+                        break;
+                    }
+                    addName(name, propertyId);
+                }
+            }
+        }
+
+        *propertyNames = result;
+        return JsNoError;
+    });
+}
@@ -83,7 +83,12 @@ bool BackgroundParser::Process(JsUtil::Job *const job, JsUtil::ParallelThreadDat
 
     Parser *parser = threadData->parser;
 
-    return this->Process(backgroundItem, parser, threadData->pse);
+    bool succeeded = this->Process(backgroundItem, parser, threadData->pse);
+    if (succeeded)
+    {
+        this->scriptContext->GetThreadContext()->LogBackgroundParsedFunction();
+    }
+    return succeeded;
 }
 
 bool BackgroundParser::Process(JsUtil::Job *const job, Parser *parser, CompileScriptException *pse)
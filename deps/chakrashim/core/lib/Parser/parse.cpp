@@ -2013,7 +2013,10 @@ BOOL Parser::PnodeLabelNoAST(IdentToken* pToken, LabelId* pLabelIdList)
 
 void Parser::EnsureStackAvailable()
 {
-    if (!m_scriptContext->GetThreadContext()->IsStackAvailable(Js::Constants::MinStackCompile))
+    ThreadContext *threadContext = m_scriptContext->GetThreadContext();
+    if (!threadContext->IsStackAvailable(Js::Constants::MinStackCompile) &&
+        !(threadContext->ServiceStackSampleRequest(nullptr, nullptr) &&
+          threadContext->IsStackAvailable(Js::Constants::MinStackCompile)))
     {
         Error(ERRnoMemory);
     }
@@ -5381,7 +5384,14 @@ bool Parser::DoParallelParse(ParseNodePtr pnodeFnc) const
 #if ENABLE_BACKGROUND_PARSING
     if (!PHASE_ON_RAW(Js::ParallelParsePhase, m_sourceContextInfo->sourceContextId, pnodeFnc->sxFnc.functionId))
     {
-        return false;
+        // When the host turns parallel parsing on for the runtime, only split up large scripts. Handing a function
+        // to a background thread costs more than parsing it in place unless there is a lot of script left to parse.
+        if (!m_scriptContext->GetThreadContext()->ParallelParseEnabled() ||
+            PHASE_OFF_RAW(Js::ParallelParsePhase, m_sourceContextInfo->sourceContextId, pnodeFnc->sxFnc.functionId) ||
+            m_length < (size_t)CONFIG_FLAG_RELEASE(ParallelParseThreshold))
+        {
+            return false;
+        }
     }
 
     BackgroundParser *bgp = m_scriptContext->GetBackgroundParser();
@@ -15,6 +15,9 @@
 #ifdef VTUNE_PROFILING
 #include "Base/VTuneChakraProfile.h"
 #endif
+#ifdef PERF_JIT_PROFILING
+#include "Base/PerfJitProfile.h"
+#endif
 
 #ifdef DYNAMIC_PROFILE_MUTATOR
 #include "Language/DynamicProfileMutator.h"
@@ -451,7 +454,7 @@ namespace Js
         m_argUsedForBranch(0),
         m_envDepth((uint16)-1),
         interpretedCount(0),
-        loopInterpreterLimit(CONFIG_FLAG(LoopInterpretCount)),
+        loopInterpreterLimit(CONFIG_FLAG_RELEASE(LoopInterpretCount)),
         savedPolymorphicCacheState(0),
         debuggerScopeIndex(0),
         flags(Flags_HasNoExplicitReturnValue),
@@ -3125,6 +3128,9 @@ namespace Js
                 this->originalEntryPoint = this->m_scriptContext->GetNextDynamicInterpreterThunk(&this->m_dynamicInterpreterThunk);
             }
             JS_ETW(EtwTrace::LogMethodInterpreterThunkLoadEvent(this));
+#ifdef PERF_JIT_PROFILING
+            PerfJitProfile::LogMethodInterpreterThunkLoadEvent(this);
+#endif
         }
         else
         {
@@ -3245,6 +3251,9 @@ namespace Js
 #ifdef VTUNE_PROFILING
         VTuneChakraProfile::LogMethodNativeLoadEvent(this, entryPointInfo);
 #endif
+#ifdef PERF_JIT_PROFILING
+        PerfJitProfile::LogMethodNativeLoadEvent(this, entryPointInfo);
+#endif
 
 #ifdef _M_ARM
         // For ARM we need to make sure that pipeline is synchronized with memory/cache for newly jitted code.
@@ -3305,6 +3314,9 @@ namespace Js
         JS_ETW(EtwTrace::LogLoopBodyLoadEvent(this, loopHeader, ((LoopEntryPointInfo*) entryPointInfo), ((uint16)this->GetLoopNumberWithLock(loopHeader))));
 #ifdef VTUNE_PROFILING
         VTuneChakraProfile::LogLoopBodyLoadEvent(this, loopHeader, ((LoopEntryPointInfo*)entryPointInfo), ((uint16)this->GetLoopNumberWithLock(loopHeader)));
+#endif
+#ifdef PERF_JIT_PROFILING
+        PerfJitProfile::LogLoopBodyLoadEvent(this, ((LoopEntryPointInfo*)entryPointInfo), ((uint16)this->GetLoopNumberWithLock(loopHeader)));
 #endif
     }
 #endif
@@ -4843,7 +4855,7 @@ namespace Js
 
         recentlyBailedOutOfJittedLoopBody = false;
 
-        SetLoopInterpreterLimit(CONFIG_FLAG(LoopInterpretCount));
+        SetLoopInterpreterLimit(CONFIG_FLAG_RELEASE(LoopInterpretCount));
         ReinitializeExecutionModeAndLimits();
 
         Assert(this->m_sourceInfo.m_probeCount == 0);
@@ -6256,6 +6268,17 @@ namespace Js
 
         return codeGenGetSetRuntimeData[inlineCacheIndex] = RecyclerNew(recycler, FunctionCodeGenRuntimeData, inlinee);
     }
+
+    FunctionJitTelemetry *FunctionBody::EnsureJitTelemetry()
+    {
+        FunctionJitTelemetry *telemetry = this->GetJitTelemetry();
+        if (telemetry == nullptr)
+        {
+            telemetry = RecyclerNewLeafZ(this->GetScriptContext()->GetRecycler(), FunctionJitTelemetry);
+            this->SetAuxPtr(AuxPointerType::JitTelemetry, telemetry);
+        }
+        return telemetry;
+    }
 #endif
 
     void FunctionBody::AllocateLoopHeaders()
@@ -7333,7 +7356,7 @@ namespace Js
 
     uint FunctionBody::GetReducedLoopInterpretCount()
     {
-        const uint loopInterpretCount = CONFIG_FLAG(LoopInterpretCount);
+        const uint loopInterpretCount = CONFIG_FLAG_RELEASE(LoopInterpretCount);
         if(CONFIG_ISENABLED(LoopInterpretCountFlag))
         {
             return loopInterpretCount;
@@ -6,6 +6,7 @@
 
 #include "AuxPtrs.h"
 #include "CompactCounters.h"
+#include "FunctionJitTelemetry.h"
 
 struct CodeGenWorkItem;
 class SourceContextInfo;
@@ -1062,6 +1063,7 @@ namespace Js
         uint profiledLoopCounter;
         bool isNested;
         bool isInTry;
+        bool hasYield;
         FunctionBody * functionBody;
 
 #if DBG_DUMP
@@ -1207,6 +1209,7 @@ namespace Js
             ObjLiteralTypes = 19,
             ScopeInfo = 20,
             FormalsPropIdArray = 21,
+            JitTelemetry = 22,
 
             Max,
             Invalid = 0xff
@@ -1293,8 +1296,8 @@ namespace Js
 
         bool IsJitLoopBodyPhaseEnabled() const
         {
-            // Consider: Allow JitLoopBody in generator functions for loops that do not yield.
-            return !PHASE_OFF(JITLoopBodyPhase, this) && DoFullJit() && !this->IsGenerator();
+            // Generator functions only jit the loops that do not yield (see LoopHeader::hasYield).
+            return !PHASE_OFF(JITLoopBodyPhase, this) && DoFullJit();
         }
 
         bool IsJitLoopBodyPhaseForced() const
@@ -2409,6 +2412,12 @@ namespace Js
         FunctionCodeGenRuntimeData ** GetCodeGenRuntimeDataWithLock() const { return static_cast<FunctionCodeGenRuntimeData**>(this->GetAuxPtrWithLock(AuxPointerType::CodeGenRuntimeData)); }
         void SetCodeGenRuntimeData(FunctionCodeGenRuntimeData** codeGenRuntimeData) { this->SetAuxPtr(AuxPointerType::CodeGenRuntimeData, codeGenRuntimeData); }
 
+#if ENABLE_NATIVE_CODEGEN
+        FunctionJitTelemetry * GetJitTelemetry() const { return static_cast<FunctionJitTelemetry*>(this->GetAuxPtr(AuxPointerType::JitTelemetry)); }
+        FunctionJitTelemetry * GetJitTelemetryWithLock() const { return static_cast<FunctionJitTelemetry*>(this->GetAuxPtrWithLock(AuxPointerType::JitTelemetry)); }
+        FunctionJitTelemetry * EnsureJitTelemetry();
+#endif
+
         static StatementMap * GetNextNonSubexpressionStatementMap(StatementMapList *statementMapList, int & startingAtIndex);
         static StatementMap * GetPrevNonSubexpressionStatementMap(StatementMapList *statementMapList, int & startingAtIndex);
         void RecordStatementAdjustment(uint offset, StatementAdjustmentType adjType);
@@ -0,0 +1,108 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if ENABLE_NATIVE_CODEGEN
+namespace Js
+{
+    // Per function JIT counters that are kept in all builds, so that functions stuck in a bailout and
+    // rejit loop can be found in production. Allocated when the function is first queued for JIT.
+    // JIT threads only touch the code gen counters, with interlocked operations. Bailouts and loop body
+    // entries are logged on the script thread.
+    class FunctionJitTelemetry
+    {
+    public:
+        static const uint BailOutKindSlotCount = 8;
+
+        struct BailOutKindCount
+        {
+            uint kind;
+            uint count;
+        };
+
+    private:
+        uint simpleJitCount;
+        uint fullJitCount;
+        uint loopBodyJitCount;
+        uint rejitCount;
+        uint bailOutCount;
+        uint otherBailOutCount;             // Bailouts of kinds that didn't fit in bailOutKinds
+        uint loopBodyEntryCount;            // Times the interpreter entered a JIT'd loop body (on-stack replacement)
+        uint scalarReplacedObjectCount;     // Object literal allocations removed by full JIT compilations
+        LONGLONG codeGenTime;               // In microseconds
+        BailOutKindCount bailOutKinds[BailOutKindSlotCount];
+
+    public:
+        void LogCodeGen(const ExecutionMode jitMode, const bool isLoopBody, const LONGLONG microseconds)
+        {
+            if (isLoopBody)
+            {
+                InterlockedIncrement(&loopBodyJitCount);
+            }
+            else if (jitMode == ExecutionMode::SimpleJit)
+            {
+                InterlockedIncrement(&simpleJitCount);
+            }
+            else
+            {
+                InterlockedIncrement(&fullJitCount);
+            }
+            InterlockedExchangeAdd64(&codeGenTime, microseconds);
+        }
+
+        void LogScalarReplacedObjects(const uint count)
+        {
+            InterlockedExchangeAdd(&scalarReplacedObjectCount, count);
+        }
+
+        void LogRejit()
+        {
+            InterlockedIncrement(&rejitCount);
+        }
+
+        void LogBailOut(const uint kind)
+        {
+            ++bailOutCount;
+            for (uint i = 0; i < BailOutKindSlotCount; ++i)
+            {
+                if (bailOutKinds[i].count == 0)
+                {
+                    bailOutKinds[i].kind = kind;
+                }
+                if (bailOutKinds[i].kind == kind)
+                {
+                    ++bailOutKinds[i].count;
+                    return;
+                }
+            }
+            ++otherBailOutCount;
+        }
+
+        void LogLoopBodyEntry()
+        {
+            ++loopBodyEntryCount;
+        }
+
+        uint GetSimpleJitCount() const { return simpleJitCount; }
+        uint GetFullJitCount() const { return fullJitCount; }
+        uint GetLoopBodyJitCount() const { return loopBodyJitCount; }
+        uint GetRejitCount() const { return rejitCount; }
+        uint GetBailOutCount() const { return bailOutCount; }
+        uint GetOtherBailOutCount() const { return otherBailOutCount; }
+        uint GetLoopBodyEntryCount() const { return loopBodyEntryCount; }
+        uint GetScalarReplacedObjectCount() const { return scalarReplacedObjectCount; }
+        LONGLONG GetCodeGenTime() const { return codeGenTime; }
+
+        template <class Fn>
+        void MapBailOutKinds(Fn fn) const
+        {
+            for (uint i = 0; i < BailOutKindSlotCount && bailOutKinds[i].count != 0; ++i)
+            {
+                fn(bailOutKinds[i].kind, bailOutKinds[i].count);
+            }
+        }
+    };
+}
+#endif
@@ -0,0 +1,409 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+
+#ifdef PERF_JIT_PROFILING
+
+#include "PerfJitProfile.h"
+#include "jitprofiling.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+//
+// jitdump file layout, see tools/perf/Documentation/jitdump-specification.txt in the Linux sources.
+// A JIT_CODE_DEBUG_INFO record must precede the JIT_CODE_LOAD record of the code it describes.
+//
+namespace
+{
+    const uint32 JitDumpMagic = 0x4A695444;
+    const uint32 JitDumpVersion = 1;
+#if defined(_M_X64)
+    const uint32 JitDumpElfMachine = 62;    // EM_X86_64
+#else
+    const uint32 JitDumpElfMachine = 3;     // EM_386
+#endif
+
+    enum JitDumpRecordType : uint32
+    {
+        JitCodeLoad = 0,
+        JitCodeDebugInfo = 2,
+        JitCodeClose = 3
+    };
+
+    struct JitDumpFileHeader
+    {
+        uint32 magic;
+        uint32 version;
+        uint32 totalSize;
+        uint32 elfMachine;
+        uint32 pad1;
+        uint32 pid;
+        uint64 timestamp;
+        uint64 flags;
+    };
+
+    struct JitDumpRecordHeader
+    {
+        uint32 id;
+        uint32 totalSize;
+        uint64 timestamp;
+    };
+
+    // Followed by the null terminated function name and the code bytes
+    struct JitDumpCodeLoad
+    {
+        JitDumpRecordHeader header;
+        uint32 pid;
+        uint32 tid;
+        uint64 vma;
+        uint64 codeAddress;
+        uint64 codeSize;
+        uint64 codeIndex;
+    };
+
+    struct JitDumpDebugInfo
+    {
+        JitDumpRecordHeader header;
+        uint64 codeAddress;
+        uint64 entryCount;
+    };
+
+    // Followed by the null terminated source file name
+    struct JitDumpDebugEntry
+    {
+        uint64 address;
+        int32 line;
+        int32 discriminator;
+    };
+
+    const size_t NameBufferLength = 512;
+    const size_t UrlBufferLength = 512;
+}
+
+static const char DynamicCode[] = "Dynamic code";
+
+int PerfJitProfile::perfMapFd = -1;
+int PerfJitProfile::jitDumpFd = -1;
+void* PerfJitProfile::jitDumpMarker = nullptr;
+uint64 PerfJitProfile::codeIndex = 0;
+CriticalSection PerfJitProfile::cs;
+
+//
+// Opens the perf map and jitdump files requested by -PerfMap and -PerfJitDump.
+//
+void PerfJitProfile::Register()
+{
+#if ENABLE_NATIVE_CODEGEN
+    Enable(Js::Configuration::Global.flags.PerfMap, Js::Configuration::Global.flags.PerfJitDump);
+#endif
+}
+
+//
+// Opens the requested files that aren't open yet. Only code committed after this is logged.
+//
+void PerfJitProfile::Enable(bool perfMap, bool jitDump)
+{
+#if ENABLE_NATIVE_CODEGEN
+    AutoCriticalSection autocs(&cs);
+
+    char path[64];
+    const int pid = getpid();
+
+    if (perfMap && perfMapFd < 0)
+    {
+        sprintf_s(path, sizeof(path), "/tmp/perf-%d.map", pid);
+        perfMapFd = CreateOutputFile(path, O_WRONLY);
+    }
+
+    if (jitDump && jitDumpFd < 0)
+    {
+        sprintf_s(path, sizeof(path), "/tmp/jit-%d.dump", pid);
+        int fd = CreateOutputFile(path, O_RDWR);
+        if (fd < 0)
+        {
+            return;
+        }
+
+        // perf record finds the dump through an executable mapping of the file, so keep one around
+        void* marker = mmap(nullptr, AutoSystemInfo::PageSize, PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, 0);
+
+        JitDumpFileHeader header = { 0 };
+        header.magic = JitDumpMagic;
+        header.version = JitDumpVersion;
+        header.totalSize = sizeof(header);
+        header.elfMachine = JitDumpElfMachine;
+        header.pid = pid;
+        header.timestamp = GetTimestamp();
+
+        if (marker == MAP_FAILED || !Write(fd, &header, sizeof(header)))
+        {
+            if (marker != MAP_FAILED)
+            {
+                munmap(marker, AutoSystemInfo::PageSize);
+            }
+            close(fd);
+            return;
+        }
+
+        jitDumpMarker = marker;
+        jitDumpFd = fd;
+    }
+#endif
+}
+
+//
+// Writes the jitdump close record and closes both files.
+//
+void PerfJitProfile::UnRegister()
+{
+#if ENABLE_NATIVE_CODEGEN
+    AutoCriticalSection autocs(&cs);
+
+    if (jitDumpFd >= 0)
+    {
+        JitDumpRecordHeader record;
+        record.id = JitCodeClose;
+        record.totalSize = sizeof(record);
+        record.timestamp = GetTimestamp();
+        Write(jitDumpFd, &record, sizeof(record));
+
+        munmap(jitDumpMarker, AutoSystemInfo::PageSize);
+        jitDumpMarker = nullptr;
+        close(jitDumpFd);
+        jitDumpFd = -1;
+    }
+
+    if (perfMapFd >= 0)
+    {
+        close(perfMapFd);
+        perfMapFd = -1;
+    }
+#endif
+}
+
+//
+// Log a JITted function. Simple JIT code is prefixed with '+' and full JIT code with '*'.
+//
+void PerfJitProfile::LogMethodNativeLoadEvent(Js::FunctionBody* body, Js::FunctionEntryPointInfo* entryPoint)
+{
+#if ENABLE_NATIVE_CODEGEN
+    if (IsActive())
+    {
+        char name[NameBufferLength];
+        GetName(body, entryPoint->GetJitMode() == ExecutionMode::SimpleJit ? '+' : '*', -1, name, sizeof(name));
+        LogCodeLoad(body, entryPoint, (void*)entryPoint->GetNativeAddress(), (size_t)entryPoint->GetCodeSize(), name);
+    }
+#endif
+}
+
+//
+// Log a JITted loop body.
+//
+void PerfJitProfile::LogLoopBodyLoadEvent(Js::FunctionBody* body, Js::LoopEntryPointInfo* entryPoint, uint16 loopNumber)
+{
+#if ENABLE_NATIVE_CODEGEN
+    if (IsActive())
+    {
+        char name[NameBufferLength];
+        GetName(body, '*', loopNumber + 1, name, sizeof(name));
+        LogCodeLoad(body, entryPoint, (void*)entryPoint->GetNativeAddress(), (size_t)entryPoint->GetCodeSize(), name);
+    }
+#endif
+}
+
+//
+// Log the dynamic interpreter thunk of a function, prefixed with '~', so that samples in the
+// interpreter are attributed to the JavaScript function being interpreted.
+//
+void PerfJitProfile::LogMethodInterpreterThunkLoadEvent(Js::FunctionBody* body)
+{
+#if ENABLE_NATIVE_CODEGEN && DYNAMIC_INTERPRETER_THUNK
+    if (IsActive())
+    {
+        char name[NameBufferLength];
+        GetName(body, '~', -1, name, sizeof(name));
+        LogCodeLoad(body, nullptr, body->GetDynamicInterpreterEntryPoint(), body->GetDynamicInterpreterThunkSize(), name);
+    }
+#endif
+}
+
+//
+// Log a whole block of interpreter thunks. Thunks handed out to functions get their own,
+// more specific entries, logged after this one.
+//
+void PerfJitProfile::LogInterpreterThunkBlockLoadEvent(void* address, size_t size)
+{
+#if ENABLE_NATIVE_CODEGEN
+    if (IsActive())
+    {
+        LogCodeLoad(nullptr, nullptr, address, size, "JS:InterpreterThunk");
+    }
+#endif
+}
+
+void PerfJitProfile::LogCodeLoad(Js::FunctionBody* body, Js::EntryPointInfo* entryPoint, void* address, size_t size, const char* name)
+{
+    AutoCriticalSection autocs(&cs);
+
+    if (perfMapFd >= 0)
+    {
+        char line[NameBufferLength + 64];
+        int length = sprintf_s(line, sizeof(line), "%llx %llx %s\n", (unsigned long long)address, (unsigned long long)size, name);
+        if (length > 0)
+        {
+            Write(perfMapFd, line, length);
+        }
+    }
+
+    if (jitDumpFd >= 0)
+    {
+        if (body != nullptr && entryPoint != nullptr && !Js::Configuration::Global.flags.DisableVTuneSourceLineInfo)
+        {
+            char url[UrlBufferLength];
+            WriteDebugInfo(body, entryPoint, address, GetUrl(body, url, sizeof(url)));
+        }
+
+        size_t nameLength = strlen(name) + 1;
+        JitDumpCodeLoad record;
+        record.header.id = JitCodeLoad;
+        record.header.totalSize = (uint32)(sizeof(record) + nameLength + size);
+        record.header.timestamp = GetTimestamp();
+        record.pid = getpid();
+        record.tid = (uint32)syscall(SYS_gettid);
+        record.vma = (uint64)address;
+        record.codeAddress = (uint64)address;
+        record.codeSize = size;
+        record.codeIndex = codeIndex++;
+
+        if (Write(jitDumpFd, &record, sizeof(record)) && Write(jitDumpFd, name, nameLength))
+        {
+            Write(jitDumpFd, address, size);
+        }
+    }
+
+    OUTPUT_TRACE(Js::ProfilerPhase, _u("Perf code load event: %p %u\n"), address, (uint)size);
+}
+
+//
+// Write the native offset to source line table of the entry point, as populated for VTune
+//
+void PerfJitProfile::WriteDebugInfo(Js::FunctionBody* body, Js::EntryPointInfo* entryPoint, void* address, const char* url)
+{
+    uint lineCount = entryPoint->GetNativeOffsetMapCount() * 2 + 1;
+    LineNumberInfo* lineInfo = HeapNewNoThrowArray(LineNumberInfo, lineCount);
+    if (lineInfo == nullptr)
+    {
+        return;
+    }
+
+    uint entryCount = entryPoint->PopulateLineInfo(lineInfo, body);
+    size_t urlLength = strlen(url) + 1;
+
+    JitDumpDebugInfo record;
+    record.header.id = JitCodeDebugInfo;
+    record.header.totalSize = (uint32)(sizeof(record) + entryCount * (sizeof(JitDumpDebugEntry) + urlLength));
+    record.header.timestamp = GetTimestamp();
+    record.codeAddress = (uint64)address;
+    record.entryCount = entryCount;
+
+    bool succeeded = Write(jitDumpFd, &record, sizeof(record));
+    for (uint i = 0; succeeded && i < entryCount; i++)
+    {
+        JitDumpDebugEntry entry;
+        entry.address = (uint64)address + lineInfo[i].Offset;
+        entry.line = lineInfo[i].LineNumber;
+        entry.discriminator = 0;
+        succeeded = Write(jitDumpFd, &entry, sizeof(entry)) && Write(jitDumpFd, url, urlLength);
+    }
+
+    HeapDeleteArray(lineCount, lineInfo);
+}
+
+//
+// Builds "JS:<prefix><name>[ Loop <n>] <url>:<line>" in utf8
+//
+size_t PerfJitProfile::GetName(Js::FunctionBody* body, char prefix, int loopNumber, char* buffer, size_t bufferLength)
+{
+    char url[UrlBufferLength];
+    utf8char_t utf8Name[NameBufferLength];
+
+    const char16* methodName = body->GetExternalDisplayName();
+    charcount_t methodLength = (charcount_t)min(wcslen(methodName), (_countof(utf8Name) - 1) / 3);
+    utf8::EncodeIntoAndNullTerminate(utf8Name, methodName, methodLength);
+
+    int length;
+    if (loopNumber >= 0)
+    {
+        length = sprintf_s(buffer, bufferLength, "JS:%c%s Loop %d %s:%u", prefix, (char*)utf8Name, loopNumber,
+            GetUrl(body, url, sizeof(url)), (uint)body->GetLineNumber());
+    }
+    else
+    {
+        length = sprintf_s(buffer, bufferLength, "JS:%c%s %s:%u", prefix, (char*)utf8Name,
+            GetUrl(body, url, sizeof(url)), (uint)body->GetLineNumber());
+    }
+    return length > 0 ? length : 0;
+}
+
+const char* PerfJitProfile::GetUrl(Js::FunctionBody* body, char* buffer, size_t bufferLength)
+{
+    if (body->GetSourceContextInfo()->IsDynamic())
+    {
+        return DynamicCode;
+    }
+
+    const char16* url = body->GetSourceContextInfo()->url;
+    if (url == nullptr)
+    {
+        return DynamicCode;
+    }
+
+    charcount_t urlLength = (charcount_t)min(wcslen(url), (bufferLength - 1) / 3);
+    utf8::EncodeIntoAndNullTerminate((utf8char_t*)buffer, url, urlLength);
+    return buffer;
+}
+
+// The files are in /tmp, where an existing path may be a link planted by another user, so they are only
+// created, never opened. A file left by an earlier process with the same pid is removed first; the sticky
+// bit on /tmp keeps other users' files from being removed.
+int PerfJitProfile::CreateOutputFile(const char* path, int flags)
+{
+    int fd = open(path, flags | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd < 0 && errno == EEXIST && unlink(path) == 0)
+    {
+        fd = open(path, flags | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    }
+    return fd;
+}
+
+bool PerfJitProfile::Write(int fd, const void* data, size_t size)
+{
+    const char* current = (const char*)data;
+    while (size > 0)
+    {
+        ssize_t written = write(fd, current, size);
+        if (written <= 0)
+        {
+            return false;
+        }
+        current += written;
+        size -= written;
+    }
+    return true;
+}
+
+// Timestamps must come from CLOCK_MONOTONIC to match "perf record -k mono"
+uint64 PerfJitProfile::GetTimestamp()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+#endif /* PERF_JIT_PROFILING */
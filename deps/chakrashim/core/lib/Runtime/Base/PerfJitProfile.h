@@ -0,0 +1,46 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#ifdef PERF_JIT_PROFILING
+
+//
+// Makes JITted code and interpreter thunks visible to Linux perf. With -PerfMap, a
+// /tmp/perf-<pid>.map symbol file is written. With -PerfJitDump, a /tmp/jit-<pid>.dump
+// file with code bytes and source line info is written, for use with "perf inject --jit".
+// Hosts can also turn either on later through JsEnablePerfJitProfiling.
+//
+class PerfJitProfile
+{
+public:
+    static void Register();
+    static void UnRegister();
+    static void Enable(bool perfMap, bool jitDump);
+
+    static void LogMethodNativeLoadEvent(Js::FunctionBody* body, Js::FunctionEntryPointInfo* entryPoint);
+    static void LogLoopBodyLoadEvent(Js::FunctionBody* body, Js::LoopEntryPointInfo* entryPoint, uint16 loopNumber);
+    static void LogMethodInterpreterThunkLoadEvent(Js::FunctionBody* body);
+    static void LogInterpreterThunkBlockLoadEvent(void* address, size_t size);
+
+    static bool IsActive() { return perfMapFd >= 0 || jitDumpFd >= 0; }
+    static bool IsJitDumpActive() { return jitDumpFd >= 0; }
+
+private:
+    static void LogCodeLoad(Js::FunctionBody* body, Js::EntryPointInfo* entryPoint, void* address, size_t size, const char* name);
+    static void WriteDebugInfo(Js::FunctionBody* body, Js::EntryPointInfo* entryPoint, void* address, const char* url);
+    static size_t GetName(Js::FunctionBody* body, char prefix, int loopNumber, char* buffer, size_t bufferLength);
+    static const char* GetUrl(Js::FunctionBody* body, char* buffer, size_t bufferLength);
+    static int CreateOutputFile(const char* path, int flags);
+    static bool Write(int fd, const void* data, size_t size);
+    static uint64 GetTimestamp();
+
+    static int perfMapFd;
+    static int jitDumpFd;
+    static void* jitDumpMarker;
+    static uint64 codeIndex;
+    static CriticalSection cs;
+};
+
+#endif
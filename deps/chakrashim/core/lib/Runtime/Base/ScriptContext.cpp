@@ -1136,7 +1136,7 @@ namespace Js
 #endif
 
 #if ENABLE_BACKGROUND_PARSING
-        if (PHASE_ON1(Js::ParallelParsePhase))
+        if (PHASE_ON1(Js::ParallelParsePhase) || threadContext->ParallelParseEnabled())
         {
             this->backgroundParser = BackgroundParser::New(this);
         }
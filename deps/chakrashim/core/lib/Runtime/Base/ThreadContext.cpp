@@ -151,6 +151,7 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
 #endif
     sourceCodeSize(0),
     nativeCodeSize(0),
+    backgroundParsedFunctionCount(0),
     threadAlloc(_u("TC"), GetPageAllocator(), Js::Throw::OutOfMemory),
     inlineCacheThreadInfoAllocator(_u("TC-InlineCacheInfo"), GetPageAllocator(), Js::Throw::OutOfMemory),
     isInstInlineCacheThreadInfoAllocator(_u("TC-IsInstInlineCacheInfo"), GetPageAllocator(), Js::Throw::OutOfMemory),
@@ -182,6 +183,10 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     telemetryBlock(&localTelemetryBlock),
     configuration(enableExperimentalFeatures),
     jsrtRuntime(nullptr),
+    stackSampleCallBack(nullptr),
+    stackSampleCallBackContext(nullptr),
+    isStackSampleRequested(FALSE),
+    isExecutionDisabledByHost(false),
     rootPendingClose(nullptr),
     wellKnownHostTypeHTMLAllCollectionTypeId(Js::TypeIds_Undefined),
     isProfilingUserCode(true),
@@ -1571,7 +1576,8 @@ ThreadContext::IsCurrentStackAvailable(size_t size)
     ThreadContext *currentContext = GetContextForCurrentThread();
     Assert(currentContext);
 
-    return currentContext->IsStackAvailable(size);
+    return currentContext->IsStackAvailable(size) ||
+        (currentContext->ServiceStackSampleRequest(nullptr, nullptr) && currentContext->IsStackAvailable(size));
 }
 
 /*
@@ -1596,7 +1602,11 @@ ThreadContext::ProbeStackNoDispose(size_t size, Js::ScriptContext *scriptContext
             throw Js::ScriptAbortException();
         }
 
-        Js::Throw::StackOverflow(scriptContext, returnAddress);
+        // The limit may have been hammered to request a stack sample instead; take it and probe again.
+        if (!this->ServiceStackSampleRequest(scriptContext, returnAddress) || !this->IsStackAvailable(size))
+        {
+            Js::Throw::StackOverflow(scriptContext, returnAddress);
+        }
     }
 
     // Use every Nth stack probe as a QC trigger.
@@ -1640,6 +1650,11 @@ ThreadContext::ProbeStack(size_t size, Js::RecyclableObject * obj, Js::ScriptCon
             throw Js::ScriptAbortException();
         }
 
+        if (this->ServiceStackSampleRequest(scriptContext, nullptr) && this->IsStackAvailable(size))
+        {
+            return;
+        }
+
         if (obj->IsExternal() ||
             (Js::JavascriptOperators::GetTypeId(obj) == Js::TypeIds_Function &&
             Js::JavascriptFunction::FromVar(obj)->IsExternalFunction()))
@@ -4034,6 +4049,9 @@ void ThreadContext::DisableExecution()
 {
     Assert(TestThreadContextFlag(ThreadContextFlagCanDisableExecution));
     // Hammer the stack limit with a value that will cause script abort on the next stack probe.
+    // The flag must be visible first so that a stack sample being serviced puts the hammer back.
+    this->isExecutionDisabledByHost = true;
+    MemoryBarrier();
     this->SetStackLimitForCurrentThread(Js::Constants::StackLimitForScriptInterrupt);
 
     return;
@@ -4043,6 +4061,7 @@ void ThreadContext::EnableExecution()
 {
     Assert(this->GetStackProber());
     // Restore the normal stack limit.
+    this->isExecutionDisabledByHost = false;
     this->SetStackLimitForCurrentThread(this->GetStackProber()->GetScriptStackLimit());
 
     // It's possible that the host disabled execution after the script threw an exception
@@ -4054,6 +4073,64 @@ void ThreadContext::EnableExecution()
     }
 }
 
+void ThreadContext::SetStackSampleCallBack(StackSampleCallBackFunction callback, void * context)
+{
+    this->stackSampleCallBack = callback;
+    this->stackSampleCallBackContext = context;
+
+    if (callback == nullptr)
+    {
+        // Drop a request that is still pending so the hammered limit isn't taken for script termination.
+        InterlockedExchange(&this->isStackSampleRequested, FALSE);
+        if (!this->isExecutionDisabledByHost && this->GetStackProber())
+        {
+            this->SetStackLimitForCurrentThread(this->GetStackProber()->GetScriptStackLimit());
+        }
+    }
+}
+
+// Called from any thread. Like DisableExecution, this hammers the stack limit so that the next stack
+// probe, or loop probe in JIT'd code, on the script thread fails and services the request.
+void ThreadContext::RequestStackSample()
+{
+    if (this->stackSampleCallBack == nullptr)
+    {
+        return;
+    }
+
+    InterlockedExchange(&this->isStackSampleRequested, TRUE);
+    MemoryBarrier();
+    this->SetStackLimitForCurrentThread(Js::Constants::StackLimitForScriptInterrupt);
+}
+
+// Returns true if the stack limit was hammered for a stack sample rather than to disable execution.
+// The normal limit is restored before the sample is taken. Probes outside of script, like the
+// parser's, pass a null script context and leave the request for the next sampler tick.
+bool ThreadContext::ServiceStackSampleRequest(Js::ScriptContext * scriptContext, PVOID returnAddress)
+{
+    if (this->stackSampleCallBack == nullptr || this->isExecutionDisabledByHost ||
+        this->stackLimitForCurrentThread != Js::Constants::StackLimitForScriptInterrupt)
+    {
+        return false;
+    }
+
+    this->SetStackLimitForCurrentThread(this->GetStackProber()->GetScriptStackLimit());
+    MemoryBarrier();
+    if (this->isExecutionDisabledByHost)
+    {
+        // The host disabled execution while we were restoring the limit; put the hammer back.
+        this->SetStackLimitForCurrentThread(Js::Constants::StackLimitForScriptInterrupt);
+        return false;
+    }
+
+    if (scriptContext != nullptr && this->IsScriptActive() &&
+        InterlockedExchange(&this->isStackSampleRequested, FALSE))
+    {
+        this->stackSampleCallBack(this->stackSampleCallBackContext, scriptContext, returnAddress);
+    }
+    return true;
+}
+
 bool ThreadContext::TestThreadContextFlag(ThreadContextFlags contextFlag) const
 {
     return (this->threadContextFlags & contextFlag) != 0;
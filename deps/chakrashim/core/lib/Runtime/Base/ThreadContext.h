@@ -39,6 +39,7 @@ enum ThreadContextFlags
     ThreadContextFlagCanDisableExecution           = 0x00000001,
     ThreadContextFlagEvalDisabled                  = 0x00000002,
     ThreadContextFlagNoJIT                         = 0x00000004,
+    ThreadContextFlagParallelParse                 = 0x00000008,
 };
 
 const int LS_MAX_STACK_SIZE_KB = 300;
@@ -178,6 +179,9 @@ enum RecyclerCollectCallBackFlags
 };
 typedef void (__cdecl *RecyclerCollectCallBackFunction)(void * context, RecyclerCollectCallBackFlags flags);
 
+// Called on the script thread, from the stack or loop probe that noticed a pending stack sample request
+typedef void (__cdecl *StackSampleCallBackFunction)(void * context, Js::ScriptContext * scriptContext, PVOID returnAddress);
+
 // Keep in sync with WellKnownType in scriptdirect.idl
 
 typedef enum WellKnownHostType
@@ -699,6 +703,7 @@ private:
     static size_t processNativeCodeSize;
     size_t nativeCodeSize;
     size_t sourceCodeSize;
+    uint backgroundParsedFunctionCount;
 
     DateTime::HiResTimer hTimer;
 
@@ -738,6 +743,11 @@ private:
 
     void* jsrtRuntime;
 
+    StackSampleCallBackFunction stackSampleCallBack;
+    void * stackSampleCallBackContext;
+    LONG volatile isStackSampleRequested;
+    bool volatile isExecutionDisabledByHost;
+
     bool hasUnhandledException;
     bool hasCatchHandler;
     DisableImplicitFlags disableImplicitFlags;
@@ -954,6 +964,11 @@ public:
         return this->TestThreadContextFlag(ThreadContextFlagNoJIT);
     }
 
+    bool ParallelParseEnabled() const
+    {
+        return this->TestThreadContextFlag(ThreadContextFlagParallelParse);
+    }
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     Js::Var GetMemoryStat(Js::ScriptContext* scriptContext);
     void SetAutoProxyName(LPCWSTR objectName);
@@ -1190,6 +1205,10 @@ public:
     static size_t  GetProcessCodeSize() { return processNativeCodeSize; }
     size_t GetSourceSize() { return sourceCodeSize; }
 
+    // Called from the background parse threads
+    void LogBackgroundParsedFunction() { ::InterlockedIncrement(&backgroundParsedFunctionCount); }
+    uint GetBackgroundParsedFunctionCount() const { return backgroundParsedFunctionCount; }
+
     Js::ScriptEntryExitRecord * GetScriptEntryExit() const { return entryExitRecord; }
     void RegisterCodeGenRecyclableData(Js::CodeGenRecyclableData *const codeGenRecyclableData);
     void UnregisterCodeGenRecyclableData(Js::CodeGenRecyclableData *const codeGenRecyclableData);
@@ -1566,10 +1585,17 @@ public:
     void SetIsScriptActive(bool isActive) { isScriptActive = isActive; }
     bool IsExecutionDisabled() const
     {
-        return this->GetStackLimitForCurrentThread() == Js::Constants::StackLimitForScriptInterrupt;
+        // With a stack sampler installed the limit is also hammered to request samples, so only
+        // the host's own request tells script termination apart.
+        return this->GetStackLimitForCurrentThread() == Js::Constants::StackLimitForScriptInterrupt &&
+            (this->isExecutionDisabledByHost || this->stackSampleCallBack == nullptr);
     }
     void DisableExecution();
     void EnableExecution();
+
+    void SetStackSampleCallBack(StackSampleCallBackFunction callback, void * context);
+    void RequestStackSample();
+    bool ServiceStackSampleRequest(Js::ScriptContext * scriptContext, PVOID returnAddress);
     bool TestThreadContextFlag(ThreadContextFlags threadContextFlag) const;
     void SetThreadContextFlag(ThreadContextFlags threadContextFlag);
     void ClearThreadContextFlag(ThreadContextFlags threadContextFlag);
@@ -3846,6 +3846,8 @@ public:
                     current = ReadUInt32(current, &endOffset);
                     loopHeaderArray[i].startOffset = startOffset;
                     loopHeaderArray[i].endOffset = endOffset;
+                    // Yield information isn't serialized; keep every loop of a generator in the interpreter.
+                    loopHeaderArray[i].hasYield = (*functionBody)->IsGenerator();
                 }
             }
 
@@ -246,6 +246,7 @@ namespace Js
             loopHeader->startOffset = data.startOffset;
             loopHeader->endOffset = data.endOffset;
             loopHeader->isNested = data.isNested;
+            loopHeader->hasYield = data.hasYield;
         });
     }
 
@@ -405,6 +406,11 @@ namespace Js
             }
         }
 
+        if (op == OpCode::Yield)
+        {
+            MarkLoopsWithYield();
+        }
+
         R0 = ConsumeReg(R0);
         R1 = ConsumeReg(R1);
 
@@ -816,6 +822,11 @@ namespace Js
         Assert(OpCodeAttr::HasMultiSizeLayout(op));
         CheckLabel(labelID);
 
+        if (op == OpCode::TryFinallyWithYield)
+        {
+            MarkLoopsWithYield();
+        }
+
         R1 = ConsumeReg(R1);
         R2 = ConsumeReg(R2);
 
@@ -3119,6 +3130,24 @@ StoreCommon:
         m_loopHeaders->Item(loopId).endOffset = m_byteCodeData.GetCurrentOffset();
     }
 
+    void ByteCodeWriter::MarkLoopsWithYield()
+    {
+        // Loops that can suspend the generator have to be resumed in the interpreter, so they
+        // can't be jitted as loop bodies. Every loop that is still open contains this yield.
+        if (m_loopNest == 0)
+        {
+            return;
+        }
+
+        m_loopHeaders->Map([](int index, ByteCodeWriter::LoopHeaderData& data)
+        {
+            if (data.endOffset == 0)
+            {
+                data.hasYield = true;
+            }
+        });
+    }
+
     void ByteCodeWriter::IncreaseByteCodeCount()
     {
         m_byteCodeCount++;
@@ -539,9 +539,11 @@ namespace Js
         localPolyCallSiteInfo->functionIds[1] = functionId;
         localPolyCallSiteInfo->sourceIds[0] = oldSourceId;
         localPolyCallSiteInfo->sourceIds[1] = sourceId;
+        localPolyCallSiteInfo->callCounts[0] = 1;
+        localPolyCallSiteInfo->callCounts[1] = 1;
         localPolyCallSiteInfo->next = funcBody->GetPolymorphicCallSiteInfoHead();
 
-        for (int i = 2; i < maxPolymorphicInliningSize; i++)
+        for (int i = 2; i < maxPolymorphicCallSiteProfileSize; i++)
         {
             localPolyCallSiteInfo->functionIds[i] = CallSiteNoInfo;
         }
@@ -575,18 +577,24 @@ namespace Js
 
     void DynamicProfileInfo::SetFunctionIdSlotForNewPolymorphicCall(ProfileId callSiteId, Js::LocalFunctionId curFunctionId, Js::SourceId curSourceId, Js::FunctionBody *inliner)
     {
-        for (int i = 0; i < maxPolymorphicInliningSize; i++)
+        PolymorphicCallSiteInfo *polymorphicCallSiteInfo = callSiteInfo[callSiteId].u.polymorphicCallSiteInfo;
+        for (int i = 0; i < maxPolymorphicCallSiteProfileSize; i++)
         {
-            if (callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->functionIds[i] == curFunctionId &&
-                callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->sourceIds[i] == curSourceId)
+            if (polymorphicCallSiteInfo->functionIds[i] == curFunctionId &&
+                polymorphicCallSiteInfo->sourceIds[i] == curSourceId)
             {
-                // we have it already
+                // we have it already, count the call so that the hottest targets get inlined
+                if (polymorphicCallSiteInfo->callCounts[i] < UINT16_MAX)
+                {
+                    polymorphicCallSiteInfo->callCounts[i]++;
+                }
                 return;
             }
-            else if (callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->functionIds[i] == CallSiteNoInfo)
+            else if (polymorphicCallSiteInfo->functionIds[i] == CallSiteNoInfo)
             {
-                callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->functionIds[i] = curFunctionId;
-                callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->sourceIds[i] = curSourceId;
+                polymorphicCallSiteInfo->functionIds[i] = curFunctionId;
+                polymorphicCallSiteInfo->sourceIds[i] = curSourceId;
+                polymorphicCallSiteInfo->callCounts[i] = 1;
                 this->currentInlinerVersion++;
                 return;
             }
@@ -597,7 +605,8 @@ namespace Js
         {
             char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
 
-            Output::Print(_u("INLINING (Polymorphic): More than 4 functions at this call site \t callSiteId: %d\t calleeFunctionId: %d TopFunc %s (%s)\n"),
+            Output::Print(_u("INLINING (Polymorphic): More than %d functions at this call site \t callSiteId: %d\t calleeFunctionId: %d TopFunc %s (%s)\n"),
+                maxPolymorphicCallSiteProfileSize,
                 callSiteId,
                 curFunctionId,
                 inliner->GetDisplayName(),
@@ -655,15 +664,18 @@ namespace Js
         return !functionBody->GetScriptContext()->IsNoContextSourceContextInfo(sourceContextInfo);
     }
 
-    bool DynamicProfileInfo::GetPolymorphicCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId, bool *isConstructorCall, __inout_ecount(functionBodyArrayLength) FunctionBody** functionBodyArray, uint functionBodyArrayLength)
+    // Fills functionBodyArray with the hottest targets of the call site, and targetCount with the number of targets recorded.
+    bool DynamicProfileInfo::GetPolymorphicCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId, bool *isConstructorCall, __inout_ecount(functionBodyArrayLength) FunctionBody** functionBodyArray, uint functionBodyArrayLength, uint *targetCount)
     {
         Assert(functionBody);
         const auto callSiteCount = functionBody->GetProfiledCallSiteCount();
         Assert(callSiteId < callSiteCount);
         Assert(HasCallSiteInfo(functionBody));
         Assert(functionBodyArray);
-        Assert(functionBodyArrayLength == DynamicProfileInfo::maxPolymorphicInliningSize);
+        Assert(functionBodyArrayLength <= DynamicProfileInfo::maxPolymorphicInliningSize);
+        Assert(targetCount);
 
+        *targetCount = 0;
         *isConstructorCall = callSiteInfo[callSiteId].isConstructorCall;
         if (callSiteInfo[callSiteId].dontInline)
         {
@@ -673,15 +685,28 @@ namespace Js
         {
             PolymorphicCallSiteInfo *polymorphicCallSiteInfo = callSiteInfo[callSiteId].u.polymorphicCallSiteInfo;
 
-            for (uint i = 0; i < functionBodyArrayLength; i++)
+            // Rank the targets by call count with an insertion sort, keeping the recording order for equal counts
+            uint rankedTargets[maxPolymorphicCallSiteProfileSize];
+            uint recordedTargetCount = 0;
+            Js::LocalFunctionId localFunctionId;
+            Js::SourceId localSourceId;
+            while (recordedTargetCount < maxPolymorphicCallSiteProfileSize &&
+                polymorphicCallSiteInfo->GetFunction(recordedTargetCount, &localFunctionId, &localSourceId))
             {
-                Js::LocalFunctionId localFunctionId;
-                Js::SourceId localSourceId;
-                if (!polymorphicCallSiteInfo->GetFunction(i, &localFunctionId, &localSourceId))
+                uint j = recordedTargetCount;
+                for (; j > 0 && polymorphicCallSiteInfo->callCounts[rankedTargets[j - 1]] < polymorphicCallSiteInfo->callCounts[recordedTargetCount]; j--)
                 {
-                    AssertMsg(i >= 2, "We found at least two function Body");
-                    return true;
+                    rankedTargets[j] = rankedTargets[j - 1];
                 }
+                rankedTargets[j] = recordedTargetCount;
+                recordedTargetCount++;
+            }
+            AssertMsg(recordedTargetCount >= 2, "We found at least two function Body");
+            *targetCount = recordedTargetCount;
+
+            for (uint i = 0; i < functionBodyArrayLength && i < recordedTargetCount; i++)
+            {
+                polymorphicCallSiteInfo->GetFunction(rankedTargets[i], &localFunctionId, &localSourceId);
 
                 FunctionBody* matchedFunctionBody;
 
@@ -1214,11 +1239,12 @@ namespace Js
                 else
                 {
                     Output::Print(_u(" poly"));
-                    for (int j = 0; j < DynamicProfileInfo::maxPolymorphicInliningSize; j++)
+                    for (int j = 0; j < DynamicProfileInfo::maxPolymorphicCallSiteProfileSize; j++)
                     {
                         if (callSiteInfo[i].u.polymorphicCallSiteInfo->functionIds[j] != CallSiteNoInfo)
                         {
-                            Output::Print(_u(" %4d:%4d"), callSiteInfo[i].u.polymorphicCallSiteInfo->sourceIds[j], callSiteInfo[i].u.polymorphicCallSiteInfo->functionIds[j]);
+                            Output::Print(_u(" %4d:%4d(%d)"), callSiteInfo[i].u.polymorphicCallSiteInfo->sourceIds[j], callSiteInfo[i].u.polymorphicCallSiteInfo->functionIds[j],
+                                callSiteInfo[i].u.polymorphicCallSiteInfo->callCounts[j]);
                         }
                     }
                 }
@@ -2215,7 +2241,7 @@ IR::BailOutKind IR::EquivalentToMonoTypeCheckBailOutKind(IR::BailOutKind kind)
     }
 }
 
-#if ENABLE_DEBUG_CONFIG_OPTIONS
+// The names are also used by the JIT telemetry, so they are kept in release builds
 const char *const BailOutKindNames[] =
 {
 #define BAIL_OUT_KIND_LAST(n)               "" STRINGIZE(n) ""
@@ -2225,6 +2251,7 @@ const char *const BailOutKindNames[] =
 #include "BailOutKind.h"
 };
 
+#if ENABLE_DEBUG_CONFIG_OPTIONS
 IR::BailOutKind const BailOutKindValidBits[] =
 {
 #define BAIL_OUT_KIND(n, bits)               (IR::BailOutKind)bits,
@@ -2243,6 +2270,7 @@ bool IsValidBailOutKindAndBits(IR::BailOutKind bailOutKind)
     }
     return ((bailOutKind & IR::BailOutKindBits) & ~BailOutKindValidBits[kindNoBits]) == 0;
 }
+#endif
 
 // Concats into the buffer, specified by the name parameter, the name of 'bit' bailout kind, specified by the enumEntryOffsetFromBitsStart parameter.
 // Returns the number of bytes printed to the buffer.
@@ -2428,4 +2456,3 @@ const char* GetBailOutKindName(IR::BailOutKind kind)
     return name;
 }
 #endif
-#endif
@@ -36,8 +36,9 @@ namespace IR
     BailOutKind EquivalentToMonoTypeCheckBailOutKind(BailOutKind kind);
 }
 
-#if ENABLE_DEBUG_CONFIG_OPTIONS
+// Returns a static buffer for kinds with bits, so only call this from the script thread
 const char *GetBailOutKindName(IR::BailOutKind kind);
+#if ENABLE_DEBUG_CONFIG_OPTIONS
 bool IsValidBailOutKindAndBits(IR::BailOutKind bailOutKind);
 #endif
 
@@ -363,7 +364,7 @@ namespace Js
         FunctionInfo * GetCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId, bool *isConstructorCall, bool *isPolymorphicCall);
         uint16 GetConstantArgInfo(ProfileId callSiteId);
         uint GetLdFldCacheIndexFromCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId);
-        bool GetPolymorphicCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId, bool *isConstructorCall, __inout_ecount(functionBodyArrayLength) FunctionBody** functionBodyArray, uint functionBodyArrayLength);
+        bool GetPolymorphicCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId, bool *isConstructorCall, __inout_ecount(functionBodyArrayLength) FunctionBody** functionBodyArray, uint functionBodyArrayLength, uint *targetCount);
 
         bool RecordLdFldCallSiteInfo(FunctionBody* functionBody, RecyclableObject* callee, bool callApplyTarget);
 
@@ -401,7 +402,12 @@ namespace Js
         static FldInfoFlags FldInfoFlagsFromSlotType(SlotType slotType);
         static FldInfoFlags MergeFldInfoFlags(FldInfoFlags oldFlags, FldInfoFlags newFlags);
 
+        // Polymorphic call sites record up to maxPolymorphicCallSiteProfileSize targets with their call counts. The hottest
+        // -PolymorphicInlineTargetCount of them are inlined, and calls to the others go through a fallback call.
+        // maxPolymorphicInliningSize caps that flag: it sizes the inlinee arrays built on the stack while collecting jit
+        // time data and the dispatch chain the inliner emits, and each extra target adds a type check to every call.
         const static uint maxPolymorphicInliningSize = 4;
+        const static uint maxPolymorphicCallSiteProfileSize = 16;
 
 #if DBG_DUMP
         static void DumpScriptContext(ScriptContext * scriptContext);
@@ -804,12 +810,13 @@ namespace Js
 
     struct PolymorphicCallSiteInfo
     {
-        Js::LocalFunctionId functionIds[DynamicProfileInfo::maxPolymorphicInliningSize];
-        Js::SourceId sourceIds[DynamicProfileInfo::maxPolymorphicInliningSize];
+        Js::LocalFunctionId functionIds[DynamicProfileInfo::maxPolymorphicCallSiteProfileSize];
+        Js::SourceId sourceIds[DynamicProfileInfo::maxPolymorphicCallSiteProfileSize];
+        uint16 callCounts[DynamicProfileInfo::maxPolymorphicCallSiteProfileSize];   // Saturating
         PolymorphicCallSiteInfo *next;
         bool GetFunction(uint index, Js::LocalFunctionId *functionId, Js::SourceId *sourceId)
         {
-            Assert(index < DynamicProfileInfo::maxPolymorphicInliningSize);
+            Assert(index < DynamicProfileInfo::maxPolymorphicCallSiteProfileSize);
             Assert(functionId);
             Assert(sourceId);
             if (DynamicProfileInfo::IsCallSiteNoInfo(functionIds[index]))
@@ -807,7 +807,7 @@ namespace Js
 
     FunctionCodeGenJitTimeData::FunctionCodeGenJitTimeData(FunctionInfo *const functionInfo, EntryPointInfo *const entryPoint, bool isInlined) :
         functionInfo(functionInfo), entryPointInfo(entryPoint), globalObjTypeSpecFldInfoCount(0), globalObjTypeSpecFldInfoArray(nullptr),
-        weakFuncRef(nullptr), inlinees(nullptr), inlineeCount(0), ldFldInlineeCount(0), isInlined(isInlined), isAggressiveInliningEnabled(false),
+        weakFuncRef(nullptr), inlinees(nullptr), inlineeCount(0), ldFldInlineeCount(0), isInlined(isInlined), polymorphicCallFallbackBv(nullptr), isAggressiveInliningEnabled(false),
 #ifdef FIELD_ACCESS_STATS
         inlineCacheStats(nullptr),
 #endif
@@ -834,6 +834,27 @@ namespace Js
         return inlinees ? inlinees[profiledCallSiteId]->next != nullptr : false;
     }
 
+    bool FunctionCodeGenJitTimeData::HasPolymorphicCallFallback(const ProfileId profiledCallSiteId) const
+    {
+        Assert(GetFunctionBody());
+        Assert(profiledCallSiteId < GetFunctionBody()->GetProfiledCallSiteCount());
+
+        return polymorphicCallFallbackBv ? !!polymorphicCallFallbackBv->Test(profiledCallSiteId) : false;
+    }
+
+    void FunctionCodeGenJitTimeData::SetHasPolymorphicCallFallback(Recycler *const recycler, const ProfileId profiledCallSiteId)
+    {
+        Assert(recycler);
+        Assert(GetFunctionBody());
+        Assert(profiledCallSiteId < GetFunctionBody()->GetProfiledCallSiteCount());
+
+        if (!polymorphicCallFallbackBv)
+        {
+            polymorphicCallFallbackBv = BVFixed::New<Recycler>(GetFunctionBody()->GetProfiledCallSiteCount(), recycler);
+        }
+        polymorphicCallFallbackBv->Set(profiledCallSiteId);
+    }
+
     const FunctionCodeGenJitTimeData *FunctionCodeGenJitTimeData::GetInlinee(const ProfileId profiledCallSiteId) const
     {
         Assert(GetFunctionBody());
@@ -529,6 +529,10 @@ namespace Js
         FunctionCodeGenJitTimeData *next;
         bool isInlined;
 
+        // Polymorphic call sites that saw more targets than were inlined. Calls to the other targets go through a
+        // fallback call instead of bailing out.
+        BVFixed *polymorphicCallFallbackBv;
+
         // This indicates the function is aggressively Inlined(see NativeCodeGenerator::TryAggressiveInlining) .
         bool isAggressiveInliningEnabled;
 
@@ -581,6 +585,8 @@ namespace Js
             FunctionInfo *const inlinee);
 
         bool IsPolymorphicCallSite(const ProfileId profiledCallSiteId) const;
+        bool HasPolymorphicCallFallback(const ProfileId profiledCallSiteId) const;
+        void SetHasPolymorphicCallFallback(Recycler *const recycler, const ProfileId profiledCallSiteId);
         // This function walks all the chained jittimedata and returns the one which match the functionInfo.
         // This can return null, if the functionInfo doesn't match.
         const FunctionCodeGenJitTimeData *GetJitTimeDataFromFunctionInfo(FunctionInfo *polyFunctionInfo) const;
@@ -5650,6 +5650,12 @@ namespace Js
             return;
         }
 
+        if (this->m_functionBody->IsGenerator() && this->m_functionBody->GetLoopHeader(loopNumber)->hasYield)
+        {
+            // The generator may suspend inside this loop, so it has to keep running in the interpreter.
+            return;
+        }
+
         LoopHeader const * loopHeader = DoLoopBodyStart(loopNumber, layoutSize, false, isFirstIteration);
         Assert(loopHeader == nullptr || this->m_functionBody->GetLoopNumber(loopHeader) == loopNumber);
         if (loopHeader != nullptr)
@@ -5722,6 +5728,12 @@ const byte * InterpreterStackFrame::OP_ProfiledLoopBodyStart(const byte * ip)
             return;
         }
 
+        if (this->m_functionBody->IsGenerator() && this->m_functionBody->GetLoopHeader(loopNumber)->hasYield)
+        {
+            // The generator may suspend inside this loop, so it has to keep running in the interpreter.
+            return;
+        }
+
         DoLoopBodyStart(loopNumber, layoutSize, true, isFirstIteration);
     }
 
@@ -5821,6 +5833,12 @@ const byte * InterpreterStackFrame::OP_ProfiledLoopBodyStart(const byte * ip)
 
             entryPointInfo->EnsureIsReadyToCall();
 
+            FunctionJitTelemetry * jitTelemetry = fn->GetJitTelemetry();
+            if (jitTelemetry != nullptr)
+            {
+                jitTelemetry->LogLoopBodyEntry();
+            }
+
             RegSlot envReg = this->m_functionBody->GetEnvRegister();
             if (envReg != Constants::NoRegister)
             {
@@ -4809,6 +4809,190 @@ CommonNumber:
         return returnValue;
     }
 
+#define MEMVECTOR_OPERATION(name, op, sse2op) \
+    struct Memvector ## name \
+    { \
+        static double Apply(double a, double b) { return a op b; } \
+        MEMVECTOR_SSE2_OPERATION(sse2op) \
+    };
+#if defined(_M_IX86) || defined(_M_X64)
+#define MEMVECTOR_SSE2_OPERATION(sse2op) static __m128d Apply(__m128d a, __m128d b) { return sse2op(a, b); }
+#else
+#define MEMVECTOR_SSE2_OPERATION(sse2op)
+#endif
+    MEMVECTOR_OPERATION(Add, +, _mm_add_pd)
+    MEMVECTOR_OPERATION(Sub, -, _mm_sub_pd)
+    MEMVECTOR_OPERATION(Mul, *, _mm_mul_pd)
+    MEMVECTOR_OPERATION(Div, /, _mm_div_pd)
+#undef MEMVECTOR_SSE2_OPERATION
+#undef MEMVECTOR_OPERATION
+
+#if defined(_M_IX86) || defined(_M_X64)
+    // The SSE2 loops return the number of elements processed; the caller finishes the tail.
+    template <typename TOperation>
+    static uint32 MemvectorSSE2(double* dst, const double* src1, const double* src2, double scalar, uint32 length)
+    {
+        const __m128d scalarValue = _mm_set1_pd(scalar);
+        uint32 i = 0;
+        for (; i + 2 <= length; i += 2)
+        {
+            __m128d a = _mm_loadu_pd(src1 + i);
+            __m128d b = src2 ? _mm_loadu_pd(src2 + i) : scalarValue;
+            _mm_storeu_pd(dst + i, TOperation::Apply(a, b));
+        }
+        return i;
+    }
+
+    template <typename TOperation>
+    static uint32 MemvectorSSE2(float* dst, const float* src1, const float* src2, double scalar, uint32 length)
+    {
+        // Widen to double and round once on the store, which is what the jitted loop body does.
+        const __m128d scalarValue = _mm_set1_pd(scalar);
+        uint32 i = 0;
+        for (; i + 4 <= length; i += 4)
+        {
+            __m128 a = _mm_loadu_ps(src1 + i);
+            __m128d aLow = _mm_cvtps_pd(a);
+            __m128d aHigh = _mm_cvtps_pd(_mm_movehl_ps(a, a));
+            __m128d bLow = scalarValue;
+            __m128d bHigh = scalarValue;
+            if (src2)
+            {
+                __m128 b = _mm_loadu_ps(src2 + i);
+                bLow = _mm_cvtps_pd(b);
+                bHigh = _mm_cvtps_pd(_mm_movehl_ps(b, b));
+            }
+            __m128 low = _mm_cvtpd_ps(TOperation::Apply(aLow, bLow));
+            __m128 high = _mm_cvtpd_ps(TOperation::Apply(aHigh, bHigh));
+            _mm_storeu_ps(dst + i, _mm_movelh_ps(low, high));
+        }
+        return i;
+    }
+#endif
+
+    template <typename TOperation, typename T>
+    static void MemvectorLoop(T* dst, const T* src1, const T* src2, double scalar, uint32 length)
+    {
+        uint32 i = 0;
+#if defined(_M_IX86) || defined(_M_X64)
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            i = MemvectorSSE2<TOperation>(dst, src1, src2, scalar, length);
+        }
+#endif
+        for (; i < length; i++)
+        {
+            dst[i] = (T)TOperation::Apply((double)src1[i], src2 ? (double)src2[i] : scalar);
+        }
+    }
+
+    template <typename T>
+    static void Memvector(T* dst, const T* src1, const T* src2, double scalar, uint32 length, int32 op)
+    {
+        switch (op & MemvectorOp_KindMask)
+        {
+        case MemvectorOp_Add:
+            MemvectorLoop<MemvectorAdd>(dst, src1, src2, scalar, length);
+            break;
+        case MemvectorOp_Sub:
+            MemvectorLoop<MemvectorSub>(dst, src1, src2, scalar, length);
+            break;
+        case MemvectorOp_Mul:
+            MemvectorLoop<MemvectorMul>(dst, src1, src2, scalar, length);
+            break;
+        case MemvectorOp_Div:
+            MemvectorLoop<MemvectorDiv>(dst, src1, src2, scalar, length);
+            break;
+        default:
+            Assert(UNREACHED);
+            break;
+        }
+    }
+
+    static bool IsMemvectorOverlapping(TypedArrayBase* dstArray, TypedArrayBase* srcArray, uint32 start, uint32 length)
+    {
+        // Reading and writing the same element is fine; any other overlap depends on the iteration order.
+        byte* dstBuffer = dstArray->GetByteBuffer();
+        byte* srcBuffer = srcArray->GetByteBuffer();
+        if (dstBuffer == srcBuffer)
+        {
+            return false;
+        }
+        const uint32 elementSize = dstArray->GetBytesPerElement();
+        byte* dstBegin = dstBuffer + start * elementSize;
+        byte* srcBegin = srcBuffer + start * elementSize;
+        return dstBegin < srcBegin + length * elementSize && srcBegin < dstBegin + length * elementSize;
+    }
+
+    BOOL JavascriptOperators::OP_Memvector(Var dstInstance, int32 start, Var src1Instance, Var src2, int32 length, int32 op, ScriptContext* scriptContext)
+    {
+        // Returning false bails out to the loop, so anything unexpected is left to the interpreter
+        if (length <= 0 || start < 0)
+        {
+            return false;
+        }
+
+        TypeId instanceType = JavascriptOperators::GetTypeId(dstInstance);
+        if ((instanceType != TypeIds_Float32Array && instanceType != TypeIds_Float64Array) ||
+            instanceType != JavascriptOperators::GetTypeId(src1Instance))
+        {
+            return false;
+        }
+
+        TypedArrayBase* dstArray = TypedArrayBase::FromVar(dstInstance);
+        TypedArrayBase* src1Array = TypedArrayBase::FromVar(src1Instance);
+        TypedArrayBase* src2Array = nullptr;
+        double scalar = 0;
+        if (op & MemvectorOp_ScalarSrc)
+        {
+            if (!TaggedNumber::Is(src2) && !JavascriptNumber::Is(src2))
+            {
+                return false;
+            }
+            scalar = JavascriptConversion::ToNumber(src2, scriptContext);
+        }
+        else
+        {
+            if (instanceType != JavascriptOperators::GetTypeId(src2))
+            {
+                return false;
+            }
+            src2Array = TypedArrayBase::FromVar(src2);
+        }
+
+        // Detached buffers have a length of 0, so this also covers them
+        const uint32 end = (uint32)start + (uint32)length;
+        if (end < (uint32)start ||
+            end > dstArray->GetLength() ||
+            end > src1Array->GetLength() ||
+            (src2Array && end > src2Array->GetLength()))
+        {
+            return false;
+        }
+
+        if (IsMemvectorOverlapping(dstArray, src1Array, start, length) ||
+            (src2Array && IsMemvectorOverlapping(dstArray, src2Array, start, length)))
+        {
+            return false;
+        }
+
+        if (instanceType == TypeIds_Float32Array)
+        {
+            float* dst = (float*)dstArray->GetByteBuffer() + start;
+            float* src1 = (float*)src1Array->GetByteBuffer() + start;
+            float* src2Buffer = src2Array ? (float*)src2Array->GetByteBuffer() + start : nullptr;
+            Memvector(dst, src1, src2Buffer, scalar, length, op);
+        }
+        else
+        {
+            double* dst = (double*)dstArray->GetByteBuffer() + start;
+            double* src1 = (double*)src1Array->GetByteBuffer() + start;
+            double* src2Buffer = src2Array ? (double*)src2Array->GetByteBuffer() + start : nullptr;
+            Memvector(dst, src1, src2Buffer, scalar, length, op);
+        }
+        return true;
+    }
+
     Var JavascriptOperators::OP_DeleteElementI_UInt32(Var instance, uint32 index, ScriptContext* scriptContext, PropertyOperationFlags propertyOperationFlags)
     {
 #if FLOATVAR
@@ -9319,6 +9503,15 @@ CommonNumber:
 
     void JavascriptOperators::ScriptAbort()
     {
+        // JIT'd loop probes also fail when the stack limit was hammered for a stack sample; service it and
+        // let the loop continue.
+        ThreadContext * threadContext = ThreadContext::GetContextForCurrentThread();
+        if (!threadContext->IsExecutionDisabled() &&
+            threadContext->ServiceStackSampleRequest(threadContext->GetScriptEntryExit()->scriptContext, nullptr))
+        {
+            return;
+        }
+
         throw ScriptAbortException();
     }
 
@@ -15,6 +15,18 @@ namespace Js
 {
     struct ResumeYieldData;
 
+    // Element-wise operation performed by OP_Memvector. MemvectorOp_ScalarSrc is set when the second
+    // operand is a number instead of a typed array.
+    enum MemvectorOp : int32
+    {
+        MemvectorOp_Add,
+        MemvectorOp_Sub,
+        MemvectorOp_Mul,
+        MemvectorOp_Div,
+        MemvectorOp_KindMask = 0xF,
+        MemvectorOp_ScalarSrc = 0x10
+    };
+
 #define DeclareExceptionPointer(ep)                  \
     EXCEPTION_RECORD        ep##er;                 \
     CONTEXT                 ep##c;                  \
@@ -333,6 +345,7 @@ namespace Js
         static Var OP_DeleteElementI_Int32(Var instance, int aElementIndex, ScriptContext* scriptContext, PropertyOperationFlags propertyOperationFlags = PropertyOperation_None);
         static BOOL OP_Memset(Var instance, int32 start, Var value, int32 length, ScriptContext* scriptContext);
         static BOOL OP_Memcopy(Var dstInstance, int32 dstStart, Var srcInstance, int32 srcStart, int32 length, ScriptContext* scriptContext);
+        static BOOL OP_Memvector(Var dstInstance, int32 start, Var src1Instance, Var src2, int32 length, int32 op, ScriptContext* scriptContext);
         static Var OP_GetLength(Var instance, ScriptContext* scriptContext);
         static Var OP_GetThis(Var thisVar, int moduleID, ScriptContext* scriptContext);
         static Var OP_GetThisNoFastPath(Var thisVar, int moduleID, ScriptContext* scriptContext);
@@ -110,6 +110,8 @@ namespace Js
         virtual BOOL GetDiagValueString(StringBuilder<ArenaAllocator>* stringBuilder, ScriptContext* requestContext) override;
 
         virtual ArrayBufferDetachedStateBase* DetachAndGetState();
+        // Whether the buffer owns its memory and can hand it over through DetachAndGetState
+        virtual bool IsTransferable() const { return true; }
         bool IsDetached() { return this->isDetached; }
         void SetIsAsmJsBuffer(){ mIsAsmJsBuffer = true; }
         uint32 GetByteLength() const { return bufferLength; }
@@ -297,6 +299,7 @@ namespace Js
         DEFINE_MARSHAL_OBJECT_TO_SCRIPT_CONTEXT(ExternalArrayBuffer);
     public:
         ExternalArrayBuffer(byte *buffer, uint32 length, DynamicType *type);
+        virtual bool IsTransferable() const override { return false; }
     protected:
         virtual ArrayBufferDetachedStateBase* CreateDetachedState(BYTE* buffer, uint32 bufferLength) override { Assert(UNREACHED); Throw::InternalError(); };
         virtual ArrayBuffer * TransferInternal(uint32 newBufferLength) override { Assert(UNREACHED); Throw::InternalError(); };
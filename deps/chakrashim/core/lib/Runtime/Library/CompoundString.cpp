@@ -1046,13 +1046,13 @@ namespace Js
         return buffer;
     }
 
-    void CompoundString::CopyVirtual(
-        _Out_writes_(m_charLength) char16 *const buffer,
-        StringCopyInfoStack &nestedStringTreeCopyInfos,
-        const byte recursionDepth)
+    template<class FVisitChars, class FVisitString>
+    void CompoundString::ForEachPieceReverse(const FVisitChars VisitChars, const FVisitString VisitString) const
     {
+        // Pieces are visited from the end of the string to its beginning. Direct chars and packed substrings are passed to
+        // VisitChars as (chars, length), and whole strings referenced by pointer are passed to VisitString.
+
         Assert(!IsFinalized());
-        Assert(buffer);
 
         const CharCount totalCharLength = GetLength();
         switch(totalCharLength)
@@ -1064,19 +1064,19 @@ namespace Js
                 Assert(HasOnlyDirectChars());
                 Assert(LastBlockCharLength() == 1);
 
-                buffer[0] = LastBlockChars()[0];
+                VisitChars(LastBlockChars(), 1);
                 return;
         }
 
-        // Copy buffers from string pointers
+        // Visit string pointers
         const bool hasOnlyDirectChars = HasOnlyDirectChars();
         const CharCount directCharLength = hasOnlyDirectChars ? totalCharLength : this->directCharLength;
-        CharCount remainingCharLengthToCopy = totalCharLength;
+        CharCount remainingCharLength = totalCharLength;
         const Block *const lastBlock = this->lastBlock;
         const Block *block = lastBlock;
         void *const *blockPointers = LastBlockPointers();
         CharCount pointerIndex = LastBlockPointerLength();
-        while(remainingCharLengthToCopy > directCharLength)
+        while(remainingCharLength > directCharLength)
         {
             while(pointerIndex == 0)
             {
@@ -1108,39 +1108,27 @@ namespace Js
                     pointer2 = nullptr;
                 }
 
-                CharCount startIndex, copyCharLength;
-                UnpackSubstringInfo(pointer, pointer2, &startIndex, &copyCharLength);
+                CharCount startIndex, pieceCharLength;
+                UnpackSubstringInfo(pointer, pointer2, &startIndex, &pieceCharLength);
                 Assert(startIndex <= s->GetLength());
-                Assert(copyCharLength <= s->GetLength() - startIndex);
+                Assert(pieceCharLength <= s->GetLength() - startIndex);
 
-                Assert(remainingCharLengthToCopy >= copyCharLength);
-                remainingCharLengthToCopy -= copyCharLength;
-                CopyHelper(&buffer[remainingCharLengthToCopy], &s->GetString()[startIndex], copyCharLength);
+                Assert(remainingCharLength >= pieceCharLength);
+                remainingCharLength -= pieceCharLength;
+                VisitChars(&s->GetString()[startIndex], pieceCharLength);
             }
             else
             {
                 JavascriptString *const s = JavascriptString::FromVar(pointer);
-                const CharCount copyCharLength = s->GetLength();
 
-                Assert(remainingCharLengthToCopy >= copyCharLength);
-                remainingCharLengthToCopy -= copyCharLength;
-                if(recursionDepth == MaxCopyRecursionDepth && s->IsTree())
-                {
-                    // Don't copy nested string trees yet, as that involves a recursive call, and the recursion can become
-                    // excessive. Just collect the nested string trees and the buffer location where they should be copied, and
-                    // the caller can deal with those after returning.
-                    nestedStringTreeCopyInfos.Push(StringCopyInfo(s, &buffer[remainingCharLengthToCopy]));
-                }
-                else
-                {
-                    Assert(recursionDepth <= MaxCopyRecursionDepth);
-                    s->Copy(&buffer[remainingCharLengthToCopy], nestedStringTreeCopyInfos, recursionDepth + 1);
-                }
+                Assert(remainingCharLength >= s->GetLength());
+                remainingCharLength -= s->GetLength();
+                VisitString(s);
             }
         }
 
-        Assert(remainingCharLengthToCopy == directCharLength);
-        if(remainingCharLengthToCopy != 0)
+        Assert(remainingCharLength == directCharLength);
+        if(remainingCharLength != 0)
         {
             // Determine the number of direct chars in the current block
             CharCount blockCharLength;
@@ -1162,7 +1150,7 @@ namespace Js
             {
                 // The string switched to pointer mode somewhere in the middle of the current block. To determine where direct
                 // chars end in this block, all previous blocks are scanned and their char lengths discounted.
-                blockCharLength = remainingCharLengthToCopy;
+                blockCharLength = remainingCharLength;
                 if(block)
                 {
                     for(const Block *previousBlock = block->Previous();
@@ -1176,16 +1164,16 @@ namespace Js
                 Assert(Block::PointerLengthFromCharLength(blockCharLength) == pointerIndex);
             }
 
-            // Copy direct chars
+            // Visit direct chars
             const char16 *blockChars = block == lastBlock ? LastBlockChars() : block->Chars();
             while(true)
             {
                 if(blockCharLength != 0)
                 {
-                    Assert(remainingCharLengthToCopy >= blockCharLength);
-                    remainingCharLengthToCopy -= blockCharLength;
-                    js_wmemcpy_s(&buffer[remainingCharLengthToCopy], blockCharLength, blockChars, blockCharLength);
-                    if(remainingCharLengthToCopy == 0)
+                    Assert(remainingCharLength >= blockCharLength);
+                    remainingCharLength -= blockCharLength;
+                    VisitChars(blockChars, blockCharLength);
+                    if(remainingCharLength == 0)
                         break;
                 }
 
@@ -1211,9 +1199,64 @@ namespace Js
         }
     #endif
 
+        Assert(remainingCharLength == 0);
+    }
+
+    void CompoundString::CopyVirtual(
+        _Out_writes_(m_charLength) char16 *const buffer,
+        StringCopyInfoStack &nestedStringTreeCopyInfos,
+        const byte recursionDepth)
+    {
+        Assert(!IsFinalized());
+        Assert(buffer);
+
+        // Copying is done backwards, from the end of the buffer
+        CharCount remainingCharLengthToCopy = GetLength();
+        ForEachPieceReverse(
+            [&](const char16 *const chars, const CharCount copyCharLength)
+            {
+                Assert(remainingCharLengthToCopy >= copyCharLength);
+                remainingCharLengthToCopy -= copyCharLength;
+                CopyHelper(&buffer[remainingCharLengthToCopy], chars, copyCharLength);
+            },
+            [&](JavascriptString *const s)
+            {
+                const CharCount copyCharLength = s->GetLength();
+                Assert(remainingCharLengthToCopy >= copyCharLength);
+                remainingCharLengthToCopy -= copyCharLength;
+                if(recursionDepth == MaxCopyRecursionDepth && s->IsTree())
+                {
+                    // Don't copy nested string trees yet, as that involves a recursive call, and the recursion can become
+                    // excessive. Just collect the nested string trees and the buffer location where they should be copied, and
+                    // the caller can deal with those after returning.
+                    nestedStringTreeCopyInfos.Push(StringCopyInfo(s, &buffer[remainingCharLengthToCopy]));
+                }
+                else
+                {
+                    Assert(recursionDepth <= MaxCopyRecursionDepth);
+                    s->Copy(&buffer[remainingCharLengthToCopy], nestedStringTreeCopyInfos, recursionDepth + 1);
+                }
+            });
         Assert(remainingCharLengthToCopy == 0);
     }
 
+    void CompoundString::PushPieces(StringPieceStack &pieces) const
+    {
+        // Pieces are found from last to first, so the first piece ends up on top of the stack
+        ForEachPieceReverse(
+            [&](const char16 *const chars, const CharCount charLength)
+            {
+                if(charLength != 0)
+                {
+                    pieces.Push(StringPiece(chars, charLength));
+                }
+            },
+            [&](JavascriptString *const s)
+            {
+                pieces.Push(StringPiece(s));
+            });
+    }
+
     bool CompoundString::IsTree() const
     {
         Assert(!IsFinalized());
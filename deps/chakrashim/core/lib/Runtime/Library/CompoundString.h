@@ -425,6 +425,10 @@ namespace Js
         using JavascriptString::Copy;
         virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override sealed;
         virtual bool IsTree() const override sealed;
+        void PushPieces(StringPieceStack &pieces) const;
+
+    private:
+        template<class FVisitChars, class FVisitString> void ForEachPieceReverse(const FVisitChars VisitChars, const FVisitString VisitString) const;
 
     protected:
         DEFINE_VTABLE_CTOR(CompoundString, LiteralString);
@@ -3,6 +3,7 @@
 // Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
 //-------------------------------------------------------------------------------------------------------
 #include "RuntimeLibraryPch.h"
+#include "Types/PathTypeHandler.h"
 #include "Library/JSONStack.h"
 #include "Library/JSONParser.h"
 #include "Library/JSON.h"
@@ -316,9 +317,16 @@ namespace JSON
             }
         }
 
+        // Objects that share a PathTypeHandler type are serialized from a per-type member cache; only worth it for object graphs.
+        DECLARE_TEMP_GUEST_ALLOCATOR(typeCacheAlloc);
+        if (CONFIG_FLAG(JsonStringifyTypeCache) && Js::JavascriptOperators::IsObject(value))
+        {
+            ACQUIRE_TEMP_GUEST_ALLOCATOR(typeCacheAlloc, scriptContext, _u("JSON"));
+        }
+
         BEGIN_TEMP_ALLOCATOR(tempAlloc, scriptContext, _u("JSON"))
         {
-            stringifySession.CompleteInit(space, tempAlloc);
+            stringifySession.CompleteInit(space, tempAlloc, typeCacheAlloc);
 
             Js::DynamicObject* wrapper = scriptContext->GetLibrary()->CreateObject();
             JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(wrapper));
@@ -330,13 +338,14 @@ namespace JSON
         }
         END_TEMP_ALLOCATOR(tempAlloc, scriptContext);
 
+        RELEASE_TEMP_GUEST_ALLOCATOR(typeCacheAlloc, scriptContext);
         RELEASE_TEMP_GUEST_ALLOCATOR(nameTableAlloc, scriptContext);
         return result;
     }
 
     // -------- StringifySession implementation ------------//
 
-    void StringifySession::CompleteInit(Js::Var space, ArenaAllocator* tempAlloc)
+    void StringifySession::CompleteInit(Js::Var space, ArenaAllocator* tempAlloc, ArenaAllocator* typeCacheAlloc)
     {
         //set the stack, gap
         char16 buffer[JSONspaceSize];
@@ -386,6 +395,12 @@ namespace JSON
         }
 
         objectStack = Anew(tempAlloc, JSONStack, tempAlloc, scriptContext);
+
+        if (typeCacheAlloc)
+        {
+            this->typeCacheAlloc = typeCacheAlloc;
+            this->typeCacheMap = Anew(typeCacheAlloc, TypeCacheMap, typeCacheAlloc);
+        }
     }
 
     Js::Var StringifySession::Str(uint32 index, Js::Var holder)
@@ -436,12 +451,16 @@ namespace JSON
 
     Js::Var StringifySession::StrHelper(Js::JavascriptString* key, Js::Var value, Js::Var holder)
     {
-        PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+        return StrValue(ApplyFilters(key, value, holder));
+    }
+
+    // Applies toJSON and the replacer function to the value of a member, and unwraps Number, String and Boolean objects.
+    Js::Var StringifySession::ApplyFilters(Js::JavascriptString* key, Js::Var value, Js::Var holder)
+    {
         AssertMsg(Js::RecyclableObject::Is(holder), "The holder argument in a JSON::Str function must be an object");
 
         Js::Var values[3];
         Js::Arguments args(0, values);
-        Js::Var undefined = scriptContext->GetLibrary()->GetUndefined();
 
         //check and apply 'toJSON' filter
         if (Js::JavascriptOperators::IsJsNativeObject(value) || (Js::JavascriptOperators::IsObject(value)))
@@ -484,8 +503,16 @@ namespace JSON
         {
             value = Js::JavascriptBooleanObject::FromVar(value)->GetValue() ? scriptContext->GetLibrary()->GetTrue() : scriptContext->GetLibrary()->GetFalse();
         }
+        return value;
+    }
+
+    // Serializes a value that went through ApplyFilters. Returns undefined for values that aren't serialized.
+    Js::Var StringifySession::StrValue(Js::Var value)
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
 
-        id = Js::JavascriptOperators::GetTypeId(value);
+        Js::Var undefined = scriptContext->GetLibrary()->GetUndefined();
+        Js::TypeId id = Js::JavascriptOperators::GetTypeId(value);
         switch (id)
         {
         case Js::TypeIds_Undefined:
@@ -628,6 +655,11 @@ namespace JSON
                     }
                 }
             }
+            else if (TypeCache* typeCache = GetTypeCache(object))
+            {
+                result = Js::ConcatStringBuilder::New(this->scriptContext, typeCache->count);    // Reserve initial slots for properties.
+                StringifyCachedTypeMembers(Js::DynamicObject::FromVar(object), typeCache, (Js::ConcatStringBuilder*)result, indentString, memberSeparator, isFirstMember, isEmpty);
+            }
             else
             {
                 uint32 precisePropertyCount = 0;
@@ -918,6 +950,147 @@ namespace JSON
         }
     }
 
+    // Returns the member cache for the object's type, building it on first use. Returns nullptr when the object
+    // has to go through the generic enumerator path: anything but a plain object with a shared PathTypeHandler type
+    // and no indexed properties, or when a replacer function may add properties while we walk.
+    StringifySession::TypeCache* StringifySession::GetTypeCache(Js::RecyclableObject* object)
+    {
+        if (this->typeCacheMap == nullptr ||
+            ReplacerFunction == this->replacerType ||
+            Js::JavascriptOperators::GetTypeId(object) != Js::TypeIds_Object)
+        {
+            return nullptr;
+        }
+
+        Js::DynamicObject* dynamicObject = Js::DynamicObject::FromVar(object);
+        Js::DynamicType* type = dynamicObject->GetDynamicType();
+        if (!type->GetIsShared() ||
+            !type->GetTypeHandler()->IsPathTypeHandler() ||
+            dynamicObject->HasObjectArray() ||
+            dynamicObject->IsCrossSiteObject())
+        {
+            return nullptr;
+        }
+
+        TypeCache* typeCache = nullptr;
+        if (this->typeCacheMap->TryGetValue(type, &typeCache))
+        {
+            return typeCache;
+        }
+
+        Js::PathTypeHandlerBase* typeHandler = Js::PathTypeHandlerBase::FromTypeHandler(type->GetTypeHandler());
+        int propertyCount = typeHandler->GetPropertyCount();
+
+        typeCache = Anew(this->typeCacheAlloc, TypeCache);
+        typeCache->count = 0;
+        typeCache->entries = AnewArray(this->typeCacheAlloc, TypeCacheEntry, propertyCount);
+
+        for (Js::PropertyIndex index = 0; index < propertyCount; index++)
+        {
+            Js::PropertyId propertyId = typeHandler->GetPropertyId(scriptContext, index);
+            if (propertyId == Js::Constants::NoProperty || scriptContext->GetPropertyName(propertyId)->IsSymbol())
+            {
+                continue;
+            }
+
+            Js::JavascriptString* propertyName = scriptContext->GetPropertyString(propertyId);
+            Js::JavascriptString* quotedPrefix = Js::JavascriptString::Concat(Quote(propertyName), this->GetPropertySeparator());
+            quotedPrefix->GetSz();  // Flatten once here instead of once per serialized object.
+
+            TypeCacheEntry& entry = typeCache->entries[typeCache->count++];
+            entry.propertyId = propertyId;
+            entry.slotIndex = index;
+            entry.propName = propertyName;
+            entry.quotedPrefix = quotedPrefix;
+        }
+
+        this->typeCacheMap->Add(type, typeCache);
+        return typeCache;
+    }
+
+    // Writes the members into a growable buffer rather than appending a rope node per member. The quoted names and the
+    // text of numbers, booleans and null need no escaping and are copied as is. String values are escaped straight into
+    // the buffer, so strings without special characters are copied in one piece. Nested objects and arrays are already
+    // ropes; they are appended as nodes after the text written so far, so their text isn't copied again at every level.
+    void StringifySession::StringifyCachedTypeMembers(Js::DynamicObject* object, TypeCache* typeCache, Js::ConcatStringBuilder* result, Js::JavascriptString* &indentString, Js::JavascriptString* &memberSeparator, bool &isFirstMember, bool &isEmpty)
+    {
+        Js::WritableStringBuffer buffer(scriptContext->GetRecycler());
+        Js::Type* cachedType = object->GetType();
+        for (uint32 k = 0; k < typeCache->count; k++)
+        {
+            const TypeCacheEntry& entry = typeCache->entries[k];
+            Js::Var propertyValue;
+
+            // A toJSON or getter run by an earlier member may have reshaped the object; the member list is still the
+            // snapshot taken on entry, exactly as with the enumerator path, but values must then be looked up by id.
+            if (object->GetType() == cachedType)
+            {
+                propertyValue = object->GetSlot(entry.slotIndex);
+            }
+            else if (!Js::JavascriptOperators::GetProperty(object, entry.propertyId, &propertyValue, scriptContext))
+            {
+                continue;
+            }
+
+            propertyValue = ApplyFilters(entry.propName, propertyValue, object);
+
+            Js::JavascriptString* valueString = nullptr;
+            if (!Js::JavascriptString::Is(propertyValue))
+            {
+                Js::Var propertyObjectString = StrValue(propertyValue);
+                if (Js::JavascriptOperators::IsUndefinedObject(propertyObjectString, scriptContext))
+                {
+                    continue;
+                }
+                valueString = Js::JavascriptString::FromVar(propertyObjectString);
+            }
+
+            if (!isFirstMember)
+            {
+                if (!indentString)
+                {
+                    indentString = GetIndentString(this->indent);
+                    memberSeparator = GetMemberSeparator(indentString);
+                }
+                buffer.AppendLarge(memberSeparator->GetString(), memberSeparator->GetLength());
+            }
+            buffer.AppendLarge(entry.quotedPrefix->GetString(), entry.quotedPrefix->GetLength());
+
+            if (valueString == nullptr)
+            {
+                Js::JavascriptString* stringValue = Js::JavascriptString::FromVar(propertyValue);
+                if (stringValue->GetLength() == 0)
+                {
+                    buffer.Append(_u("\"\""), 2);
+                }
+                else
+                {
+                    Js::JSONString::Escape<Js::EscapingOperation_Escape>(stringValue, 0, &buffer);
+                }
+            }
+            else if (valueString->IsFinalized())
+            {
+                buffer.AppendLarge(valueString->GetString(), valueString->GetLength());
+            }
+            else
+            {
+                if (buffer.GetCount() != 0)
+                {
+                    result->Append(buffer.Detach(scriptContext));
+                }
+                result->Append(valueString);
+            }
+
+            isFirstMember = false;
+            isEmpty = false;
+        }
+
+        if (buffer.GetCount() != 0)
+        {
+            result->Append(buffer.Detach(scriptContext));
+        }
+    }
+
     // Returns precise property count for given object and enumerator, does not count properties that are undefined.
     inline uint32 StringifySession::GetPropertyCount(Js::RecyclableObject* object, Js::JavascriptEnumerator* enumerator)
     {
@@ -34,12 +34,30 @@ namespace JSON
             Js::PropertyRecord const * propRecord;
         };
 
+        // Members of a shared PathTypeHandler type, in enumeration order. The quoted "name": prefix is
+        // built once per type and reused for every object of that type serialized in this session.
+        struct TypeCacheEntry
+        {
+            Js::PropertyId             propertyId;
+            Js::PropertyIndex          slotIndex;
+            Js::JavascriptString     * propName;
+            Js::JavascriptString     * quotedPrefix;
+        };
+        struct TypeCache
+        {
+            uint32           count;
+            TypeCacheEntry * entries;
+        };
+        typedef JsUtil::BaseDictionary<Js::DynamicType const *, TypeCache *, ArenaAllocator> TypeCacheMap;
+
         StringifySession(Js::ScriptContext* sc)
             :   scriptContext(sc),
                 replacerType(ReplacerNone),
                 gap(NULL),
                 indent(0),
-                propertySeparator(NULL)
+                propertySeparator(NULL),
+                typeCacheAlloc(NULL),
+                typeCacheMap(NULL)
         {
             replacer.propertyList.propertyNames = NULL;
             replacer.propertyList.length = 0;
@@ -59,7 +77,7 @@ namespace JSON
             replacer.propertyList.propertyNames = nameTable;
             replacer.propertyList.length = len;
         }
-        void CompleteInit(Js::Var space, ArenaAllocator* alloc);
+        void CompleteInit(Js::Var space, ArenaAllocator* alloc, ArenaAllocator* typeCacheAlloc = nullptr);
 
         Js::Var Str(Js::JavascriptString* key, Js::PropertyId keyId, Js::Var holder);
         Js::Var Str(uint32 index, Js::Var holder);
@@ -77,6 +95,10 @@ namespace JSON
         void StringifyMemberObject( Js::JavascriptString* propertyName, Js::PropertyId id, Js::Var value, Js::ConcatStringBuilder* result,
             Js::JavascriptString* &indentString, Js::JavascriptString* &memberSeparator, bool &isFirstMember, bool &isEmpty );
 
+        TypeCache* GetTypeCache(Js::RecyclableObject* object);
+        void StringifyCachedTypeMembers(Js::DynamicObject* object, TypeCache* typeCache, Js::ConcatStringBuilder* result,
+            Js::JavascriptString* &indentString, Js::JavascriptString* &memberSeparator, bool &isFirstMember, bool &isEmpty);
+
         uint32 GetPropertyCount(Js::RecyclableObject* object, Js::JavascriptEnumerator* enumerator);
         uint32 GetPropertyCount(Js::RecyclableObject* object, Js::JavascriptEnumerator* enumerator, bool* isPrecise);
 
@@ -99,6 +121,12 @@ namespace JSON
         Js::JavascriptString* gap;
         uint indent;
         Js::JavascriptString* propertySeparator;     // colon or colon+space
+
+        // Lives in a guest arena so that the cached property name strings are visible to the recycler.
+        ArenaAllocator* typeCacheAlloc;
+        TypeCacheMap* typeCacheMap;
         Js::Var StringifySession::StrHelper(Js::JavascriptString* key, Js::Var value, Js::Var holder);
+        Js::Var ApplyFilters(Js::JavascriptString* key, Js::Var value, Js::Var holder);
+        Js::Var StrValue(Js::Var value);
     };
 } // namespace JSON
@@ -90,8 +90,29 @@ namespace Js
         return buffer;
     }
 
+    void WritableStringBuffer::Grow(charcount_t countNeeded)
+    {
+        // Grow geometrically, keeping room for the terminating null added by Detach
+        Assert(this->m_recycler != nullptr);
+        charcount_t count = this->GetCount();
+        charcount_t newLength = max(UInt32Math::Add(count, countNeeded), max(UInt32Math::Mul(m_length, 2), (charcount_t)64));
+        if (!IsValidCharCount(newLength))
+        {
+            Js::Throw::OutOfMemory();
+        }
+        char16* newString = RecyclerNewArrayLeaf(this->m_recycler, char16, newLength + 1);
+        if (count != 0)
+        {
+            js_wmemcpy_s(newString, newLength, this->m_pszString, count);
+        }
+        this->m_pszString = newString;
+        this->m_pszCurrentPtr = newString + count;
+        this->m_length = newLength;
+    }
+
     void WritableStringBuffer::Append(const char16 * str, charcount_t countNeeded)
     {
+        this->EnsureCapacity(countNeeded);
         JavascriptString::CopyHelper(m_pszCurrentPtr, str, countNeeded);
         this->m_pszCurrentPtr += countNeeded;
         Assert(this->GetCount() <= m_length);
@@ -99,15 +120,35 @@ namespace Js
 
     void WritableStringBuffer::Append(char16 c)
     {
+        this->EnsureCapacity(1);
         *m_pszCurrentPtr = c;
         this->m_pszCurrentPtr++;
         Assert(this->GetCount() <= m_length);
     }
     void WritableStringBuffer::AppendLarge(const char16 * str, charcount_t countNeeded)
     {
+        this->EnsureCapacity(countNeeded);
         js_memcpy_s(m_pszCurrentPtr, sizeof(WCHAR) * countNeeded, str, sizeof(WCHAR) * countNeeded);
         this->m_pszCurrentPtr += countNeeded;
         Assert(this->GetCount() <= m_length);
     }
+
+    // Returns the content as a string and leaves the buffer empty. Growable buffers only.
+    JavascriptString* WritableStringBuffer::Detach(ScriptContext* scriptContext)
+    {
+        Assert(this->m_recycler != nullptr);
+        charcount_t count = this->GetCount();
+        if (count == 0)
+        {
+            return scriptContext->GetLibrary()->GetEmptyString();
+        }
+
+        *this->m_pszCurrentPtr = _u('\0');
+        JavascriptString* result = JavascriptString::NewWithBuffer(this->m_pszString, count, scriptContext);
+        this->m_pszString = nullptr;
+        this->m_pszCurrentPtr = nullptr;
+        this->m_length = 0;
+        return result;
+    }
 #endif
 }
@@ -16,23 +16,37 @@ namespace Js
     class WritableStringBuffer
     {
     public:
-        WritableStringBuffer(_In_count_(length) char16* str, _In_ charcount_t length) : m_pszString(str), m_pszCurrentPtr(str), m_length(length) {}
+        WritableStringBuffer(_In_count_(length) char16* str, _In_ charcount_t length) : m_pszString(str), m_pszCurrentPtr(str), m_length(length), m_recycler(nullptr) {}
+
+        // A buffer that starts empty and grows as needed. Its content is handed over as a string by Detach.
+        WritableStringBuffer(_In_ Recycler* recycler) : m_pszString(nullptr), m_pszCurrentPtr(nullptr), m_length(0), m_recycler(recycler) {}
 
         void Append(char16 c);
         void Append(const char16 * str, charcount_t countNeeded);
         void AppendLarge(const char16 * str, charcount_t countNeeded);
-    private:
-        char16* m_pszString;
-        char16* m_pszCurrentPtr;
-        charcount_t m_length;
-#if DBG
-        charcount_t GetCount()
+        JavascriptString* Detach(ScriptContext* scriptContext);
+
+        charcount_t GetCount() const
         {
             Assert(m_pszCurrentPtr >= m_pszString);
             Assert(m_pszCurrentPtr - m_pszString <= MaxCharCount);
             return static_cast<charcount_t>(m_pszCurrentPtr - m_pszString);
         }
-#endif
+    private:
+        void EnsureCapacity(charcount_t countNeeded)
+        {
+            if (m_recycler != nullptr && countNeeded > m_length - GetCount())
+            {
+                Grow(countNeeded);
+            }
+            Assert(GetCount() + countNeeded <= m_length);
+        }
+        void Grow(charcount_t countNeeded);
+
+        char16* m_pszString;
+        char16* m_pszCurrentPtr;
+        charcount_t m_length;
+        Recycler* m_recycler;
     };
 
     class JSONString : public JavascriptString
@@ -6,6 +6,7 @@
 #include "RuntimeLibraryPch.h"
 #include "Types/PathTypeHandler.h"
 #include "Types/SpreadArgument.h"
+#include "DataStructures/TimSort.h"
 
 namespace Js
 {
@@ -3685,6 +3686,37 @@ namespace Js
         return returnValue;
     }
 
+    Var JavascriptArray::DirectIndexOf(Var instance, Var search)
+    {
+        JavascriptArray* pArr = JavascriptArray::FromVar(instance);
+        ScriptContext* scriptContext = pArr->GetScriptContext();
+
+        // The vtable check excludes ES5 arrays and copy-on-access arrays, so the length is the internal one
+        uint32 len = pArr->length;
+        if (len == 0)
+        {
+            return TaggedInt::ToVarUnchecked(-1);
+        }
+
+        uint32 fromIndex = 0;
+        int32 index = pArr->HeadSegmentIndexOfHelper(search, fromIndex, len, false, scriptContext);
+        if (index != -1 || fromIndex == -1)
+        {
+            return JavascriptNumber::ToVar(index, scriptContext);
+        }
+
+        switch (pArr->GetTypeId())
+        {
+        case Js::TypeIds_NativeIntArray:
+            return TemplatedIndexOfHelper<false>(JavascriptNativeIntArray::FromVar(pArr), search, fromIndex, len, scriptContext);
+        case Js::TypeIds_NativeFloatArray:
+            return TemplatedIndexOfHelper<false>(JavascriptNativeFloatArray::FromVar(pArr), search, fromIndex, len, scriptContext);
+        default:
+            Assert(pArr->GetTypeId() == Js::TypeIds_Array);
+            return TemplatedIndexOfHelper<false>(pArr, search, fromIndex, len, scriptContext);
+        }
+    }
+
     Var JavascriptArray::EntryIncludes(RecyclableObject* function, CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -6056,42 +6088,83 @@ Case0:
         }
     }
 
-    static void hybridSort(__inout_ecount(length) Var *elements, uint32 length, CompareVarsInfo* compareInfo)
+    class CompareVarsComparer
     {
-        // The cost of memory moves starts to be more expensive than additional comparer calls (given a simple comparer)
-        // for arrays of more than 512 elements.
-        if (length > 512)
+    private:
+        CompareVarsInfo* compareInfo;
+    public:
+        CompareVarsComparer(CompareVarsInfo* compareInfo) : compareInfo(compareInfo) { }
+
+        int operator()(const Var& a, const Var& b)
         {
-            qsort_s(elements, length, sizeof(Var), compareVars, compareInfo);
-            return;
+            return compareVars(compareInfo, &a, &b);
         }
+    };
+
+    static void SortVars(__inout_ecount(length) Var *elements, uint32 length, CompareVarsInfo* compareInfo, Recycler* recycler)
+    {
+        typedef JsUtil::TimSort<Var, CompareVarsComparer> VarTimSort;
+
+        // The scratch buffer holds half of the elements while runs are merged, so the GC has to see it.
+        uint32 scratchLength = VarTimSort::GetScratchLength(length);
+        Var* scratch = scratchLength != 0 ? RecyclerNewArrayZ(recycler, Var, scratchLength) : nullptr;
+
+        CompareVarsComparer comparer(compareInfo);
+        VarTimSort::Sort(elements, length, scratch, comparer);
+    }
 
-        for (int i = 1; i < (int)length; i++)
+    // Orders int32 values the way comparing their decimal strings would, without creating the strings.
+    class IntStringOrderComparer
+    {
+    private:
+        static uint32 GetDigitCount(uint64 value)
         {
-            if (compareVars(compareInfo, elements + i, elements + i - 1) < 0) {
-                // binary search for the left-most element greater than value:
-                int first = 0;
-                int last = i - 1;
-                while (first <= last)
-                {
-                    int middle = (first + last) / 2;
-                    if (compareVars(compareInfo, elements + i, elements + middle) < 0)
-                    {
-                        last = middle - 1;
-                    }
-                    else
-                    {
-                        first = middle + 1;
-                    }
-                }
+            uint32 digits = 1;
+            while (value >= 10)
+            {
+                value /= 10;
+                digits++;
+            }
+            return digits;
+        }
+
+    public:
+        int operator()(const int32& a, const int32& b)
+        {
+            if (a == b)
+            {
+                return 0;
+            }
+
+            // '-' sorts before any digit; past the sign, both strings are the digits of the magnitude.
+            if ((a < 0) != (b < 0))
+            {
+                return a < 0 ? -1 : 1;
+            }
 
-                // insert value right before first:
-                Var value = elements[i];
-                memmove(elements + first + 1, elements + first, (i - first) * sizeof(Var));
-                elements[first] = value;
+            uint64 x = a < 0 ? (uint64)(-(int64)a) : (uint64)a;
+            uint64 y = b < 0 ? (uint64)(-(int64)b) : (uint64)b;
+            uint32 xDigits = GetDigitCount(x);
+            uint32 yDigits = GetDigitCount(y);
+
+            // Pad the shorter one with zeros to compare digit by digit. At most 10 digits, so this can't overflow.
+            for (uint32 i = xDigits; i < yDigits; i++)
+            {
+                x *= 10;
+            }
+            for (uint32 i = yDigits; i < xDigits; i++)
+            {
+                y *= 10;
             }
+
+            if (x == y)
+            {
+                // One is a prefix of the other; the shorter string comes first.
+                return xDigits < yDigits ? -1 : 1;
+            }
+            return x < y ? -1 : 1;
         }
-    }
+    };
 
     void JavascriptArray::Sort(RecyclableObject* compFn)
     {
@@ -6136,7 +6209,7 @@ Case0:
 #ifdef VALIDATE_ARRAY
                     ValidateSegment(startSeg);
 #endif
-                    hybridSort(startSeg->elements, startSeg->length, &cvInfo);
+                    SortVars(startSeg->elements, startSeg->length, &cvInfo, recycler);
                 }
                 else
                 {
@@ -6168,7 +6241,7 @@ Case0:
 
                 if (compFn != nullptr)
                 {
-                    hybridSort(allElements->elements, allElements->length, &cvInfo);
+                    SortVars(allElements->elements, allElements->length, &cvInfo, recycler);
                 }
                 else
                 {
@@ -6262,7 +6335,7 @@ Case0:
 
         if (count > 0)
         {
-            SortElements(elements, 0, count - 1);
+            SortElements(elements, count, scriptContext->GetRecycler());
 
             for (uint32 i = 0; i < count; ++i)
             {
@@ -6279,20 +6352,34 @@ Case0:
         return countUndefined;
     }
 
-    int __cdecl JavascriptArray::CompareElements(void* context, const void* elem1, const void* elem2)
+    int JavascriptArray::CompareElements::operator()(const Element& element1, const Element& element2)
+    {
+        return JavascriptString::strcmp(element1.StringValue, element2.StringValue);
+    }
+
+    void JavascriptArray::SortElements(Element* elements, uint32 count, Recycler* recycler)
     {
-        const Element* element1 = static_cast<const Element*>(elem1);
-        const Element* element2 = static_cast<const Element*>(elem2);
+        typedef JsUtil::TimSort<Element, CompareElements> ElementTimSort;
 
-        Assert(element1 != NULL);
-        Assert(element2 != NULL);
+        uint32 scratchLength = ElementTimSort::GetScratchLength(count);
+        Element* scratch = scratchLength != 0 ? RecyclerNewArrayZ(recycler, Element, scratchLength) : nullptr;
 
-        return JavascriptString::strcmp(element1->StringValue, element2->StringValue);
+        CompareElements comparer;
+        ElementTimSort::Sort(elements, count, scratch, comparer);
     }
 
-    void JavascriptArray::SortElements(Element* elements, uint32 left, uint32 right)
+    void JavascriptArray::SortNativeIntsInStringOrder(JavascriptNativeIntArray* arr)
     {
-        qsort_s(elements, right - left + 1, sizeof(Element), CompareElements, this);
+        Assert(arr->head->next == nullptr && arr->HasNoMissingValues());
+
+        typedef JsUtil::TimSort<int32, IntStringOrderComparer> IntTimSort;
+
+        SparseArraySegment<int32>* seg = (SparseArraySegment<int32>*)arr->head;
+        uint32 scratchLength = IntTimSort::GetScratchLength(seg->length);
+        int32* scratch = scratchLength != 0 ? RecyclerNewArrayLeaf(arr->GetRecycler(), int32, scratchLength) : nullptr;
+
+        IntStringOrderComparer comparer;
+        IntTimSort::Sort(seg->elements, seg->length, scratch, comparer);
     }
 
     Var JavascriptArray::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
@@ -6346,6 +6433,14 @@ Case0:
                 arr->FillFromPrototypes(0, arr->length); // We need find all missing value from [[proto]] object
             }
 
+            // Without a comparer, elements compare as strings. Ints can be compared that way in place, so a
+            // dense int array is sorted without converting it or creating any strings.
+            if (compFn == nullptr && JavascriptNativeIntArray::Is(arr) && arr->head->next == nullptr && arr->HasNoMissingValues())
+            {
+                SortNativeIntsInStringOrder(JavascriptNativeIntArray::FromVar(arr));
+                return args[0];
+            }
+
             // Maintain nativity of the array only for the following cases (To favor inplace conversions - keeps the conversion cost less):
             // -    int cases for X86 and
             // -    FloatArray for AMD64
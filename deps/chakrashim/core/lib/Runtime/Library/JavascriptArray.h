@@ -250,6 +250,11 @@ namespace Js
         static Var EntryForEach(RecyclableObject* function, CallInfo callInfo, ...);
         static Var EntryIndexOf(RecyclableObject* function, CallInfo callInfo, ...);
         static Var EntryIncludes(RecyclableObject* function, CallInfo callInfo, ...);
+
+        // Called from the JIT's inlined Array.prototype.indexOf(search) once it has checked that instance is a
+        // var, native int or native float array of the current script context.
+        static Var DirectIndexOf(Var instance, Var search);
+
         static Var EntryJoin(RecyclableObject* function, CallInfo callInfo, ...);
         static Var EntryLastIndexOf(RecyclableObject* function, CallInfo callInfo, ...);
         static Var EntryMap(RecyclableObject* function, CallInfo callInfo, ...);
@@ -554,8 +559,12 @@ namespace Js
             JavascriptString* StringValue;
         };
 
-        static int __cdecl CompareElements(void* context, const void* elem1, const void* elem2);
-        void SortElements(Element* elements, uint32 left, uint32 right);
+        struct CompareElements {
+            int operator()(const Element& element1, const Element& element2);
+        };
+
+        static void SortElements(Element* elements, uint32 count, Recycler* recycler);
+        static void SortNativeIntsInStringOrder(JavascriptNativeIntArray* arr);
 
         template <typename Fn>
         static void ForEachOwnArrayIndexOfObject(RecyclableObject* obj, uint32 startIndex, uint32 limitIndex, Fn fn);
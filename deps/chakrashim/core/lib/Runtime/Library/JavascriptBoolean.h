@@ -19,6 +19,7 @@ namespace Js
         }
 
         inline BOOL GetValue() { return value; }
+        static uint32 GetOffsetOfValue() { return offsetof(JavascriptBoolean, value); }
 
         static inline bool Is(Var aValue);
         static inline JavascriptBoolean* FromVar(Var aValue);
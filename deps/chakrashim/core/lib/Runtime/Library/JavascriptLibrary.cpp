@@ -3245,6 +3245,7 @@ namespace Js
         vtableAddresses[VTableValue::VtableNativeFloatArray] = VirtualTableInfo<Js::JavascriptNativeFloatArray>::Address;
         vtableAddresses[VTableValue::VtableJavascriptNativeIntArray] = VirtualTableInfo<Js::JavascriptNativeIntArray>::Address;
         vtableAddresses[VTableValue::VtableJavascriptRegExp] = VirtualTableInfo<Js::JavascriptRegExp>::Address;
+        vtableAddresses[VTableValue::VtableJavascriptMap] = VirtualTableInfo<Js::JavascriptMap>::Address;
         vtableAddresses[VTableValue::VtableStackScriptFunction] = VirtualTableInfo<Js::StackScriptFunction>::Address;
         vtableAddresses[VTableValue::VtableScriptFunction] = VirtualTableInfo<Js::ScriptFunction>::Address;
         vtableAddresses[VTableValue::VtableJavascriptGeneratorFunction] = VirtualTableInfo<Js::JavascriptGeneratorFunction>::Address;
@@ -3266,6 +3267,7 @@ namespace Js
     // case PropertyIds::lastIndexOf:
     // case PropertyIds::slice:
     // which have same names for Array and String cannot be resolved just by the property id
+    // The same goes for Map's get, has and set, which are shared with Set, WeakMap and many user objects.
 
     BuiltinFunction JavascriptLibrary::GetBuiltinFunctionForPropId(PropertyId id)
     {
@@ -4145,14 +4147,15 @@ namespace Js
         // so that the update is in sync with profiler
         ScriptContext* scriptContext = mapPrototype->GetScriptContext();
         JavascriptLibrary* library = mapPrototype->GetLibrary();
+        JavascriptFunction ** builtinFuncs = library->GetBuiltinFunctions();
         library->AddMember(mapPrototype, PropertyIds::constructor, library->mapConstructor);
 
         library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::clear, &JavascriptMap::EntryInfo::Clear, 0);
         library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::delete_, &JavascriptMap::EntryInfo::Delete, 1);
         library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::forEach, &JavascriptMap::EntryInfo::ForEach, 1);
-        library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::get, &JavascriptMap::EntryInfo::Get, 1);
-        library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::has, &JavascriptMap::EntryInfo::Has, 1);
-        library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::set, &JavascriptMap::EntryInfo::Set, 2);
+        builtinFuncs[BuiltinFunction::Map_Get] = library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::get, &JavascriptMap::EntryInfo::Get, 1);
+        builtinFuncs[BuiltinFunction::Map_Has] = library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::has, &JavascriptMap::EntryInfo::Has, 1);
+        builtinFuncs[BuiltinFunction::Map_Set] = library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::set, &JavascriptMap::EntryInfo::Set, 2);
 
         library->AddAccessorsToLibraryObject(mapPrototype, PropertyIds::size, &JavascriptMap::EntryInfo::SizeGetter, nullptr);
 
@@ -4167,6 +4170,8 @@ namespace Js
             library->AddMember(mapPrototype, PropertyIds::_symbolToStringTag, library->CreateStringFromCppLiteral(_u("Map")), PropertyConfigurable);
         }
 
+        DebugOnly(CheckRegisteredBuiltIns(builtinFuncs, scriptContext));
+
         mapPrototype->SetHasNoEnumerableProperties(true);
     }
 
@@ -14,7 +14,7 @@ namespace Js
     JavascriptMap* JavascriptMap::New(ScriptContext* scriptContext)
     {
         JavascriptMap* map = scriptContext->GetLibrary()->CreateMap();
-        map->map = RecyclerNew(scriptContext->GetRecycler(), MapDataMap, scriptContext->GetRecycler());
+        map->map.Initialize(scriptContext->GetRecycler());
 
         return map;
     }
@@ -31,9 +31,9 @@ namespace Js
         return static_cast<JavascriptMap *>(RecyclableObject::FromVar(aValue));
     }
 
-    JavascriptMap::MapDataList::Iterator JavascriptMap::GetIterator()
+    JavascriptMap::MapDataTable::Iterator JavascriptMap::GetIterator()
     {
-        return list.GetIterator();
+        return map.GetIterator();
     }
 
     Var JavascriptMap::NewInstance(RecyclableObject* function, CallInfo callInfo, ...)
@@ -78,12 +78,12 @@ namespace Js
             adder = RecyclableObject::FromVar(adderVar);
         }
 
-        if (mapObject->map != nullptr)
+        if (mapObject->map.IsInitialized())
         {
             JavascriptError::ThrowTypeErrorVar(scriptContext, JSERR_ObjectIsAlreadyInitialized, _u("Map"), _u("Map"));
         }
 
-        mapObject->map = RecyclerNew(scriptContext->GetRecycler(), MapDataMap, scriptContext->GetRecycler());
+        mapObject->map.Initialize(scriptContext->GetRecycler());
 
         if (iter != nullptr)
         {
@@ -269,6 +269,41 @@ namespace Js
         return map;
     }
 
+    Var JavascriptMap::DirectGet(Var instance, Var key)
+    {
+        JavascriptMap* map = JavascriptMap::FromVar(instance);
+        Var value = nullptr;
+
+        if (map->Get(key, &value))
+        {
+            return value;
+        }
+
+        return map->GetLibrary()->GetUndefined();
+    }
+
+    Var JavascriptMap::DirectHas(Var instance, Var key)
+    {
+        JavascriptMap* map = JavascriptMap::FromVar(instance);
+
+        return map->GetLibrary()->CreateBoolean(map->Has(key));
+    }
+
+    Var JavascriptMap::DirectSet(Var instance, Var key, Var value)
+    {
+        JavascriptMap* map = JavascriptMap::FromVar(instance);
+
+        if (JavascriptNumber::Is(key) && JavascriptNumber::IsNegZero(JavascriptNumber::GetValue(key)))
+        {
+            // Normalize -0 to +0
+            key = JavascriptNumber::New(0.0, map->GetScriptContext());
+        }
+
+        map->Set(key, value);
+
+        return map;
+    }
+
     Var JavascriptMap::EntrySizeGetter(RecyclableObject* function, CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -340,27 +375,20 @@ namespace Js
 
     void JavascriptMap::Clear()
     {
-        list.Clear();
-        map->Clear();
+        map.Clear(GetScriptContext()->GetRecycler());
     }
 
     bool JavascriptMap::Delete(Var key)
     {
-        if (map->ContainsKey(key))
-        {
-            MapDataNode* node = map->Item(key);
-            list.Remove(node);
-            return map->Remove(key);
-        }
-        return false;
+        return map.Remove(key, GetScriptContext()->GetRecycler());
     }
 
     bool JavascriptMap::Get(Var key, Var* value)
     {
-        if (map->ContainsKey(key))
+        MapDataKeyValuePair* pair = map.Find(key);
+        if (pair != nullptr)
         {
-            MapDataNode* node = map->Item(key);
-            *value = node->data.Value();
+            *value = pair->Value();
             return true;
         }
         return false;
@@ -368,27 +396,17 @@ namespace Js
 
     bool JavascriptMap::Has(Var key)
     {
-        return map->ContainsKey(key);
+        return map.ContainsKey(key);
     }
 
     void JavascriptMap::Set(Var key, Var value)
     {
-        if (map->ContainsKey(key))
-        {
-            MapDataNode* node = map->Item(key);
-            node->data = MapDataKeyValuePair(key, value);
-        }
-        else
-        {
-            MapDataKeyValuePair pair(key, value);
-            MapDataNode* node = list.Append(pair, GetScriptContext()->GetRecycler());
-            map->Add(key, node);
-        }
+        map.Set(MapDataKeyValuePair(key, value), GetScriptContext()->GetRecycler());
     }
 
     int JavascriptMap::Size()
     {
-        return map->Count();
+        return map.Count();
     }
 
     BOOL JavascriptMap::GetDiagTypeString(StringBuilder<ArenaAllocator>* stringBuilder, ScriptContext* requestContext)
@@ -450,7 +468,7 @@ namespace Js
     JavascriptMap* JavascriptMap::CreateForSnapshotRestore(ScriptContext* ctx)
     {
         JavascriptMap* res = ctx->GetLibrary()->CreateMap();
-        res->map = RecyclerNew(ctx->GetRecycler(), MapDataMap, ctx->GetRecycler());
+        res->map.Initialize(ctx->GetRecycler());
 
         return res;
     }
@@ -10,15 +10,12 @@ namespace Js
     {
     public:
         typedef JsUtil::KeyValuePair<Var, Var> MapDataKeyValuePair;
-        typedef MapOrSetDataNode<MapDataKeyValuePair> MapDataNode;
-        typedef MapOrSetDataList<MapDataKeyValuePair> MapDataList;
-        typedef JsUtil::BaseDictionary<Var, MapDataNode*, Recycler, PowerOf2SizePolicy, SameValueZeroComparer> MapDataMap;
+        typedef MapOrSetDataTable<MapDataKeyValuePair> MapDataTable;
 
     private:
-        MapDataList list;
-        MapDataMap* map;
+        MapDataTable map;
 
-        DEFINE_VTABLE_CTOR_MEMBER_INIT(JavascriptMap, DynamicObject, list);
+        DEFINE_VTABLE_CTOR_MEMBER_INIT(JavascriptMap, DynamicObject, map);
         DEFINE_MARSHAL_OBJECT_TO_SCRIPT_CONTEXT(JavascriptMap);
 
     public:
@@ -36,7 +33,7 @@ namespace Js
         void Set(Var key, Var value);
         int Size();
 
-        MapDataList::Iterator GetIterator();
+        MapDataTable::Iterator GetIterator();
 
         virtual BOOL GetDiagTypeString(StringBuilder<ArenaAllocator>* stringBuilder, ScriptContext* requestContext) override;
 
@@ -69,6 +66,12 @@ namespace Js
         static Var EntryValues(RecyclableObject* function, CallInfo callInfo, ...);
         static Var EntryGetterSymbolSpecies(RecyclableObject* function, CallInfo callInfo, ...);
 
+        // Called from the JIT's inlined Map.prototype.get/has/set once it has checked that instance is a Map of
+        // the current script context, to skip the arguments and receiver checks of the entry points.
+        static Var DirectGet(Var instance, Var key);
+        static Var DirectHas(Var instance, Var key);
+        static Var DirectSet(Var instance, Var key, Var value);
+
 #if ENABLE_TTD
     public:
         virtual void MarkVisitKindSpecificPtrs(TTD::SnapshotExtractor* extractor) override;
@@ -1046,7 +1046,6 @@ case_2:
         GetThisAndSearchStringArguments(args, scriptContext, apiNameForErrorMsg, &pThis, &searchString, isRegExpAnAllowedArg);
 
         int len = pThis->GetLength();
-        int searchLen = searchString->GetLength();
 
         int position = 0;
 
@@ -1063,6 +1062,14 @@ case_2:
             }
         }
 
+        return IndexOfCore(pThis, searchString, position);
+    }
+
+    int JavascriptString::IndexOfCore(JavascriptString* pThis, JavascriptString* searchString, int position)
+    {
+        int len = pThis->GetLength();
+        int searchLen = searchString->GetLength();
+
         // Zero length search strings are always found at the current search position
         if (searchLen == 0)
         {
@@ -1787,6 +1794,13 @@ case_2:
             }
         }
 
+        return SliceCore(pThis, idxStart, idxEnd, scriptContext);
+    }
+
+    Var JavascriptString::SliceCore(JavascriptString* pThis, int idxStart, int idxEnd, ScriptContext* scriptContext)
+    {
+        int len = pThis->GetLength();
+
         if (idxStart < 0)
         {
             idxStart = max(len + idxStart, 0);
@@ -1812,6 +1826,23 @@ case_2:
         return SubstringCore(pThis, idxStart, idxEnd - idxStart, scriptContext);
     }
 
+    Var JavascriptString::DirectIndexOf(Var instance, Var search, Var position)
+    {
+        JavascriptString* pThis = JavascriptString::FromVar(instance);
+        int index = min(max(TaggedInt::ToInt32(position), 0), pThis->GetLengthAsSignedInt());
+
+        return JavascriptNumber::ToVar(IndexOfCore(pThis, JavascriptString::FromVar(search), index), pThis->GetScriptContext());
+    }
+
+    Var JavascriptString::DirectSlice(Var instance, Var start, Var end)
+    {
+        JavascriptString* pThis = JavascriptString::FromVar(instance);
+        ScriptContext* scriptContext = pThis->GetScriptContext();
+        int idxEnd = JavascriptOperators::IsUndefinedObject(end, scriptContext) ? pThis->GetLength() : TaggedInt::ToInt32(end);
+
+        return SliceCore(pThis, TaggedInt::ToInt32(start), idxEnd, scriptContext);
+    }
+
     Var JavascriptString::EntrySplit(RecyclableObject* function, CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -3064,6 +3095,66 @@ case_2:
         return FALSE;
     }
 
+    StringPieceReader::StringPieceReader(JavascriptString *const string, ArenaAllocator *const allocator)
+        : pieces(allocator)
+    {
+        Assert(string);
+        pieces.Push(StringPiece(string));
+    }
+
+    bool StringPieceReader::Read(const char16 **const charsRef, charcount_t *const lengthRef)
+    {
+        Assert(charsRef);
+        Assert(lengthRef);
+
+        while(!pieces.Empty())
+        {
+            const StringPiece piece = pieces.Pop();
+            if(!piece.string)
+            {
+                Assert(piece.length != 0);
+                *charsRef = piece.chars;
+                *lengthRef = piece.length;
+                return true;
+            }
+
+            JavascriptString *const s = piece.string;
+            if(s->GetLength() == 0)
+            {
+                continue;
+            }
+
+            if(!s->IsFinalized())
+            {
+                if(CompoundString::Is(s))
+                {
+                    CompoundString::FromVar(s)->PushPieces(pieces);
+                    continue;
+                }
+
+                JavascriptString * const *items;
+                const int itemCount = s->GetRandomAccessItemsFromConcatString(items);
+                if(itemCount >= 0)
+                {
+                    // Push in reverse so that the first item is read first
+                    for(int i = itemCount - 1; i >= 0; --i)
+                    {
+                        if(items[i])
+                        {
+                            pieces.Push(StringPiece(items[i]));
+                        }
+                    }
+                    continue;
+                }
+            }
+
+            *charsRef = s->GetString();
+            *lengthRef = s->GetLength();
+            return true;
+        }
+        return false;
+    }
+
 #ifdef TAGENTRY
 #undef TAGENTRY
 #endif
@@ -329,6 +329,12 @@ namespace Js
         static JavascriptString* RepeatCore(JavascriptString* currentString, charcount_t count, ScriptContext* scriptContext);
         static JavascriptString* PadCore(ArgumentReader& args, JavascriptString *mainString, bool isPadStart, ScriptContext* scriptContext);
         static Var SubstringCore(JavascriptString* str, int start, int span, ScriptContext* scriptContext);
+        static Var SliceCore(JavascriptString* str, int start, int end, ScriptContext* scriptContext);
+
+        // Called from the JIT's inlined String.prototype.indexOf/slice once it has checked that instance (and
+        // search) are strings of the current script context and that the indices are tagged ints.
+        static Var DirectIndexOf(Var instance, Var search, Var position);
+        static Var DirectSlice(Var instance, Var start, Var end);
         static charcount_t GetBufferLength(const char16 *content);
         static charcount_t GetBufferLength(const char16 *content, int charLengthOrMinusOne);
         static bool IsASCII7BitChar(char16 ch) { return ch < 0x0080; }
@@ -336,6 +342,7 @@ namespace Js
 
     private:
         static int IndexOf(ArgumentReader& args, ScriptContext* scriptContext, const char16* apiNameForErrorMsg, bool isRegExpAnAllowedArg);
+        static int IndexOfCore(JavascriptString* pThis, JavascriptString* searchString, int position);
         static void GetThisStringArgument(ArgumentReader& args, ScriptContext* scriptContext, const char16* apiNameForErrorMsg, JavascriptString** ppThis);
         static void GetThisAndSearchStringArguments(ArgumentReader& args, ScriptContext* scriptContext, const char16* apiNameForErrorMsg, JavascriptString** ppThis, JavascriptString** ppSearch, bool isRegExpAnAllowedArg);
 
@@ -370,6 +377,39 @@ namespace Js
         static Var CallRegExFunction(RecyclableObject* fnObj, Var regExp, Arguments& args);
     };
 
+    // A contiguous run of a string's characters, or a whole string (when 'string' is set) that has yet to be broken down
+    struct StringPiece
+    {
+        JavascriptString *string;
+        const char16 *chars;
+        charcount_t length;
+
+        StringPiece() : string(nullptr), chars(nullptr), length(0) {}
+        StringPiece(JavascriptString *const string) : string(string), chars(nullptr), length(0) {}
+        StringPiece(const char16 *const chars, const charcount_t length) : string(nullptr), chars(chars), length(length) {}
+    };
+
+    typedef JsUtil::Stack<StringPiece, ArenaAllocator> StringPieceStack;
+
+    // Reads the characters of a string in order, one contiguous piece at a time. Concat strings and compound strings are
+    // walked instead of being flattened, so that their contents can be consumed (for instance, transcoded into an external
+    // buffer) without first building a flat copy. Other lazily built strings are flattened individually as they are reached.
+    // Everything on the stack is reachable from the string being read, which the caller keeps alive.
+    class StringPieceReader
+    {
+    private:
+        StringPieceStack pieces;
+
+    public:
+        StringPieceReader(JavascriptString *const string, ArenaAllocator *const allocator);
+
+        // Returns false when there are no more characters. The returned piece is nonempty.
+        bool Read(const char16 **const charsRef, charcount_t *const lengthRef);
+
+    private:
+        PREVENT_COPY(StringPieceReader);
+    };
+
     template<>
     struct PropertyRecordStringHashComparer<JavascriptString *>
     {
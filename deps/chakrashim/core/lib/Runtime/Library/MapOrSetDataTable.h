@@ -0,0 +1,334 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// This is a special use insertion-ordered hash table whose iterators are
+// always valid no matter what modifications are made to the table during
+// iteration.
+//
+// Entries are stored densely in insertion order in a single recycler
+// allocated storage block, together with a power of 2 sized index table of
+// bucket heads. Entries that hash to the same bucket are chained through
+// an index stored in the entry, so a lookup touches no other allocation.
+// Removing an entry leaves a tombstone (an entry with a null key) in place,
+// which keeps both the chains and the iteration order intact. When the
+// entry array is full, the live entries are copied in order into a new
+// block that is larger, the same size or smaller as the live count
+// requires, dropping the tombstones.
+//
+// Iterators reference a storage block and a position in it rather than an
+// entry, and the table does not track them. A block that gets replaced
+// keeps a link to its successor along with the sorted positions of the
+// tombstones it dropped, so that an iterator still on it can translate its
+// position into the successor the next time it advances. Clear replaces
+// the block as well, moving such iterators to the start of the successor.
+//
+// The intended use of this table is to hold the items of ES6 Map and Set
+// objects. If a more general use is found for this data structure please
+// generalize it and consider moving it to Common\DataStructures.
+
+namespace Js
+{
+    template <typename TData>
+    struct MapOrSetDataTraits;
+
+    template <>
+    struct MapOrSetDataTraits<Var>
+    {
+        static Var GetKey(const Var& data) { return data; }
+        static void Clear(Var& data) { data = nullptr; }
+    };
+
+    template <>
+    struct MapOrSetDataTraits<JsUtil::KeyValuePair<Var, Var>>
+    {
+        static Var GetKey(const JsUtil::KeyValuePair<Var, Var>& data) { return data.Key(); }
+        static void Clear(JsUtil::KeyValuePair<Var, Var>& data) { data = JsUtil::KeyValuePair<Var, Var>(nullptr, nullptr); }
+    };
+
+    template <typename TData, typename TComparer = SameValueZeroComparer<Var>>
+    class MapOrSetDataTable
+    {
+    private:
+        typedef MapOrSetDataTraits<TData> Traits;
+
+        static const uint32 MinCapacity = 8;
+        static const int32 NoEntry = -1;
+
+        struct Entry
+        {
+            TData data;
+            hash_t hash;
+            int32 next;
+        };
+
+        // The entry array and the bucket heads are allocated inline after the header.
+        class Storage
+        {
+        public:
+            Storage* successor;
+            uint32* droppedPositions;
+            uint32 droppedCount;
+            bool cleared;
+            uint32 capacity;
+            uint32 count;
+
+            Storage(uint32 capacity)
+                : successor(nullptr), droppedPositions(nullptr), droppedCount(0), cleared(false), capacity(capacity), count(0)
+            {
+                Assert(Math::IsPow2(capacity));
+                memset(GetBuckets(), 0xFF, capacity * sizeof(int32));
+            }
+
+            static Storage* New(Recycler* recycler, uint32 capacity)
+            {
+                return RecyclerNewPlusZ(recycler, capacity * (sizeof(Entry) + sizeof(int32)), Storage, capacity);
+            }
+
+            Entry* GetEntries() { return reinterpret_cast<Entry*>(this + 1); }
+            int32* GetBuckets() { return reinterpret_cast<int32*>(GetEntries() + capacity); }
+
+            int32 Find(Var key, hash_t hash)
+            {
+                Entry* entries = GetEntries();
+                for (int32 i = GetBuckets()[hash & (capacity - 1)]; i != NoEntry; i = entries[i].next)
+                {
+                    Var entryKey = Traits::GetKey(entries[i].data);
+                    if (entries[i].hash == hash && entryKey != nullptr && TComparer::Equals(entryKey, key))
+                    {
+                        return i;
+                    }
+                }
+                return NoEntry;
+            }
+
+            void Append(const TData& data, hash_t hash)
+            {
+                Assert(count < capacity);
+                int32* bucket = &GetBuckets()[hash & (capacity - 1)];
+                Entry& entry = GetEntries()[count];
+                entry.data = data;
+                entry.hash = hash;
+                entry.next = *bucket;
+                *bucket = count++;
+            }
+
+            void Retire(Storage* successor, uint32* droppedPositions, uint32 droppedCount, bool cleared)
+            {
+                Assert(this->successor == nullptr);
+                this->successor = successor;
+                this->droppedPositions = droppedPositions;
+                this->droppedCount = droppedCount;
+                this->cleared = cleared;
+
+                // Only iterators can still reach this block; don't let it keep the old items alive.
+                memset(GetEntries(), 0, count * sizeof(Entry));
+            }
+
+            // Translates a position in this retired block to the matching position in its successor.
+            uint32 GetSuccessorPosition(uint32 position)
+            {
+                Assert(successor != nullptr);
+                if (cleared)
+                {
+                    return 0;
+                }
+
+                uint32 low = 0;
+                uint32 high = droppedCount;
+                while (low < high)
+                {
+                    uint32 mid = low + (high - low) / 2;
+                    if (droppedPositions[mid] < position)
+                    {
+                        low = mid + 1;
+                    }
+                    else
+                    {
+                        high = mid;
+                    }
+                }
+                return position - low;
+            }
+        };
+
+        Storage* storage;
+        uint32 liveCount;
+
+        template <bool overwrite>
+        bool Insert(const TData& data, Recycler* recycler)
+        {
+            Var key = Traits::GetKey(data);
+            hash_t hash = TComparer::GetHashCode(key);
+
+            int32 index = storage->Find(key, hash);
+            if (index != NoEntry)
+            {
+                if (overwrite)
+                {
+                    storage->GetEntries()[index].data = data;
+                }
+                return false;
+            }
+
+            if (storage->count == storage->capacity)
+            {
+                // Grow only if at least half of the entries are live; otherwise compacting frees enough room.
+                Resize(liveCount >= storage->capacity / 2 ? storage->capacity * 2 : storage->capacity, recycler);
+            }
+
+            storage->Append(data, hash);
+            liveCount++;
+            return true;
+        }
+
+        void Resize(uint32 newCapacity, Recycler* recycler)
+        {
+            Assert(newCapacity >= liveCount && newCapacity >= MinCapacity);
+
+            Storage* oldStorage = storage;
+            uint32 droppedCount = oldStorage->count - liveCount;
+            uint32* droppedPositions = droppedCount ? RecyclerNewArrayLeaf(recycler, uint32, droppedCount) : nullptr;
+            Storage* newStorage = Storage::New(recycler, newCapacity);
+
+            Entry* entries = oldStorage->GetEntries();
+            uint32 dropped = 0;
+            for (uint32 i = 0; i < oldStorage->count; i++)
+            {
+                if (Traits::GetKey(entries[i].data) == nullptr)
+                {
+                    droppedPositions[dropped++] = i;
+                }
+                else
+                {
+                    newStorage->Append(entries[i].data, entries[i].hash);
+                }
+            }
+            Assert(dropped == droppedCount);
+
+            oldStorage->Retire(newStorage, droppedPositions, droppedCount, false);
+            storage = newStorage;
+        }
+
+    public:
+        MapOrSetDataTable(VirtualTableInfoCtorEnum) { }
+        MapOrSetDataTable() : storage(nullptr), liveCount(0) { }
+
+        class Iterator
+        {
+            Storage* storage;
+            uint32 position;
+            uint32 current;
+        public:
+            Iterator() : storage(nullptr), position(0), current(0) { }
+            Iterator(Storage* storage) : storage(storage), position(0), current(0) { }
+
+            bool Next()
+            {
+                if (storage == nullptr)
+                {
+                    return false;
+                }
+
+                // The table may have been compacted, resized or cleared since we last moved.
+                while (storage->successor != nullptr)
+                {
+                    position = storage->GetSuccessorPosition(position);
+                    storage = storage->successor;
+                }
+
+                Entry* entries = storage->GetEntries();
+                for (; position < storage->count; position++)
+                {
+                    if (Traits::GetKey(entries[position].data) != nullptr)
+                    {
+                        current = position++;
+                        return true;
+                    }
+                }
+
+                storage = nullptr;
+                return false;
+            }
+
+            TData& Current()
+            {
+                Assert(storage != nullptr && storage->successor == nullptr);
+                return storage->GetEntries()[current].data;
+            }
+        };
+
+        bool IsInitialized() const
+        {
+            return storage != nullptr;
+        }
+
+        void Initialize(Recycler* recycler)
+        {
+            Assert(!IsInitialized());
+            storage = Storage::New(recycler, MinCapacity);
+        }
+
+        uint32 Count() const
+        {
+            return liveCount;
+        }
+
+        bool ContainsKey(Var key)
+        {
+            return storage->Find(key, TComparer::GetHashCode(key)) != NoEntry;
+        }
+
+        TData* Find(Var key)
+        {
+            int32 index = storage->Find(key, TComparer::GetHashCode(key));
+            return index != NoEntry ? &storage->GetEntries()[index].data : nullptr;
+        }
+
+        // Appends data unless its key is already present. Returns false if it was.
+        bool Add(const TData& data, Recycler* recycler)
+        {
+            return Insert<false>(data, recycler);
+        }
+
+        // Appends data, or replaces the data of the entry with the same key in place.
+        void Set(const TData& data, Recycler* recycler)
+        {
+            Insert<true>(data, recycler);
+        }
+
+        bool Remove(Var key, Recycler* recycler)
+        {
+            int32 index = storage->Find(key, TComparer::GetHashCode(key));
+            if (index == NoEntry)
+            {
+                return false;
+            }
+
+            // Leave the entry chained so lookups through it still reach the rest of the bucket.
+            Traits::Clear(storage->GetEntries()[index].data);
+            liveCount--;
+
+            if (liveCount < storage->capacity / 4 && storage->capacity > MinCapacity)
+            {
+                Resize(storage->capacity / 2, recycler);
+            }
+            return true;
+        }
+
+        void Clear(Recycler* recycler)
+        {
+            Storage* oldStorage = storage;
+            storage = Storage::New(recycler, MinCapacity);
+            liveCount = 0;
+            oldStorage->Retire(storage, nullptr, 0, true);
+        }
+
+        Iterator GetIterator()
+        {
+            return Iterator(storage);
+        }
+    };
+}
@@ -7,6 +7,7 @@
 // can share the same array buffer.
 //----------------------------------------------------------------------------
 #include "RuntimeLibraryPch.h"
+#include "DataStructures/TimSort.h"
 
 #define INSTANTIATE_BUILT_IN_ENTRYPOINTS(typeName) \
     template Var typeName::NewInstance(RecyclableObject* function, CallInfo callInfo, ...); \
@@ -2577,91 +2578,191 @@ namespace Js
         return JavascriptArray::SomeHelper(nullptr, typedArrayBase, typedArrayBase, length, args, scriptContext);
     }
 
-    template<typename T> int __cdecl TypedArrayCompareElementsHelper(void* context, const void* elem1, const void* elem2)
+    template<typename T>
+    class TypedArrayElementComparer
     {
-        const T* element1 = static_cast<const T*>(elem1);
-        const T* element2 = static_cast<const T*>(elem2);
+    private:
+        TypedArrayBase* typedArray;
+        RecyclableObject* compFn;
 
-        Assert(element1 != nullptr);
-        Assert(element2 != nullptr);
-        Assert(context != nullptr);
+    public:
+        TypedArrayElementComparer(TypedArrayBase* typedArray, RecyclableObject* compFn) : typedArray(typedArray), compFn(compFn) { }
 
-        const T x = *element1;
-        const T y = *element2;
-
-        if (NumberUtilities::IsNan((double)x))
+        int operator()(const T& x, const T& y)
         {
-            if (NumberUtilities::IsNan((double)y))
+            if (NumberUtilities::IsNan((double)x))
             {
-                return 0;
-            }
+                if (NumberUtilities::IsNan((double)y))
+                {
+                    return 0;
+                }
 
-            return 1;
-        }
-        else
-        {
-            if (NumberUtilities::IsNan((double)y))
-            {
-                return -1;
+                return 1;
             }
-        }
-
-        void **contextArray = (void **)context;
-        if (contextArray[1] != nullptr)
-        {
-            RecyclableObject* compFn = RecyclableObject::FromVar(contextArray[1]);
-            ScriptContext* scriptContext = compFn->GetScriptContext();
-            Var undefined = scriptContext->GetLibrary()->GetUndefined();
-            double dblResult;
-            Var retVal = CALL_FUNCTION(compFn, CallInfo(CallFlags_Value, 3),
-                undefined,
-                JavascriptNumber::ToVarWithCheck((double)x, scriptContext),
-                JavascriptNumber::ToVarWithCheck((double)y, scriptContext));
-
-            Assert(TypedArrayBase::Is(contextArray[0]));
-            if (TypedArrayBase::IsDetachedTypedArray(contextArray[0]))
+            else
             {
-                JavascriptError::ThrowTypeError(scriptContext, JSERR_DetachedTypedArray, _u("[TypedArray].prototype.sort"));
+                if (NumberUtilities::IsNan((double)y))
+                {
+                    return -1;
+                }
             }
 
-            if (TaggedInt::Is(retVal))
+            if (compFn != nullptr)
             {
-                return TaggedInt::ToInt32(retVal);
-            }
+                ScriptContext* scriptContext = compFn->GetScriptContext();
+                Var undefined = scriptContext->GetLibrary()->GetUndefined();
+                double dblResult;
+                Var retVal = CALL_FUNCTION(compFn, CallInfo(CallFlags_Value, 3),
+                    undefined,
+                    JavascriptNumber::ToVarWithCheck((double)x, scriptContext),
+                    JavascriptNumber::ToVarWithCheck((double)y, scriptContext));
+
+                if (typedArray->IsDetachedBuffer())
+                {
+                    JavascriptError::ThrowTypeError(scriptContext, JSERR_DetachedTypedArray, _u("[TypedArray].prototype.sort"));
+                }
 
-            if (JavascriptNumber::Is_NoTaggedIntCheck(retVal))
-            {
-                dblResult = JavascriptNumber::GetValue(retVal);
+                if (TaggedInt::Is(retVal))
+                {
+                    return TaggedInt::ToInt32(retVal);
+                }
+
+                if (JavascriptNumber::Is_NoTaggedIntCheck(retVal))
+                {
+                    dblResult = JavascriptNumber::GetValue(retVal);
+                }
+                else
+                {
+                    dblResult = JavascriptConversion::ToNumber_Full(retVal, scriptContext);
+                }
+
+                if (dblResult < 0)
+                {
+                    return -1;
+                }
+                else if (dblResult > 0)
+                {
+                    return 1;
+                }
+
+                return 0;
             }
             else
             {
-                dblResult = JavascriptConversion::ToNumber_Full(retVal, scriptContext);
+                if (x < y)
+                {
+                    return -1;
+                }
+                else if (x > y)
+                {
+                    return 1;
+                }
+                else if (x == 0)
+                {
+                    // -0 sorts before +0
+                    return (int)JavascriptNumber::IsNegZero((double)y) - (int)JavascriptNumber::IsNegZero((double)x);
+                }
+
+                return 0;
             }
+        }
+    };
+
+    // Element types with few enough values to sort by counting how often each value occurs.
+    template<typename T> struct TypedArrayCountingSortTraits { static const uint32 ValueCount = 0; static const int32 Bias = 0; };
+    template<> struct TypedArrayCountingSortTraits<int8> { static const uint32 ValueCount = 1 << 8; static const int32 Bias = 1 << 7; };
+    template<> struct TypedArrayCountingSortTraits<uint8> { static const uint32 ValueCount = 1 << 8; static const int32 Bias = 0; };
+    template<> struct TypedArrayCountingSortTraits<int16> { static const uint32 ValueCount = 1 << 16; static const int32 Bias = 1 << 15; };
+    template<> struct TypedArrayCountingSortTraits<uint16> { static const uint32 ValueCount = 1 << 16; static const int32 Bias = 0; };
+
+    // Only instantiated with a real sort for the element types above, so the float types don't emit one.
+    template<typename T, bool canCount = TypedArrayCountingSortTraits<T>::ValueCount != 0>
+    struct TypedArrayCountingSort
+    {
+        static bool TrySort(T* elements, uint32 length, ScriptContext* scriptContext) { return false; }
+    };
+
+    template<typename T>
+    struct TypedArrayCountingSort<T, true>
+    {
+        typedef TypedArrayCountingSortTraits<T> Traits;
 
-            if (dblResult < 0)
+        // Small integers are cheaper to count than to compare once there are enough of them.
+        static bool TrySort(T* elements, uint32 length, ScriptContext* scriptContext)
+        {
+            if (length < Traits::ValueCount / 8)
             {
-                return -1;
+                return false;
             }
-            else if (dblResult > 0)
+
+            BEGIN_TEMP_ALLOCATOR(tempAlloc, scriptContext, _u("Runtime"))
             {
-                return 1;
-            }
+                uint32* counts = AnewArrayZ(tempAlloc, uint32, Traits::ValueCount);
+                for (uint32 i = 0; i < length; i++)
+                {
+                    counts[(int32)elements[i] + Traits::Bias]++;
+                }
 
-            return 0;
+                T* dest = elements;
+                for (uint32 index = 0; index < Traits::ValueCount; index++)
+                {
+                    for (uint32 count = counts[index]; count != 0; count--)
+                    {
+                        *dest++ = (T)((int32)index - Traits::Bias);
+                    }
+                }
+                Assert(dest == elements + length);
+            }
+            END_TEMP_ALLOCATOR(tempAlloc, scriptContext);
+            return true;
         }
-        else
+    };
+
+    template<typename T>
+    static void TypedArraySortHelper(TypedArrayBase* typedArray, RecyclableObject* compFn)
+    {
+        typedef JsUtil::TimSort<T, TypedArrayElementComparer<T>> ElementTimSort;
+
+        ScriptContext* scriptContext = typedArray->GetScriptContext();
+        Recycler* recycler = scriptContext->GetRecycler();
+        uint32 length = typedArray->GetLength();
+        T* elements = reinterpret_cast<T*>(typedArray->GetByteBuffer());
+        TypedArrayElementComparer<T> comparer(typedArray, compFn);
+
+        if (compFn == nullptr)
         {
-            if (x < y)
-            {
-                return -1;
-            }
-            else if (x > y)
+            // Nothing can observe or change the buffer while it is sorted, so sort it in place.
+            if (TypedArrayCountingSort<T>::TrySort(elements, length, scriptContext))
             {
-                return 1;
+                return;
             }
 
-            return 0;
+            uint32 scratchLength = ElementTimSort::GetScratchLength(length);
+            T* scratch = scratchLength != 0 ? RecyclerNewArrayLeaf(recycler, T, scratchLength) : nullptr;
+            ElementTimSort::Sort(elements, length, scratch, comparer);
+            return;
         }
+
+        // The comparer can detach the buffer or write to it, so sort a copy and store it back once it's sorted.
+        uint32 scratchLength = ElementTimSort::GetScratchLength(length);
+        T* copy = RecyclerNewArrayLeaf(recycler, T, length + scratchLength);
+        js_memcpy_s(copy, length * sizeof(T), elements, length * sizeof(T));
+
+        ElementTimSort::Sort(copy, length, scratchLength != 0 ? copy + length : nullptr, comparer);
+
+        Assert(!typedArray->IsDetachedBuffer());
+        js_memcpy_s(elements, length * sizeof(T), copy, length * sizeof(T));
+    }
+
+    template <typename TypeName, bool clamped, bool virtualAllocated>
+    void TypedArray<TypeName, clamped, virtualAllocated>::SortElements(RecyclableObject* compareFn)
+    {
+        TypedArraySortHelper<TypeName>(this, compareFn);
+    }
+
+    void CharArray::SortElements(RecyclableObject* compareFn)
+    {
+        TypedArraySortHelper<char16>(this, compareFn);
     }
 
     Var TypedArrayBase::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
@@ -2707,19 +2808,7 @@ namespace Js
             compareFn = RecyclableObject::FromVar(args[1]);
         }
 
-        // Get the elements comparison function for the type of this TypedArray
-        void* elementCompare = reinterpret_cast<void*>(typedArrayBase->GetCompareElementsFunction());
-
-        Assert(elementCompare);
-
-        // Cast compare to the correct function type
-        int(__cdecl*elementCompareFunc)(void*, const void*, const void*) = (int(__cdecl*)(void*, const void*, const void*))elementCompare;
-
-        void * contextToPass[] = { typedArrayBase, compareFn };
-
-        // We can always call qsort_s with the same arguments. If user compareFn is non-null, the callback will use it to do the comparison.
-        qsort_s(typedArrayBase->GetByteBuffer(), length, typedArrayBase->GetBytesPerElement(), elementCompareFunc, contextToPass);
-
+        typedArrayBase->SortElements(compareFn);
 
         return typedArrayBase;
     }
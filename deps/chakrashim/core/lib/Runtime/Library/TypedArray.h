@@ -10,8 +10,6 @@ namespace Js
 {
     typedef Var (*PFNCreateTypedArray)(Js::ArrayBuffer* arrayBuffer, uint32 offSet, uint32 mappedLength, Js::JavascriptLibrary* javascriptLibrary);
 
-    template<typename T> int __cdecl TypedArrayCompareElementsHelper(void* context, const void* elem1, const void* elem2);
-
     class TypedArrayBase : public ArrayBufferParent
     {
         friend ArrayBuffer;
@@ -175,8 +173,8 @@ namespace Js
         static int32 ToLengthChecked(Var lengthVar, uint32 elementSize, ScriptContext* scriptContext);
         static bool ArrayIteratorPrototypeHasUserDefinedNext(ScriptContext *scriptContext);
 
-        typedef int(__cdecl* CompareElementsFunction)(void*, const void*, const void*);
-        virtual CompareElementsFunction GetCompareElementsFunction() = 0;
+        // Sorts the elements in place, by compareFn if it isn't null and numerically otherwise.
+        virtual void SortElements(RecyclableObject* compareFn) = 0;
 
         virtual Var Subarray(uint32 begin, uint32 end) = 0;
         int32 BYTES_PER_ELEMENT;
@@ -423,10 +421,7 @@ namespace Js
         }
 
     protected:
-        CompareElementsFunction GetCompareElementsFunction()
-        {
-            return &TypedArrayCompareElementsHelper<TypeName>;
-        }
+        void SortElements(RecyclableObject* compareFn);
     };
 
     // in windows build environment, char16 is not an intrinsic type, and we cannot do the type
@@ -469,10 +464,7 @@ namespace Js
         virtual Var  DirectGetItem(__in uint32 index) override;
 
     protected:
-        CompareElementsFunction GetCompareElementsFunction()
-        {
-            return &TypedArrayCompareElementsHelper<char16>;
-        }
+        void SortElements(RecyclableObject* compareFn);
     };
 
 #if defined(__clang__)
@@ -78,6 +78,9 @@ LIBRARY_FUNCTION(RegExp,        SymbolSearch,       2,    BIF_UseSrc0
 LIBRARY_FUNCTION(Math,          Fround,             1,    BIF_TypeSpecUnaryToFloat                              , Math::EntryInfo::Fround)
 LIBRARY_FUNCTION(String,        PadStart,           2,    BIF_UseSrc0 | BIF_VariableArgsNumber                  , JavascriptString::EntryInfo::PadStart)
 LIBRARY_FUNCTION(String,        PadEnd,             2,    BIF_UseSrc0 | BIF_VariableArgsNumber                  , JavascriptString::EntryInfo::PadEnd)
+LIBRARY_FUNCTION(Map,           Get,                2,    BIF_UseSrc0                                           , JavascriptMap::EntryInfo::Get)
+LIBRARY_FUNCTION(Map,           Has,                2,    BIF_UseSrc0                                           , JavascriptMap::EntryInfo::Has)
+LIBRARY_FUNCTION(Map,           Set,                3,    BIF_UseSrc0 | BIF_IgnoreDst                           , JavascriptMap::EntryInfo::Set)
 
 // Note: 1st column is currently used only for debug tracing.
 
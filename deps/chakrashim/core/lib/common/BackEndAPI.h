@@ -265,6 +265,7 @@ enum VTableValue {
     VtableNativeFloatArray,
     VtableJavascriptNativeIntArray,
     VtableJavascriptRegExp,
+    VtableJavascriptMap,
     VtableScriptFunction,
     VtableJavascriptGeneratorFunction,
     VtableStackScriptFunction,
@@ -310,6 +310,11 @@
 #define VTUNE_PROFILING
 #endif
 
+// perf map and jitdump support reuses the native offset maps recorded for VTune
+#if defined(VTUNE_PROFILING) && !defined(_WIN32)
+#define PERF_JIT_PROFILING
+#endif
+
 
 #ifdef NTBUILD
 #define PERF_COUNTERS
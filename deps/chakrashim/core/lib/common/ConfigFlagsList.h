@@ -165,9 +165,11 @@ PHASE(All)
                 PHASE(MemOp)
                     PHASE(MemSet)
                     PHASE(MemCopy)
+                    PHASE(MemVector)
                 PHASE(IncrementalBailout)
             PHASE(DeadStore)
                 PHASE(ReverseCopyProp)
+                PHASE(ScalarReplaceObject)
                 PHASE(MarkTemp)
                     PHASE(MarkTempNumber)
                     PHASE(MarkTempObject)
@@ -198,6 +200,9 @@ PHASE(All)
             PHASE(CFGInJit)
             PHASE(TypedArray)
             PHASE(TracePinnedTypes)
+#if defined(_M_X64)
+            PHASE(Avx)
+#endif
         PHASE(InterruptProbe)
         PHASE(EncodeConstants)
         PHASE(RegAlloc)
@@ -387,6 +392,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_ForceCleanPropertyOnCollect (false)
 #define DEFAULT_CONFIG_ForceCleanCacheOnCollect (false)
 #define DEFAULT_CONFIG_ForceGCAfterJSONParse (false)
+#define DEFAULT_CONFIG_JsonStringifyTypeCache (true)
 #define DEFAULT_CONFIG_ForceSerialized      (false)
 #define DEFAULT_CONFIG_ForceES5Array        (false)
 #define DEFAULT_CONFIG_ForceAsmJsLinkFail   (false)
@@ -407,6 +413,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_LeafInlineThreshold  (60)            //Inlinee threshold for function which is leaf (irrespective of it has loops or not)
 #define DEFAULT_CONFIG_LoopInlineThreshold  (25)            //Inlinee threshold for function with loops
 #define DEFAULT_CONFIG_PolymorphicInlineThreshold  (35)     //Polymorphic inline threshold
+#define DEFAULT_CONFIG_PolymorphicInlineTargetCount (4)    //Number of the hottest targets of a polymorphic call site to inline
 #define DEFAULT_CONFIG_InlineCountMax       (1200)          //Max sum of bytecodes of inlinees inlined into a function (excluding built-ins)
 #define DEFAULT_CONFIG_InlineCountMaxInLoopBodies (500)     // Max sum of bytecodes of inlinees that can be inlined into a jitted loop body (excluding built-ins)
 #define DEFAULT_CONFIG_AggressiveInlineCountMax       (8000)          //Max sum of bytecodes of inlinees inlined into a function (excluding built-ins) when inlined aggressively
@@ -467,6 +474,7 @@ PHASE(All)
 
 #define DEFAULT_CONFIG_DeferParseThreshold             (4 * 1024) // Unit is number of characters
 #define DEFAULT_CONFIG_ProfileBasedDeferParseThreshold (100)      // Unit is number of characters
+#define DEFAULT_CONFIG_ParallelParseThreshold          (64 * 1024) // Unit is number of characters
 
 #define DEFAULT_CONFIG_ProfileBasedSpeculativeJit (true)
 #define DEFAULT_CONFIG_WininetProfileCache        (true)
@@ -870,6 +878,10 @@ FLAGNR(Boolean, DirectCallTelemetryStats, "Enables logging stats for direct call
 FLAGNR(Boolean, DisableArrayBTree     , "Disable creation of BTree for Arrays", false)
 FLAGNR(Boolean, DisableRentalThreading, "Disable rental threading when creating runtime", DEFAULT_CONFIG_DisableRentalThreading)
 FLAGNR(Boolean, DisableVTuneSourceLineInfo, "Disable VTune Source line info for Dynamic JITted code", false)
+#ifdef PERF_JIT_PROFILING
+FLAGR (Boolean, PerfMap               , "Write JITted code symbols to /tmp/perf-<pid>.map for Linux perf", false)
+FLAGR (Boolean, PerfJitDump           , "Write JITted code and line info to /tmp/jit-<pid>.dump for perf inject --jit", false)
+#endif
 FLAGNR(Boolean, DisplayMemStats, "Display memory usage statistics", false)
 FLAGNR(Phases,  Dump                  , "What All to dump", )
 #ifdef DUMP_FRAGMENTATION_STATS
@@ -1031,6 +1043,7 @@ FLAGNR(Boolean, ForceArrayBTree       , "Force enable creation of BTree for Arra
 FLAGNR(Boolean, ForceCleanPropertyOnCollect, "Force cleaning of property on collection", DEFAULT_CONFIG_ForceCleanPropertyOnCollect)
 FLAGNR(Boolean, ForceCleanCacheOnCollect, "Force cleaning of dynamic caches on collection", DEFAULT_CONFIG_ForceCleanCacheOnCollect)
 FLAGNR(Boolean, ForceGCAfterJSONParse, "Force GC to happen after JSON parsing", DEFAULT_CONFIG_ForceGCAfterJSONParse)
+FLAGR (Boolean, JsonStringifyTypeCache, "Serialize objects sharing a path type from a per-type member cache in JSON.stringify", DEFAULT_CONFIG_JsonStringifyTypeCache)
 FLAGNR(Boolean, ForceDecommitOnCollect, "Force decommit collect", DEFAULT_CONFIG_ForceDecommitOnCollect)
 FLAGNR(Boolean, ForceDeferParse       , "Defer parsing of all function bodies", DEFAULT_CONFIG_ForceDeferParse)
 FLAGNR(Boolean, ForceDiagnosticsMode  , "Enable diagnostics mode and debug interpreter loop", false)
@@ -1120,6 +1133,7 @@ FLAGNR(Number,  MaxNumberOfInlineesWithLoop, "Number of times to allow inlinees
 FLAGNR(Phases,  Memspect,              "Enables memspect tracking to perform memory investigations.", )
 #endif
 FLAGNR(Number,  PolymorphicInlineThreshold     , "Maximum size in bytecodes of a polymorphic inline candidate", DEFAULT_CONFIG_PolymorphicInlineThreshold)
+FLAGNR(Number,  PolymorphicInlineTargetCount   , "Number of the hottest targets of a polymorphic call site to inline (min: 2, max: 4)", DEFAULT_CONFIG_PolymorphicInlineTargetCount)
 FLAGNR(Boolean, PrimeRecycler         , "Prime the recycler first", DEFAULT_CONFIG_PrimeRecycler)
 FLAGNR(Boolean, PrivateHeap           , "Use HeapAlloc with a private heap", DEFAULT_CONFIG_PrivateHeap)
 #if defined(CHECK_MEMORY_LEAK) || defined(LEAK_REPORT)
@@ -1173,6 +1187,7 @@ FLAGNR(Number,  MaxSingleCharStrJumpTableRatio, "Maximum single char string jump
 FLAGNR(Number,  MinSwitchJumpTableSize , "Minimum size of the jump table, that is created for consecutive integer case arms in a Switch Statement",DEFAULT_CONFIG_MinSwitchJumpTableSize)
 FLAGNR(Number,  MaxLinearStringCaseCount,  "Maximum number of string cases(in switch statement) for which instructions can be generated linearly",DEFAULT_CONFIG_MaxLinearStringCaseCount)
 FLAGR(Number,   MinDeferredFuncTokenCount, "Minimum length in tokens of defer-parsed function", DEFAULT_CONFIG_MinDeferredFuncTokenCount)
+FLAGR(Number,   ParallelParseThreshold, "Minimum length in characters of a script whose function bodies are parsed on background threads", DEFAULT_CONFIG_ParallelParseThreshold)
 #if DBG
 FLAGNR(Number,  SkipFuncCountForBailOnNoProfile,  "Initial Number of functions in a func body to be skipped from forcibly inserting BailOnNoProfile.", DEFAULT_CONFIG_SkipFuncCountForBailOnNoProfile)
 #endif
@@ -0,0 +1,607 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace JsUtil
+{
+    // A stable, adaptive merge sort (TimSort). The input is split into ascending runs, short runs are
+    // extended with a binary insertion sort, and runs are merged pairwise while keeping the run lengths
+    // on the stack balanced. Merges gallop when one run keeps winning, so partially sorted input costs
+    // close to n comparisons.
+    //
+    // TComparer is a functor returning a negative, zero or positive int. It may throw: every element
+    // is back in the array (in some order) when an exception leaves Sort. The caller supplies the
+    // scratch buffer, of at least GetScratchLength(length) elements, so that it can allocate it where
+    // the garbage collector sees its contents if T holds references.
+    template <class T, class TComparer>
+    class TimSort
+    {
+    public:
+        static uint32 GetScratchLength(uint32 length)
+        {
+            return length < MinMerge ? 0 : length / 2;
+        }
+
+        static void Sort(__inout_ecount(length) T* elements, uint32 length, T* scratch, TComparer& comparer)
+        {
+            Assert(length <= INT_MAX);
+            int32 remaining = (int32)length;
+            if (remaining < 2)
+            {
+                return;
+            }
+
+            if (remaining < MinMerge)
+            {
+                int32 runLength = CountRunAndMakeAscending(elements, 0, remaining, comparer);
+                BinarySort(elements, 0, remaining, runLength, comparer);
+                return;
+            }
+
+            Assert(scratch != nullptr);
+            TimSort sorter(elements, scratch, comparer);
+            int32 minRun = MinRunLength(remaining);
+            int32 low = 0;
+            do
+            {
+                int32 runLength = CountRunAndMakeAscending(elements, low, low + remaining, comparer);
+                if (runLength < minRun)
+                {
+                    int32 forced = remaining <= minRun ? remaining : minRun;
+                    BinarySort(elements, low, low + forced, low + runLength, comparer);
+                    runLength = forced;
+                }
+
+                sorter.PushRun(low, runLength);
+                sorter.MergeCollapse();
+
+                low += runLength;
+                remaining -= runLength;
+            } while (remaining != 0);
+
+            sorter.MergeForceCollapse();
+            Assert(sorter.runCount == 1);
+        }
+
+    private:
+        // Runs shorter than this are extended by insertion; arrays shorter than this are not merged at all.
+        static const int32 MinMerge = 32;
+        static const int32 InitialMinGallop = 7;
+
+        // Enough for any int32 length given the invariants MergeCollapse maintains.
+        static const int32 MaxRunCount = 49;
+
+        T* elements;
+        T* scratch;
+        TComparer& comparer;
+        int32 minGallop;
+        int32 runCount;
+        int32 runBase[MaxRunCount];
+        int32 runLength[MaxRunCount];
+
+        TimSort(T* elements, T* scratch, TComparer& comparer)
+            : elements(elements), scratch(scratch), comparer(comparer), minGallop(InitialMinGallop), runCount(0)
+        {
+        }
+
+        static void MoveElements(T* dest, const T* src, int32 count)
+        {
+            memmove(dest, src, count * sizeof(T));
+        }
+
+        static int32 MinRunLength(int32 length)
+        {
+            int32 r = 0;
+            while (length >= MinMerge)
+            {
+                r |= (length & 1);
+                length >>= 1;
+            }
+            return length + r;
+        }
+
+        static int32 NextGallopOffset(int32 offset, int32 maxOffset)
+        {
+            return offset > (INT_MAX - 1) / 2 ? maxOffset : (offset << 1) + 1;
+        }
+
+        // Returns the length of the run starting at low, reversing it in place if it is strictly descending.
+        static int32 CountRunAndMakeAscending(T* a, int32 low, int32 high, TComparer& comparer)
+        {
+            Assert(low < high);
+            int32 runHigh = low + 1;
+            if (runHigh == high)
+            {
+                return 1;
+            }
+
+            if (comparer(a[runHigh++], a[low]) < 0)
+            {
+                while (runHigh < high && comparer(a[runHigh], a[runHigh - 1]) < 0)
+                {
+                    runHigh++;
+                }
+
+                for (int32 i = low, j = runHigh - 1; i < j; i++, j--)
+                {
+                    T t = a[i];
+                    a[i] = a[j];
+                    a[j] = t;
+                }
+            }
+            else
+            {
+                while (runHigh < high && comparer(a[runHigh], a[runHigh - 1]) >= 0)
+                {
+                    runHigh++;
+                }
+            }
+
+            return runHigh - low;
+        }
+
+        // Sorts a[low, high) given that a[low, start) is already sorted.
+        static void BinarySort(T* a, int32 low, int32 high, int32 start, TComparer& comparer)
+        {
+            Assert(low < start && start <= high);
+            for (; start < high; start++)
+            {
+                T pivot = a[start];
+                int32 left = low;
+                int32 right = start;
+                while (left < right)
+                {
+                    int32 mid = left + (right - left) / 2;
+                    if (comparer(pivot, a[mid]) < 0)
+                    {
+                        right = mid;
+                    }
+                    else
+                    {
+                        left = mid + 1;
+                    }
+                }
+
+                MoveElements(a + left + 1, a + left, start - left);
+                a[left] = pivot;
+            }
+        }
+
+        // Returns the index in a[base, base + length) before the first element >= key, searching from hint outwards.
+        static int32 GallopLeft(const T& key, T* a, int32 base, int32 length, int32 hint, TComparer& comparer)
+        {
+            Assert(length > 0 && hint >= 0 && hint < length);
+            int32 lastOffset = 0;
+            int32 offset = 1;
+            if (comparer(key, a[base + hint]) > 0)
+            {
+                int32 maxOffset = length - hint;
+                while (offset < maxOffset && comparer(key, a[base + hint + offset]) > 0)
+                {
+                    lastOffset = offset;
+                    offset = NextGallopOffset(offset, maxOffset);
+                }
+                offset = min(offset, maxOffset);
+                lastOffset += hint;
+                offset += hint;
+            }
+            else
+            {
+                int32 maxOffset = hint + 1;
+                while (offset < maxOffset && comparer(key, a[base + hint - offset]) <= 0)
+                {
+                    lastOffset = offset;
+                    offset = NextGallopOffset(offset, maxOffset);
+                }
+                offset = min(offset, maxOffset);
+                int32 t = lastOffset;
+                lastOffset = hint - offset;
+                offset = hint - t;
+            }
+
+            // a[base + lastOffset] < key <= a[base + offset]; binary search the gap.
+            lastOffset++;
+            while (lastOffset < offset)
+            {
+                int32 mid = lastOffset + (offset - lastOffset) / 2;
+                if (comparer(key, a[base + mid]) > 0)
+                {
+                    lastOffset = mid + 1;
+                }
+                else
+                {
+                    offset = mid;
+                }
+            }
+            return offset;
+        }
+
+        // Like GallopLeft, but returns the index after the last element <= key, so equal elements stay in order.
+        static int32 GallopRight(const T& key, T* a, int32 base, int32 length, int32 hint, TComparer& comparer)
+        {
+            Assert(length > 0 && hint >= 0 && hint < length);
+            int32 lastOffset = 0;
+            int32 offset = 1;
+            if (comparer(key, a[base + hint]) < 0)
+            {
+                int32 maxOffset = hint + 1;
+                while (offset < maxOffset && comparer(key, a[base + hint - offset]) < 0)
+                {
+                    lastOffset = offset;
+                    offset = NextGallopOffset(offset, maxOffset);
+                }
+                offset = min(offset, maxOffset);
+                int32 t = lastOffset;
+                lastOffset = hint - offset;
+                offset = hint - t;
+            }
+            else
+            {
+                int32 maxOffset = length - hint;
+                while (offset < maxOffset && comparer(key, a[base + hint + offset]) >= 0)
+                {
+                    lastOffset = offset;
+                    offset = NextGallopOffset(offset, maxOffset);
+                }
+                offset = min(offset, maxOffset);
+                lastOffset += hint;
+                offset += hint;
+            }
+
+            lastOffset++;
+            while (lastOffset < offset)
+            {
+                int32 mid = lastOffset + (offset - lastOffset) / 2;
+                if (comparer(key, a[base + mid]) < 0)
+                {
+                    offset = mid;
+                }
+                else
+                {
+                    lastOffset = mid + 1;
+                }
+            }
+            return offset;
+        }
+
+        void PushRun(int32 base, int32 length)
+        {
+            Assert(runCount < MaxRunCount);
+            runBase[runCount] = base;
+            runLength[runCount] = length;
+            runCount++;
+        }
+
+        // Merges runs until, for the top runs X, Y, Z of the stack: len(X) > len(Y) + len(Z) and len(Y) > len(Z).
+        void MergeCollapse()
+        {
+            while (runCount > 1)
+            {
+                int32 n = runCount - 2;
+                if ((n > 0 && runLength[n - 1] <= runLength[n] + runLength[n + 1]) ||
+                    (n > 1 && runLength[n - 2] <= runLength[n] + runLength[n - 1]))
+                {
+                    if (runLength[n - 1] < runLength[n + 1])
+                    {
+                        n--;
+                    }
+                }
+                else if (runLength[n] > runLength[n + 1])
+                {
+                    break;
+                }
+                MergeAt(n);
+            }
+        }
+
+        void MergeForceCollapse()
+        {
+            while (runCount > 1)
+            {
+                int32 n = runCount - 2;
+                if (n > 0 && runLength[n - 1] < runLength[n + 1])
+                {
+                    n--;
+                }
+                MergeAt(n);
+            }
+        }
+
+        // Merges the runs at stack indices i and i + 1.
+        void MergeAt(int32 i)
+        {
+            Assert(i >= 0 && (i == runCount - 2 || i == runCount - 3));
+            int32 base1 = runBase[i];
+            int32 length1 = runLength[i];
+            int32 base2 = runBase[i + 1];
+            int32 length2 = runLength[i + 1];
+            Assert(base1 + length1 == base2);
+
+            runLength[i] = length1 + length2;
+            if (i == runCount - 3)
+            {
+                runBase[i + 1] = runBase[i + 2];
+                runLength[i + 1] = runLength[i + 2];
+            }
+            runCount--;
+
+            // Elements of run 1 that precede all of run 2, and elements of run 2 that follow all of run 1, are in place already.
+            int32 k = GallopRight(elements[base2], elements, base1, length1, 0, comparer);
+            base1 += k;
+            length1 -= k;
+            if (length1 == 0)
+            {
+                return;
+            }
+
+            length2 = GallopLeft(elements[base1 + length1 - 1], elements, base2, length2, length2 - 1, comparer);
+            if (length2 == 0)
+            {
+                return;
+            }
+
+            if (length1 <= length2)
+            {
+                MergeLo(base1, length1, base2, length2);
+            }
+            else
+            {
+                MergeHi(base1, length1, base2, length2);
+            }
+        }
+
+        // Merges adjacent runs front to back, with the shorter first run moved to the scratch buffer.
+        void MergeLo(int32 base1, int32 length1, int32 base2, int32 length2)
+        {
+            Assert(length1 > 0 && length2 > 0 && base1 + length1 == base2);
+            T* a = elements;
+            MoveElements(scratch, a + base1, length1);
+
+            int32 cursor1 = 0;
+            int32 cursor2 = base2;
+            int32 dest = base1;
+
+            // Invariant at every comparison: dest + length1 == cursor2, so the rest of the
+            // scratch run fits back into the gap if the comparer throws.
+            TryFinally([&]()
+            {
+                MergeLoCore(cursor1, length1, cursor2, length2, dest);
+            },
+            [&](bool hasException)
+            {
+                if (hasException)
+                {
+                    MoveElements(a + dest, scratch + cursor1, length1);
+                }
+            });
+            minGallop = max(minGallop, 1);
+
+            if (length1 == 1)
+            {
+                MoveElements(a + dest, a + cursor2, length2);
+                a[dest + length2] = scratch[cursor1];
+            }
+            else if (length1 > 0)
+            {
+                // length2 ran out first
+                Assert(length2 == 0);
+                MoveElements(a + dest, scratch + cursor1, length1);
+            }
+            // else the comparer is inconsistent; every element is in the array already.
+        }
+
+        void MergeLoCore(int32& cursor1, int32& length1, int32& cursor2, int32& length2, int32& dest)
+        {
+            T* a = elements;
+            T* tmp = scratch;
+
+            a[dest++] = a[cursor2++];
+            if (--length2 == 0 || length1 == 1)
+            {
+                return;
+            }
+
+            for (;;)
+            {
+                int32 count1 = 0;
+                int32 count2 = 0;
+
+                // One element at a time until one run starts winning consistently.
+                do
+                {
+                    if (comparer(a[cursor2], tmp[cursor1]) < 0)
+                    {
+                        a[dest++] = a[cursor2++];
+                        count2++;
+                        count1 = 0;
+                        if (--length2 == 0)
+                        {
+                            return;
+                        }
+                    }
+                    else
+                    {
+                        a[dest++] = tmp[cursor1++];
+                        count1++;
+                        count2 = 0;
+                        if (--length1 == 1)
+                        {
+                            return;
+                        }
+                    }
+                } while ((count1 | count2) < minGallop);
+
+                // Gallop until neither run is winning consistently anymore.
+                do
+                {
+                    count1 = GallopRight(a[cursor2], tmp, cursor1, length1, 0, comparer);
+                    if (count1 != 0)
+                    {
+                        MoveElements(a + dest, tmp + cursor1, count1);
+                        dest += count1;
+                        cursor1 += count1;
+                        length1 -= count1;
+                        if (length1 <= 1)
+                        {
+                            return;
+                        }
+                    }
+                    a[dest++] = a[cursor2++];
+                    if (--length2 == 0)
+                    {
+                        return;
+                    }
+
+                    count2 = GallopLeft(tmp[cursor1], a, cursor2, length2, 0, comparer);
+                    if (count2 != 0)
+                    {
+                        MoveElements(a + dest, a + cursor2, count2);
+                        dest += count2;
+                        cursor2 += count2;
+                        length2 -= count2;
+                        if (length2 == 0)
+                        {
+                            return;
+                        }
+                    }
+                    a[dest++] = tmp[cursor1++];
+                    if (--length1 == 1)
+                    {
+                        return;
+                    }
+                    minGallop--;
+                } while (count1 >= InitialMinGallop || count2 >= InitialMinGallop);
+
+                minGallop = max(minGallop, 0) + 2;
+            }
+        }
+
+        // Merges adjacent runs back to front, with the shorter second run moved to the scratch buffer.
+        void MergeHi(int32 base1, int32 length1, int32 base2, int32 length2)
+        {
+            Assert(length1 > 0 && length2 > 0 && base1 + length1 == base2);
+            T* a = elements;
+            MoveElements(scratch, a + base2, length2);
+
+            int32 cursor1 = base1 + length1 - 1;
+            int32 cursor2 = length2 - 1;
+            int32 dest = base2 + length2 - 1;
+
+            // Invariant at every comparison: dest - length2 == cursor1 and cursor2 == length2 - 1, so the
+            // rest of the scratch run fits back into the gap if the comparer throws.
+            TryFinally([&]()
+            {
+                MergeHiCore(base1, cursor1, length1, cursor2, length2, dest);
+            },
+            [&](bool hasException)
+            {
+                if (hasException)
+                {
+                    MoveElements(a + cursor1 + 1, scratch, length2);
+                }
+            });
+            minGallop = max(minGallop, 1);
+
+            if (length2 == 1)
+            {
+                dest -= length1;
+                cursor1 -= length1;
+                MoveElements(a + dest + 1, a + cursor1 + 1, length1);
+                a[dest] = scratch[cursor2];
+            }
+            else if (length2 > 0)
+            {
+                // length1 ran out first
+                Assert(length1 == 0);
+                MoveElements(a + dest - (length2 - 1), scratch, length2);
+            }
+            // else the comparer is inconsistent; every element is in the array already.
+        }
+
+        void MergeHiCore(int32 base1, int32& cursor1, int32& length1, int32& cursor2, int32& length2, int32& dest)
+        {
+            T* a = elements;
+            T* tmp = scratch;
+
+            a[dest--] = a[cursor1--];
+            if (--length1 == 0 || length2 == 1)
+            {
+                return;
+            }
+
+            for (;;)
+            {
+                int32 count1 = 0;
+                int32 count2 = 0;
+
+                do
+                {
+                    if (comparer(tmp[cursor2], a[cursor1]) < 0)
+                    {
+                        a[dest--] = a[cursor1--];
+                        count1++;
+                        count2 = 0;
+                        if (--length1 == 0)
+                        {
+                            return;
+                        }
+                    }
+                    else
+                    {
+                        a[dest--] = tmp[cursor2--];
+                        count2++;
+                        count1 = 0;
+                        if (--length2 == 1)
+                        {
+                            return;
+                        }
+                    }
+                } while ((count1 | count2) < minGallop);
+
+                do
+                {
+                    count1 = length1 - GallopRight(tmp[cursor2], a, base1, length1, length1 - 1, comparer);
+                    if (count1 != 0)
+                    {
+                        dest -= count1;
+                        cursor1 -= count1;
+                        length1 -= count1;
+                        MoveElements(a + dest + 1, a + cursor1 + 1, count1);
+                        if (length1 == 0)
+                        {
+                            return;
+                        }
+                    }
+                    a[dest--] = tmp[cursor2--];
+                    if (--length2 == 1)
+                    {
+                        return;
+                    }
+
+                    count2 = length2 - GallopLeft(a[cursor1], tmp, 0, length2, length2 - 1, comparer);
+                    if (count2 != 0)
+                    {
+                        dest -= count2;
+                        cursor2 -= count2;
+                        length2 -= count2;
+                        MoveElements(a + dest + 1, tmp + cursor2 + 1, count2);
+                        if (length2 <= 1)
+                        {
+                            return;
+                        }
+                    }
+                    a[dest--] = a[cursor1--];
+                    if (--length1 == 0)
+                    {
+                        return;
+                    }
+                    minGallop--;
+                } while (count1 >= InitialMinGallop || count2 >= InitialMinGallop);
+
+                minGallop = max(minGallop, 0) + 2;
+            }
+        }
+    };
+}
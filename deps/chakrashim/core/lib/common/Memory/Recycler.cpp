@@ -253,6 +253,9 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #endif
     , objectBeforeCollectCallbackMap(nullptr)
     , objectBeforeCollectCallbackState(ObjectBeforeCollectCallback_None)
+    , externalWeakRootsClearedCallback(nullptr)
+    , externalWeakRootsClearedCallbackState(nullptr)
+    , externalWeakRootsClearedCount(0)
 {
 #ifdef RECYCLER_MARK_TRACK
     this->markMap = NoCheckHeapNew(MarkMap, &NoCheckHeapAllocator::Instance, 163, &markMapCriticalSection);
@@ -1705,6 +1708,16 @@ Recycler::FindRoots()
     {
         scanRootBytes += ScanArena(externalGuestArenaIter.Data(), false);
     }
+
+    DList<ExternalRootRange, HeapAllocator>::Iterator externalRootRangeIter(&externalRootRangeList);
+    while (externalRootRangeIter.Next())
+    {
+        ExternalRootRange const& range = externalRootRangeIter.Data();
+        void ** start = *range.start;
+        size_t byteCount = (char *)*range.end - (char *)start;
+        scanRootBytes += byteCount;
+        this->ScanMemory(start, byteCount);
+    }
     RECYCLER_PROFILE_EXEC_END(this, Js::FindRootArenaPhase);
 
     this->ScanImplicitRoots();
@@ -2542,6 +2555,13 @@ Recycler::EndMark()
         oomRescan |= EndMarkCheckOOMRescan();
     }
 
+    // Anything the callbacks revived is marked by now
+    ClearExternalWeakRoots();
+
+    // Let the host drop its references to the cleared objects before they are swept. With concurrent sweep,
+    // script runs again before FinishCollection, and must not see them.
+    ReportExternalWeakRootsCleared();
+
     // GC-CONSIDER: Consider keeping some page around
     GCETW(GC_DECOMMIT_CONCURRENT_COLLECT_PAGE_ALLOCATOR_START, (this));
 
@@ -8121,6 +8141,43 @@ void Recycler::ClearObjectBeforeCollectCallbacks()
     Assert(objectBeforeCollectCallbackMap == nullptr);
 }
 
+void Recycler::ClearExternalWeakRoots()
+{
+    Assert(this->IsMarkState());
+
+    DList<ExternalRootRange, HeapAllocator>::Iterator externalWeakRootRangeIter(&externalWeakRootRangeList);
+    while (externalWeakRootRangeIter.Next())
+    {
+        ExternalRootRange const& range = externalWeakRootRangeIter.Data();
+        void ** end = *range.end;
+        for (void ** slot = *range.start; slot < end; slot++)
+        {
+            void * object = *slot;
+            if (object != nullptr && !this->IsObjectMarked(object))
+            {
+                *slot = nullptr;
+                this->externalWeakRootsClearedCount++;
+            }
+        }
+    }
+}
+
+void Recycler::ReportExternalWeakRootsCleared()
+{
+    size_t clearedCount = this->externalWeakRootsClearedCount;
+    if (clearedCount == 0)
+    {
+        return;
+    }
+
+    // Reset first, the host may allocate from the callback
+    this->externalWeakRootsClearedCount = 0;
+    if (this->externalWeakRootsClearedCallback != nullptr)
+    {
+        this->externalWeakRootsClearedCallback(this->externalWeakRootsClearedCallbackState, clearedCount);
+    }
+}
+
 #ifdef RECYCLER_TEST_SUPPORT
 void Recycler::SetCheckFn(BOOL(*checkFn)(char* addr, size_t size))
 {
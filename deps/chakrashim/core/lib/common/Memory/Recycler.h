@@ -749,6 +749,24 @@ private:
     };
     DListBase<GuestArenaAllocator> guestArenaList;
     DListBase<ArenaData*> externalGuestArenaList;    // guest arenas are scanned for roots
+
+public:
+    // A host-owned range of slots, scanned for roots between *start and *end.
+    // The host moves the bounds in place, so registration happens only once.
+    struct ExternalRootRange
+    {
+        ExternalRootRange(void ** const * start, void ** const * end) : start(start), end(end) {}
+        void ** const * start;
+        void ** const * end;
+    };
+    typedef void (CALLBACK *ExternalWeakRootsClearedCallback)(void* callbackState, size_t clearedCount); // same as jsrt JsWeakRootsClearedCallback
+private:
+    DListBase<ExternalRootRange> externalRootRangeList;
+    // Ranges of the same shape that are not scanned; unmarked objects in them are cleared after mark
+    DListBase<ExternalRootRange> externalWeakRootRangeList;
+    ExternalWeakRootsClearedCallback externalWeakRootsClearedCallback;
+    void * externalWeakRootsClearedCallbackState;
+    size_t externalWeakRootsClearedCount;
 #ifdef RECYCLER_PAGE_HEAP
 
     inline bool IsPageHeapEnabled() const { return isPageHeapEnabled; }
@@ -1226,6 +1244,32 @@ public:
         externalGuestArenaList.RemoveElement(&NoThrowHeapAllocator::Instance, guestArena);
     }
 
+    ExternalRootRange * RegisterExternalRootRange(void ** const * start, void ** const * end)
+    {
+        return externalRootRangeList.PrependNode(&NoThrowHeapAllocator::Instance, start, end);
+    }
+
+    void UnregisterExternalRootRange(ExternalRootRange * range)
+    {
+        externalRootRangeList.RemoveElement(&NoThrowHeapAllocator::Instance, range);
+    }
+
+    ExternalRootRange * RegisterExternalWeakRootRange(void ** const * start, void ** const * end)
+    {
+        return externalWeakRootRangeList.PrependNode(&NoThrowHeapAllocator::Instance, start, end);
+    }
+
+    void UnregisterExternalWeakRootRange(ExternalRootRange * range)
+    {
+        externalWeakRootRangeList.RemoveElement(&NoThrowHeapAllocator::Instance, range);
+    }
+
+    void SetExternalWeakRootsClearedCallback(ExternalWeakRootsClearedCallback callback, void * callbackState)
+    {
+        this->externalWeakRootsClearedCallback = callback;
+        this->externalWeakRootsClearedCallbackState = callbackState;
+    }
+
 #ifdef RECYCLER_TEST_SUPPORT
     void SetCheckFn(BOOL(*checkFn)(char* addr, size_t size));
 #endif
@@ -2014,6 +2058,9 @@ private:
     } objectBeforeCollectCallbackState;
 
     bool ProcessObjectBeforeCollectCallbacks(bool atShutdown = false);
+
+    void ClearExternalWeakRoots();
+    void ReportExternalWeakRootsCleared();
 };
 
 
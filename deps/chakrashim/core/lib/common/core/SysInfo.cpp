@@ -74,6 +74,7 @@ AutoSystemInfo::Initialize()
 #if defined(_M_IX86) || defined(_M_X64)
     get_cpuid(CPUInfo, 1);
     isAtom = CheckForAtom();
+    InitAvxSupport();
 #endif
 #if defined(_M_ARM32_OR_ARM64)
     armDivAvailable = IsProcessorFeaturePresent(PF_ARM_DIVIDE_INSTRUCTION_AVAILABLE) ? true : false;
@@ -241,6 +242,20 @@ AutoSystemInfo::SSE4_1Available() const
     return VirtualSseAvailable(4) && (CPUInfo[2] & (0x1 << 19));
 }
 
+BOOL
+AutoSystemInfo::AVXAvailable() const
+{
+    Assert(initialized);
+    return VirtualSseAvailable(5) && avxAvailable;
+}
+
+BOOL
+AutoSystemInfo::AVX2Available() const
+{
+    Assert(initialized);
+    return AVXAvailable() && avx2Available;
+}
+
 BOOL
 AutoSystemInfo::PopCntAvailable() const
 {
@@ -264,6 +279,36 @@ AutoSystemInfo::IsAtomPlatform() const
     return isAtom;
 }
 
+void
+AutoSystemInfo::InitAvxSupport()
+{
+    avxAvailable = false;
+    avx2Available = false;
+
+    // AVX needs both the CPU feature bit and OS support for saving the YMM state (OSXSAVE, with the
+    // SSE and AVX bits set in XCR0), otherwise VEX encoded instructions fault.
+    const int OSXSAVE = 1 << 27, AVX = 1 << 28;
+    if ((CPUInfo[2] & (OSXSAVE | AVX)) != (OSXSAVE | AVX))
+    {
+        return;
+    }
+
+    const unsigned __int64 XCR0_SSE_AVX = 0x6;
+    if ((get_xcr0() & XCR0_SSE_AVX) != XCR0_SSE_AVX)
+    {
+        return;
+    }
+    avxAvailable = true;
+
+    int cpuidInfo[4];
+    get_cpuid(cpuidInfo, 0);
+    if (cpuidInfo[0] >= 7)
+    {
+        get_cpuidex(cpuidInfo, 7, 0);
+        avx2Available = (cpuidInfo[1] & (1 << 5)) != 0;
+    }
+}
+
 bool
 AutoSystemInfo::CheckForAtom() const
 {
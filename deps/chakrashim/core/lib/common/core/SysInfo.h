@@ -28,6 +28,8 @@ public:
 #if defined(_M_IX86) || defined(_M_X64)
     BOOL SSE3Available() const;
     BOOL SSE4_1Available() const;
+    BOOL AVXAvailable() const;
+    BOOL AVX2Available() const;
     BOOL PopCntAvailable() const;
     BOOL LZCntAvailable() const;
     bool IsAtomPlatform() const;
@@ -94,6 +96,9 @@ private:
 #if defined(_M_IX86) || defined(_M_X64)
     bool isAtom;
     bool CheckForAtom() const;
+    bool avxAvailable;
+    bool avx2Available;
+    void InitAvxSupport();
 #endif
 
     bool InitPhysicalProcessorCount();
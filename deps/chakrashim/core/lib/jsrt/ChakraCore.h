@@ -27,6 +27,151 @@
 
 typedef void* JsModuleRecord;
 
+typedef void* JsRootRangeHandle;
+
+typedef void* JsArrayBufferContentsHandle;
+
+/// <summary>
+///     Flags that select the property names returned by <c>JsGetFilteredPropertyNames</c>.
+/// </summary>
+typedef enum _JsPropertyNameFlags
+{
+    /// <summary>
+    ///     The enumerable names of the object and its prototype chain, in the order a for-in loop visits them.
+    /// </summary>
+    JsPropertyNameDefault = 0x0,
+    /// <summary>
+    ///     Only the object's own properties.
+    /// </summary>
+    JsPropertyNameOwnOnly = 0x1,
+    /// <summary>
+    ///     Also include non-enumerable properties. Requires <c>JsPropertyNameOwnOnly</c>.
+    /// </summary>
+    JsPropertyNameIncludeNonEnumerable = 0x2,
+    /// <summary>
+    ///     Leave out array index names.
+    /// </summary>
+    JsPropertyNameSkipIndices = 0x4,
+    /// <summary>
+    ///     Leave out names that are not array indices.
+    /// </summary>
+    JsPropertyNameSkipNonIndices = 0x8,
+} JsPropertyNameFlags;
+
+/// <summary>
+///     Describes how values are represented in memory, so that a host can check the type of a value
+///     without calling into the runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     A value <c>v</c> is a tagged integer when <c>(v &amp; intTagMask) == intTag</c>; its int32 value is
+///     <c>(int32_t)v &gt;&gt; intValueShift</c>. When <c>floatTagMask</c> is not zero, a value that is not a
+///     tagged integer is a tagged double when <c>(v &amp; floatTagMask) != 0</c>. Any other value points to
+///     an object whose 32-bit type ID is found by following the type pointer at <c>typeOffset</c> and reading
+///     at <c>typeIdOffset</c> in the type.
+///     </para>
+///     <para>
+///     The layout is fixed for a given build of the engine and does not depend on a runtime.
+///     </para>
+/// </remarks>
+typedef struct JsValueLayout
+{
+    uintptr_t intTagMask;
+    uintptr_t intTag;
+    unsigned int intValueShift;
+    uintptr_t floatTagMask;
+
+    unsigned int typeOffset;
+    unsigned int typeIdOffset;
+    unsigned int booleanValueOffset;        // 32-bit value of a boolean
+    unsigned int typedArrayBufferOffset;    // Pointer to the first element of a typed array
+    unsigned int typedArrayLengthOffset;    // 32-bit element count of a typed array
+
+    int undefinedTypeId;
+    int nullTypeId;
+    int booleanTypeId;
+    int integerTypeId;
+    int numberTypeId;                       // Type ID of a double, tagged or not
+    int firstNumberTypeId;
+    int lastNumberTypeId;
+    int stringTypeId;
+    int symbolTypeId;
+    int lastPrimitiveTypeId;                // Type IDs above this one are objects
+    int functionTypeId;
+    int errorTypeId;
+    int firstArrayTypeId;
+    int lastArrayTypeId;
+    int es5ArrayTypeId;
+    int arrayBufferTypeId;
+    int firstTypedArrayTypeId;              // Type ID of JsArrayTypeInt8, followed by the other JsTypedArrayType
+    int lastTypedArrayTypeId;               // Includes typed arrays internal to the engine
+    int dataViewTypeId;
+} JsValueLayout;
+
+/// <summary>
+///     A frame of a script stack sampled through <c>JsRequestStackSample</c>.
+/// </summary>
+/// <remarks>
+///     The strings are owned by the engine and are only valid during the sample callback.
+/// </remarks>
+typedef struct JsStackSampleFrame
+{
+    const void *functionKey;                // Identifies the function for as long as it is alive
+    const wchar_t *functionName;
+    const wchar_t *sourceName;              // Null for native library functions
+    unsigned int line;                      // Zero-based line of the function's declaration
+    unsigned int column;                    // Zero-based column of the function's declaration
+    bool isNativeCode;                      // The frame is running JIT'd code
+} JsStackSampleFrame;
+
+/// <summary>
+///     The execution tier a function currently runs in.
+/// </summary>
+typedef enum JsFunctionTier
+{
+    JsFunctionTierInterpreter = 0,
+    JsFunctionTierSimpleJit = 1,
+    JsFunctionTierFullJit = 2
+} JsFunctionTier;
+
+/// <summary>
+///     The number of times JIT'd code of a function bailed out for one bailout kind.
+/// </summary>
+typedef struct JsJitBailOutCount
+{
+    unsigned int kind;                      // Engine specific bailout kind
+    const char *kindName;                   // Name of the kind, and of any bits it carries
+    unsigned int count;
+} JsJitBailOutCount;
+
+/// <summary>
+///     JIT counters of a function, reported by <c>JsEnumerateJitTelemetry</c>.
+/// </summary>
+/// <remarks>
+///     The strings and the bailout counts are owned by the engine and are only valid during the
+///     telemetry callback.
+/// </remarks>
+typedef struct JsFunctionJitTelemetry
+{
+    const void *functionKey;                // Identifies the function for as long as it is alive
+    const wchar_t *functionName;
+    const wchar_t *sourceName;              // Null for functions without a source url
+    unsigned int line;                      // Zero-based line of the function's declaration
+    unsigned int column;                    // Zero-based column of the function's declaration
+    JsFunctionTier tier;
+    unsigned int simpleJitCount;            // Completed simple JIT compilations of the function
+    unsigned int fullJitCount;              // Completed full JIT compilations of the function
+    unsigned int loopBodyJitCount;          // Completed JIT compilations of its loop bodies
+    unsigned int rejitCount;                // Compilations and bailouts that asked for a rejit
+    unsigned int bailOutCount;
+    double codeGenTime;                     // Total time spent compiling, in milliseconds
+    unsigned int otherBailOutCount;         // Bailouts not broken down in bailOutKinds
+    unsigned int bailOutKindCount;
+    const JsJitBailOutCount *bailOutKinds;
+    unsigned int loopBodyEntryCount;        // Times interpreted code jumped into a JIT'd loop body (on-stack replacement)
+    unsigned int scalarReplacedObjectCount; // Object literal allocations that full JIT compilations removed from the function
+} JsFunctionJitTelemetry;
+
 typedef enum JsParseModuleSourceFlags
 {
     JsParseModuleSourceFlags_DataIsUTF16LE = 0x00000000,
@@ -163,4 +308,492 @@ JsGetModuleHostInfo(
     _In_ JsModuleHostInfoKind moduleHostInfo,
     _Outptr_result_maybenull_ void** hostInfo);
 
+/// <summary>
+///     Writes the contents of a string value into a buffer as UTF-8.
+/// </summary>
+/// <remarks>
+///     <para>
+///     A string built by concatenation is transcoded one piece at a time, without first being flattened into
+///     a single UTF-16 buffer. Surrogate pairs are written as four byte sequences. Unpaired surrogates are
+///     written as U+FFFD with <paramref name="replaceUnpairedSurrogates" />, and otherwise encoded as they
+///     are, in three bytes either way. Writing stops before the first character that does not fit in the
+///     buffer. No null terminator is written.
+///     </para>
+///     <para>
+///     When <paramref name="buffer" /> is null, nothing is written and <paramref name="written" /> receives
+///     the number of bytes needed to hold the whole string.
+///     </para>
+/// </remarks>
+/// <param name="stringValue">The string value to write.</param>
+/// <param name="buffer">The buffer to write to, or null to query the length.</param>
+/// <param name="bufferSize">The size of the buffer in bytes.</param>
+/// <param name="replaceUnpairedSurrogates">Whether to write unpaired surrogates as U+FFFD.</param>
+/// <param name="written">The number of bytes written (or needed). Can be null.</param>
+/// <param name="charsWritten">The number of UTF-16 code units of the string that were written. Can be null.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsCopyStringUtf8(
+    _In_ JsValueRef stringValue,
+    _Out_writes_bytes_opt_(bufferSize) char* buffer,
+    _In_ size_t bufferSize,
+    _In_ bool replaceUnpairedSurrogates,
+    _Out_opt_ size_t* written,
+    _Out_opt_ size_t* charsWritten);
+
+/// <summary>
+///     Registers a host-owned range of value slots as garbage collection roots.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The runtime keeps the addresses of the two bounds, not their values. Every collection scans the
+///     slots between <c>*start</c> and <c>*end</c> as they are at that moment, so the host can push and pop
+///     values by moving <c>*end</c> without calling back into the runtime. Slots are scanned conservatively.
+///     </para>
+///     <para>
+///     The bounds must stay valid until the range is removed with <c>JsRemoveRootRange</c>, and must be
+///     updated on the runtime's thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime whose recycler scans the range.</param>
+/// <param name="start">The address of the pointer to the first slot of the range.</param>
+/// <param name="end">The address of the pointer past the last slot of the range.</param>
+/// <param name="rootRange">The handle used to remove the range.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsAddRootRange(
+    _In_ JsRuntimeHandle runtime,
+    _In_ JsValueRef* const* start,
+    _In_ JsValueRef* const* end,
+    _Out_ JsRootRangeHandle* rootRange);
+
+/// <summary>
+///     Removes a range registered with <c>JsAddRootRange</c>.
+/// </summary>
+/// <param name="runtime">The runtime the range was registered with.</param>
+/// <param name="rootRange">The handle returned by <c>JsAddRootRange</c>.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsRemoveRootRange(
+    _In_ JsRuntimeHandle runtime,
+    _In_ JsRootRangeHandle rootRange);
+
+/// <summary>
+///     A callback called after a collection cleared slots of the weak root ranges.
+/// </summary>
+/// <remarks>
+///     Use <c>JsSetWeakRootsClearedCallback</c> to register this callback. It runs once per collection,
+///     after marking and before the cleared objects are swept, and only if at least one slot was cleared.
+///     Script is stopped while it runs, so the host can drop every other reference it keeps to the cleared
+///     objects before script could observe them. Like object before collect callbacks, it must not run
+///     script or create objects.
+/// </remarks>
+/// <param name="callbackState">The state passed to <c>JsSetWeakRootsClearedCallback</c>.</param>
+/// <param name="clearedCount">The number of slots cleared by the collection.</param>
+typedef void (CHAKRA_CALLBACK *JsWeakRootsClearedCallback)(_In_opt_ void *callbackState, _In_ size_t clearedCount);
+
+/// <summary>
+///     Registers a host-owned range of weak value slots.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The slots do not keep their values alive. Once a collection has finished marking, every slot
+///     between <c>*start</c> and <c>*end</c> holding an object that was not marked is set to
+///     <c>JS_INVALID_REFERENCE</c>, all in one pass over the range, and the number of cleared slots is
+///     reported through the callback set with <c>JsSetWeakRootsClearedCallback</c>. This replaces one
+///     <c>JsSetObjectBeforeCollectCallback</c> registration per object for hosts that only need to know
+///     that the object went away.
+///     </para>
+///     <para>
+///     Only objects may be stored in the slots. As with <c>JsAddRootRange</c>, the bounds are read at
+///     every collection, must stay valid until the range is removed with <c>JsRemoveWeakRootRange</c>,
+///     and must be updated on the runtime's thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime whose recycler clears the range.</param>
+/// <param name="start">The address of the pointer to the first slot of the range.</param>
+/// <param name="end">The address of the pointer past the last slot of the range.</param>
+/// <param name="weakRootRange">The handle used to remove the range.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsAddWeakRootRange(
+    _In_ JsRuntimeHandle runtime,
+    _In_ JsValueRef* const* start,
+    _In_ JsValueRef* const* end,
+    _Out_ JsRootRangeHandle* weakRootRange);
+
+/// <summary>
+///     Removes a range registered with <c>JsAddWeakRootRange</c>.
+/// </summary>
+/// <param name="runtime">The runtime the range was registered with.</param>
+/// <param name="weakRootRange">The handle returned by <c>JsAddWeakRootRange</c>.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsRemoveWeakRootRange(
+    _In_ JsRuntimeHandle runtime,
+    _In_ JsRootRangeHandle weakRootRange);
+
+/// <summary>
+///     Sets the callback that reports slots of weak root ranges cleared by a collection.
+/// </summary>
+/// <remarks>
+///     The callback runs on the runtime's thread while the collection is in progress, before sweeping.
+///     Weak root ranges must not be removed from within it.
+/// </remarks>
+/// <param name="runtime">The runtime for which to register the callback.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <param name="weakRootsClearedCallback">The callback function being set, or null to clear it.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsSetWeakRootsClearedCallback(
+    _In_ JsRuntimeHandle runtime,
+    _In_opt_ void *callbackState,
+    _In_opt_ JsWeakRootsClearedCallback weakRootsClearedCallback);
+
+/// <summary>
+///     Gets the string property names of an object, selected by <paramref name="flags" />.
+/// </summary>
+/// <remarks>
+///     The names are written straight into the result array while the object's properties are enumerated,
+///     without building intermediate arrays. Symbols are never included.
+/// </remarks>
+/// <param name="object">The object to get the property names of.</param>
+/// <param name="flags">Which names to return.</param>
+/// <param name="propertyNames">An array of property names.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsGetFilteredPropertyNames(
+    _In_ JsValueRef object,
+    _In_ JsPropertyNameFlags flags,
+    _Out_ JsValueRef* propertyNames);
+
+/// <summary>
+///     Gets the property ID of a string or symbol value.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Strings created with <c>JsCreatePropertyString</c>, and those the engine created for property names
+///     itself, carry their property ID, which is returned without hashing the string again. Other strings
+///     are looked up by their contents, as <c>JsGetPropertyIdFromName</c> does.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="key">The string or symbol.</param>
+/// <param name="propertyId">The property ID.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if the key is
+///     neither a string nor a symbol, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsGetPropertyIdFromKey(
+    _In_ JsValueRef key,
+    _Out_ JsPropertyIdRef* propertyId);
+
+/// <summary>
+///     Creates a string that carries the property ID of its contents.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The property ID is looked up once, when the string is created, so hosts can create strings they
+///     will use as property names many times and get their property ID back for free with
+///     <c>JsGetPropertyIdFromKey</c>.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="name">The characters of the string.</param>
+/// <param name="length">The number of characters.</param>
+/// <param name="result">The new string.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsCreatePropertyString(
+    _In_reads_(length) const wchar_t* name,
+    _In_ size_t length,
+    _Out_ JsValueRef* result);
+
+/// <summary>
+///     Detaches an array buffer and takes ownership of its backing store.
+/// </summary>
+/// <remarks>
+///     <para>
+///     After the call the array buffer and every typed array over it have a length of zero. The memory
+///     is not copied or freed; it is owned by the returned handle until it is given to
+///     <c>JsCreateArrayBufferFromContents</c> or released with <c>JsReleaseArrayBufferContents</c>.
+///     The handle is not tied to the runtime, so it may be passed to another thread and adopted by a
+///     different runtime.
+///     </para>
+///     <para>
+///     Array buffers created with <c>JsCreateExternalArrayBuffer</c> do not own their memory and cannot
+///     be detached; <c>JsErrorInvalidArgument</c> is returned for them and for buffers that are already
+///     detached.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="arrayBuffer">The array buffer to detach.</param>
+/// <param name="contents">The handle owning the detached memory.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsDetachArrayBuffer(
+    _In_ JsValueRef arrayBuffer,
+    _Out_ JsArrayBufferContentsHandle* contents);
+
+/// <summary>
+///     Gets whether an array buffer is detached, and whether <c>JsDetachArrayBuffer</c> can detach it.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Lets a host check every buffer of a transfer list before detaching any of them.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="arrayBuffer">The array buffer.</param>
+/// <param name="isDetached">Whether the array buffer is already detached.</param>
+/// <param name="isDetachable">Whether the array buffer owns its memory and isn't detached yet.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsGetArrayBufferDetachState(
+    _In_ JsValueRef arrayBuffer,
+    _Out_ bool* isDetached,
+    _Out_ bool* isDetachable);
+
+/// <summary>
+///     Creates an array buffer that takes over memory detached with <c>JsDetachArrayBuffer</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///     On success the handle is consumed and must not be used again. On failure the handle still owns
+///     the memory.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="contents">The handle returned by <c>JsDetachArrayBuffer</c>.</param>
+/// <param name="result">The new array buffer.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsCreateArrayBufferFromContents(
+    _In_ JsArrayBufferContentsHandle contents,
+    _Out_ JsValueRef* result);
+
+/// <summary>
+///     Frees memory detached with <c>JsDetachArrayBuffer</c> that was never given to an array buffer.
+/// </summary>
+/// <remarks>
+///     Does not require a runtime or an active script context.
+/// </remarks>
+/// <param name="contents">The handle returned by <c>JsDetachArrayBuffer</c>.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsReleaseArrayBufferContents(
+    _In_ JsArrayBufferContentsHandle contents);
+
+/// <summary>
+///     A callback called on the script thread with the frames of a sampled stack.
+/// </summary>
+/// <remarks>
+///     Use <c>JsSetStackSampleCallback</c> to register this callback. It runs in the middle of script
+///     execution and must not call back into the engine.
+/// </remarks>
+/// <param name="frames">The frames, innermost first.</param>
+/// <param name="frameCount">The number of frames.</param>
+/// <param name="callbackState">The state passed to <c>JsSetStackSampleCallback</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsStackSampleCallback)(_In_reads_(frameCount) const JsStackSampleFrame *frames, _In_ unsigned short frameCount, _In_opt_ void *callbackState);
+
+/// <summary>
+///     Sets the callback that receives stacks sampled with <c>JsRequestStackSample</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Stop calling <c>JsRequestStackSample</c> before the callback is removed by passing null.
+///     </para>
+///     <para>
+///     Requires the runtime not to be running script on another thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to sample.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <param name="stackSampleCallback">The callback function, or null to stop sampling.</param>
+/// <param name="maxFrameCount">The maximum number of frames reported per sample.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsSetStackSampleCallback(
+    _In_ JsRuntimeHandle runtime,
+    _In_opt_ void *callbackState,
+    _In_opt_ JsStackSampleCallback stackSampleCallback,
+    _In_ unsigned short maxFrameCount);
+
+/// <summary>
+///     Asks the runtime to sample its script stack.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Like <c>JsDisableRuntimeExecution</c>, this can be called from any thread. The sample is taken on
+///     the script thread at its next function entry, or loop back edge in JIT'd code when the runtime
+///     was created with <c>JsRuntimeAttributeAllowScriptInterrupt</c>, and reported to the callback set
+///     with <c>JsSetStackSampleCallback</c>. Requests made while the runtime is idle are serviced when
+///     it next runs script; requests made while one is pending are merged into it.
+///     </para>
+///     <para>
+///     Does nothing when no callback is set.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to sample.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsRequestStackSample(
+    _In_ JsRuntimeHandle runtime);
+
+/// <summary>
+///     Makes JIT'd code visible to the Linux <c>perf</c> profiler.
+/// </summary>
+/// <remarks>
+///     <para>
+///     With <c>writePerfMap</c>, symbols are appended to <c>/tmp/perf-&lt;pid&gt;.map</c>. With
+///     <c>writeJitDump</c>, code bytes and source lines are written to <c>/tmp/jit-&lt;pid&gt;.dump</c>,
+///     to be merged into a recording made with <c>perf record -k mono</c> by <c>perf inject --jit</c>.
+///     </para>
+///     <para>
+///     Only code emitted after the call is described, so hosts should call this before creating
+///     their first runtime. The same can be requested with the <c>-PerfMap</c> and <c>-PerfJitDump</c>
+///     configuration flags. Files that can't be created are skipped. Once enabled, output can't be
+///     turned off.
+///     </para>
+/// </remarks>
+/// <param name="writePerfMap">Whether to write the perf map file.</param>
+/// <param name="writeJitDump">Whether to write the jitdump file.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorNotImplemented</c> on
+///     platforms without perf or in builds without the JIT, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsEnablePerfJitProfiling(
+    _In_ bool writePerfMap,
+    _In_ bool writeJitDump);
+
+/// <summary>
+///     Sets how many times a loop runs in the interpreter before its body is JIT'd.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Once the JIT'd loop body is ready, the interpreter jumps into it at the next iteration. This
+///     works for loops in any function, including global code that only runs once. Lower values get
+///     long running startup loops out of the interpreter sooner, at the cost of compiling more loops
+///     that would have finished soon anyway.
+///     </para>
+///     <para>
+///     Only functions compiled after the call use the new threshold, so hosts should call this before
+///     creating their first runtime. Nested loops, and loops of functions called from loops, use a
+///     lower threshold derived from this one. The <c>-LoopInterpretCount</c> configuration flag sets the
+///     same threshold.
+///     </para>
+/// </remarks>
+/// <param name="iterationCount">The number of iterations to interpret.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorNotImplemented</c> in
+///     builds without a JIT, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsSetLoopBodyJitThreshold(
+    _In_ unsigned int iterationCount);
+
+/// <summary>
+///     A callback called once for each function that has been queued for JIT.
+/// </summary>
+/// <param name="telemetry">The counters of the function.</param>
+/// <param name="callbackState">The state passed to <c>JsEnumerateJitTelemetry</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsJitTelemetryCallback)(_In_ const JsFunctionJitTelemetry *telemetry, _In_opt_ void *callbackState);
+
+/// <summary>
+///     Reports the JIT counters of the functions of the current context.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Counters are kept in all builds, from the first time a function is queued for JIT. Functions
+///     that never were are not reported. Compilations still running on a background thread are
+///     counted once they finish.
+///     </para>
+///     <para>
+///     Requires an active script context. The callback must not call back into the engine.
+///     </para>
+/// </remarks>
+/// <param name="callback">The callback to call for each function.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorNotImplemented</c> in
+///     builds without a JIT, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsEnumerateJitTelemetry(
+    _In_ JsJitTelemetryCallback callback,
+    _In_opt_ void *callbackState);
+
+/// <summary>
+///     Gets the number of function bodies the runtime has parsed on background threads.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Only runtimes created with <c>JsRuntimeAttributeEnableParallelParse</c> parse in the background,
+///     and only for scripts of at least the <c>-ParallelParseThreshold</c> length. Functions that the
+///     script thread parsed itself while it waited for a background job are not counted.
+///     </para>
+///     <para>
+///     Does not require an active script context.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="functionCount">The number of function bodies parsed in the background.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsGetRuntimeBackgroundParseCount(
+    _In_ JsRuntimeHandle runtime,
+    _Out_ unsigned int *functionCount);
+
+/// <summary>
+///     Gets the in-memory representation of values used by this build of the engine.
+/// </summary>
+/// <param name="layout">Receives the value layout.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsGetValueLayout(
+    _Out_ JsValueLayout* layout);
+
 #endif // _CHAKRACORE_H_
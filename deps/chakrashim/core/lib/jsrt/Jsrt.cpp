@@ -117,7 +117,8 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes, _In_opt_ char
             JsRuntimeAttributeDisableEval |
             JsRuntimeAttributeDisableNativeCodeGeneration |
             JsRuntimeAttributeEnableExperimentalFeatures |
-            JsRuntimeAttributeDispatchSetExceptionsToDebugger
+            JsRuntimeAttributeDispatchSetExceptionsToDebugger |
+            JsRuntimeAttributeEnableParallelParse
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
             | JsRuntimeAttributeSerializeLibraryByteCode
 #endif
@@ -169,6 +170,11 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes, _In_opt_ char
             threadContext->SetThreadContextFlag(ThreadContextFlagNoJIT);
         }
 
+        if ((attributes & JsRuntimeAttributeEnableParallelParse) && !(attributes & JsRuntimeAttributeDisableBackgroundWork))
+        {
+            threadContext->SetThreadContextFlag(ThreadContextFlagParallelParse);
+        }
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         if (Js::Configuration::Global.flags.PrimeRecycler)
         {
@@ -8,6 +8,9 @@
 
 #ifdef CHAKRA_STATIC_LIBRARY
 #include "Core/ConfigParser.h"
+#ifdef PERF_JIT_PROFILING
+#include "Base/PerfJitProfile.h"
+#endif
 
 void ChakraBinaryAutoSystemInfoInit(AutoSystemInfo * autoSystemInfo)
 {
@@ -143,6 +146,13 @@ void JsrtCallbackState::ObjectBeforeCallectCallbackWrapper(JsObjectBeforeCollect
 
     #ifdef ENABLE_JS_ETW
         EtwTrace::Register();
+    #endif
+    #ifdef PERF_JIT_PROFILING
+        PerfJitProfile::Register();
+        // There is no DllMain process detach for the static library, so write the jitdump
+        // close record and close the files at exit. This also covers files opened later
+        // through JsEnablePerfJitProfiling.
+        atexit(PerfJitProfile::UnRegister);
     #endif
         ValueType::Initialize();
         ThreadContext::GlobalInitialize();
@@ -406,7 +406,12 @@ typedef unsigned char* ChakraBytePtr;
         ///     Calling <c>JsSetException</c> will also dispatch the exception to the script debugger
         ///     (if any) giving the debugger a chance to break on the exception.
         /// </summary>
-        JsRuntimeAttributeDispatchSetExceptionsToDebugger = 0x00000040
+        JsRuntimeAttributeDispatchSetExceptionsToDebugger = 0x00000040,
+        /// <summary>
+        ///     Function bodies in large scripts will be parsed on background threads, in parallel with
+        ///     the parse of the rest of the script. Ignored if background work is disabled.
+        /// </summary>
+        JsRuntimeAttributeEnableParallelParse = 0x00000080
     } JsRuntimeAttributes;
 
     /// <summary>
@@ -15,6 +15,10 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
     this->collectCallback = NULL;
     this->beforeCollectCallback = NULL;
     this->callbackContext = NULL;
+    this->stackSampleCallback = NULL;
+    this->stackSampleCallbackState = NULL;
+    this->stackSampleFrames = NULL;
+    this->stackSampleMaxFrameCount = 0;
     this->allocationPolicyManager = threadContext->GetAllocationPolicyManager();
     this->useIdle = useIdle;
     this->dispatchExceptions = dispatchExceptions;
@@ -33,6 +37,10 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
 JsrtRuntime::~JsrtRuntime()
 {
     HeapDelete(allocationPolicyManager);
+    if (this->stackSampleFrames != nullptr)
+    {
+        HeapDeleteArray(this->stackSampleMaxFrameCount, this->stackSampleFrames);
+    }
     if (this->jsrtDebugManager != nullptr)
     {
         HeapDelete(this->jsrtDebugManager);
@@ -114,6 +122,74 @@ void JsrtRuntime::RecyclerCollectCallbackStatic(void * context, RecyclerCollectC
     }
 }
 
+void JsrtRuntime::SetStackSampleCallback(JsStackSampleCallback stackSampleCallback, void * callbackState, unsigned short maxFrameCount)
+{
+    // Stop sampling before touching the frame buffer the sampling callback fills in
+    this->threadContext->SetStackSampleCallBack(nullptr, nullptr);
+
+    if (this->stackSampleFrames != nullptr && (stackSampleCallback == NULL || maxFrameCount != this->stackSampleMaxFrameCount))
+    {
+        HeapDeleteArray(this->stackSampleMaxFrameCount, this->stackSampleFrames);
+        this->stackSampleFrames = nullptr;
+        this->stackSampleMaxFrameCount = 0;
+    }
+
+    this->stackSampleCallback = stackSampleCallback;
+    this->stackSampleCallbackState = callbackState;
+
+    if (stackSampleCallback != NULL)
+    {
+        if (this->stackSampleFrames == nullptr)
+        {
+            this->stackSampleFrames = HeapNewArrayZ(JsStackSampleFrame, maxFrameCount);
+            this->stackSampleMaxFrameCount = maxFrameCount;
+        }
+        this->threadContext->SetStackSampleCallBack(StackSampleCallbackStatic, this);
+    }
+}
+
+void JsrtRuntime::StackSampleCallbackStatic(void * context, Js::ScriptContext * scriptContext, PVOID returnAddress)
+{
+    JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(context);
+    unsigned short frameCount = 0;
+
+    // Walking the stack doesn't allocate, so this is safe at any probe
+    Js::JavascriptStackWalker walker(scriptContext, true, returnAddress);
+    Js::JavascriptFunction * function;
+    while (frameCount < _this->stackSampleMaxFrameCount && walker.GetCaller(&function))
+    {
+        JsStackSampleFrame * frame = &_this->stackSampleFrames[frameCount++];
+        Js::FunctionBody * functionBody = function->GetFunctionBody();
+        if (functionBody != nullptr)
+        {
+            frame->functionKey = functionBody;
+            frame->functionName = functionBody->GetExternalDisplayName();
+            frame->sourceName = functionBody->GetSourceName();
+            frame->line = functionBody->GetLineNumber();
+            frame->column = functionBody->GetColumnNumber();
+        }
+        else
+        {
+            frame->functionKey = function->GetFunctionInfo();
+            frame->functionName = walker.GetCurrentNativeLibraryEntryName();
+            frame->sourceName = nullptr;
+            frame->line = 0;
+            frame->column = 0;
+        }
+        frame->isNativeCode = !!Js::JavascriptFunction::IsNativeAddress(scriptContext, walker.GetCurrentCodeAddr());
+    }
+
+    try
+    {
+        JsrtCallbackState scope(_this->threadContext);
+        _this->stackSampleCallback(_this->stackSampleFrames, frameCount, _this->stackSampleCallbackState);
+    }
+    catch (...)
+    {
+        AssertMsg(false, "Unexpected non-engine exception.");
+    }
+}
+
 unsigned int JsrtRuntime::Idle()
 {
     return this->threadService.Idle();
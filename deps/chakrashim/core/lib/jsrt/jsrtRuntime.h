@@ -36,6 +36,7 @@ public:
 
     void CloseContexts();
     void SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollectCallback, void * callbackContext);
+    void SetStackSampleCallback(JsStackSampleCallback stackSampleCallback, void * callbackState, unsigned short maxFrameCount);
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     void SetSerializeByteCodeForLibrary(bool set) { serializeByteCodeForLibrary = set; }
@@ -48,6 +49,7 @@ public:
 
 private:
     static void __cdecl RecyclerCollectCallbackStatic(void * context, RecyclerCollectCallBackFlags flags);
+    static void __cdecl StackSampleCallbackStatic(void * context, Js::ScriptContext * scriptContext, PVOID returnAddress);
 
 private:
     ThreadContext * threadContext;
@@ -57,6 +59,10 @@ private:
     JsBeforeCollectCallback beforeCollectCallback;
     JsrtThreadService threadService;
     void * callbackContext;
+    JsStackSampleCallback stackSampleCallback;
+    void * stackSampleCallbackState;
+    JsStackSampleFrame * stackSampleFrames;
+    unsigned short stackSampleMaxFrameCount;
     bool useIdle;
     bool dispatchExceptions;
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
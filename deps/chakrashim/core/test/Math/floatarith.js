@@ -0,0 +1,108 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Float arithmetic where the destination differs from both sources and the sources stay live afterwards.
+// The jitted code must not clobber a source; on x64 with AVX this exercises the non-destructive VEX forms.
+// need to run with -mic:1 -off:simplejit
+
+var FAILED = false;
+
+function check(expected, actual, msg)
+{
+    if (!Object.is(expected, actual))
+    {
+        FAILED = true;
+        WScript.Echo("FAILED: " + msg + " expected " + expected + " got " + actual);
+    }
+}
+
+function f64(a, b)
+{
+    var sum = a + b;
+    var diff = a - b;
+    var rdiff = b - a;
+    var prod = a * b;
+    var quot = a / b;
+    var rquot = b / a;
+    return [sum, diff, rdiff, prod, quot, rquot, a, b];
+}
+
+function f32(arr)
+{
+    var a = arr[0];
+    var b = arr[1];
+    arr[2] = a + b;
+    arr[3] = a - b;
+    arr[4] = b - a;
+    arr[5] = a * b;
+    arr[6] = a / b;
+    arr[7] = b / a;
+    arr[8] = a;
+    arr[9] = b;
+}
+
+function horner(x)
+{
+    // Long dependency chains with x live throughout
+    var y = 1.5;
+    for (var i = 0; i < 8; i++)
+    {
+        y = y * x + (x - 0.25) / (x + 2.5);
+    }
+    return y + x;
+}
+
+var inputs = [[1.5, 2.25], [-3.75, 0.5], [0, -0], [1e300, 1e-300], [NaN, 1], [Infinity, -Infinity], [7, 3]];
+var expected64 = [];
+var expected32 = [];
+var expectedHorner = [];
+
+for (var i = 0; i < inputs.length; i++)
+{
+    var a = inputs[i][0];
+    var b = inputs[i][1];
+    expected64.push([a + b, a - b, b - a, a * b, a / b, b / a, a, b]);
+
+    var fa = Math.fround(a);
+    var fb = Math.fround(b);
+    expected32.push([fa, fb, Math.fround(fa + fb), Math.fround(fa - fb), Math.fround(fb - fa),
+        Math.fround(fa * fb), Math.fround(fa / fb), Math.fround(fb / fa), fa, fb]);
+
+    var y = 1.5;
+    for (var j = 0; j < 8; j++)
+    {
+        y = y * a + (a - 0.25) / (a + 2.5);
+    }
+    expectedHorner.push(y + a);
+}
+
+// Run enough times to get the functions jitted
+for (var iter = 0; iter < 3; iter++)
+{
+    for (var i = 0; i < inputs.length; i++)
+    {
+        var result = f64(inputs[i][0], inputs[i][1]);
+        for (var k = 0; k < result.length; k++)
+        {
+            check(expected64[i][k], result[k], "f64 input " + i + " index " + k);
+        }
+
+        var arr = new Float32Array(10);
+        arr[0] = inputs[i][0];
+        arr[1] = inputs[i][1];
+        f32(arr);
+        for (var k = 0; k < arr.length; k++)
+        {
+            check(expected32[i][k], arr[k], "f32 input " + i + " index " + k);
+        }
+
+        check(expectedHorner[i], horner(inputs[i][0]), "horner input " + i);
+    }
+}
+
+if (!FAILED)
+{
+    WScript.Echo("PASSED");
+}
@@ -0,0 +1,74 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+function makePoint(x, y) {
+  return { x: x, y: y };
+}
+
+// Object literal returned from an inlined helper, only read through its own fields
+function lengthSquared(x, y) {
+  var p = makePoint(x, y);
+  var px = p.x;
+  var py = p.y;
+  return px * px + py * py;
+}
+
+// Field loads and stores on a literal that is dead after the loop iteration
+function sumPoints(n) {
+  var sum = 0;
+  for (var i = 0; i < n; i++) {
+    var p = { x: i, y: i + 1 };
+    p.x += p.y;
+    sum += p.x;
+  }
+  return sum;
+}
+
+// Literal that escapes on some paths must keep its allocation
+var escaped;
+function maybeEscape(x, escape) {
+  var p = { x: x, y: 0 };
+  p.y = p.x + 1;
+  if (escape) {
+    escaped = p;
+  }
+  return p.y;
+}
+
+// Literal live across a bailout: the bailout has to see a fully initialized object
+function acrossBailout(x) {
+  var p = { a: x, b: x };
+  p.a = x + 1;
+  var r = p.a + p.b;
+  return r + p.a;
+}
+
+// Loads of properties not in the literal go to the prototype and may call out
+Object.defineProperty(Object.prototype, "z", {
+  get: function () { escaped = this; return 1; },
+  configurable: true
+});
+function protoLoad(x) {
+  var p = { x: x };
+  p.x = p.z + x;
+  return p.x;
+}
+
+for (var i = 0; i < 200; i++) {
+  lengthSquared(i, i);
+  sumPoints(10);
+  maybeEscape(i, false);
+  acrossBailout(i);
+  protoLoad(i);
+}
+
+print(lengthSquared(3, 4));
+print(sumPoints(10));
+print(maybeEscape(5, true));
+print(escaped.x + "," + escaped.y);
+print(acrossBailout(1.5));
+print(acrossBailout("s"));
+print(protoLoad(2));
+print(escaped.x);
@@ -0,0 +1,33 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+function makePoint(x, y) {
+  return { x: x, y: y };
+}
+
+// The inlinee returns the literal through a copy to the call's dst
+function lengthSquared(x, y) {
+  var p = makePoint(x, y);
+  var px = p.x;
+  var py = p.y;
+  return px * px + py * py;
+}
+
+function sumPoints(n) {
+  var sum = 0;
+  for (var i = 0; i < n; i++) {
+    var p = { x: i, y: n };
+    sum += p.x + p.y;
+  }
+  return sum;
+}
+
+for (var i = 0; i < 100; i++) {
+  lengthSquared(i, i);
+  sumPoints(10);
+}
+
+print(lengthSquared(3, 4));
+print(sumPoints(10));
@@ -0,0 +1,132 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Loops of generator and async functions that can't suspend are jitted as loop bodies. Run with
+// -forcejitloopbody so each loop below is entered through its jitted body, and check that it sees the
+// same function object and the same values as the interpreter.
+
+function echo(str) {
+    WScript.Echo(str);
+}
+
+// A named function expression refers to itself from inside a jitted loop, directly and through closures
+var gen = function* selfGen(n) {
+    var sameSelf = true;
+    var closures = [];
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        sameSelf = sameSelf && selfGen === gen;
+        closures.push(function () { return selfGen; });
+        sum += i;
+    }
+    yield sum;
+    for (var j = 0; j < closures.length; j++) {
+        sameSelf = sameSelf && closures[j]() === gen;
+    }
+    yield sameSelf;
+};
+var it = gen(100);
+echo("generator loop without yield: " + it.next().value);
+echo("generator loop self reference: " + it.next().value);
+
+// A block scoped closure in the loop needs a scope per iteration
+function* scopedGen(n) {
+    var fns = [];
+    for (let i = 0; i < n; i++) {
+        fns.push(() => i);
+    }
+    yield fns.reduce((a, f) => a + f(), 0);
+}
+echo("generator loop with let closures: " + scopedGen(10).next().value);
+
+// Loops that yield still run in the interpreter, and nested loops without yield are jitted
+function* yieldingGen(n) {
+    for (var i = 0; i < n; i++) {
+        var inner = 0;
+        for (var k = 0; k <= i; k++) {
+            inner += k;
+        }
+        yield inner;
+    }
+}
+var values = [];
+for (var v of yieldingGen(6)) {
+    values.push(v);
+}
+echo("generator loop with yield: " + values.join(","));
+
+// try/catch inside the loop, with and without yield
+function* tryGen(n) {
+    var caught = 0;
+    for (var i = 0; i < n; i++) {
+        try {
+            if (i % 3 === 0) {
+                throw new Error("e" + i);
+            }
+        } catch (e) {
+            caught++;
+        }
+    }
+    yield caught;
+    for (var j = 0; j < 3; j++) {
+        try {
+            yield j;
+            throw j;
+        } catch (e) {
+            caught += e;
+        }
+    }
+    yield caught;
+}
+values = [];
+for (var v of tryGen(10)) {
+    values.push(v);
+}
+echo("generator loop with try/catch: " + values.join(","));
+
+// Async functions, whose loops run in a generator
+var asyncSelf = async function asyncFn(n) {
+    var sameSelf = true;
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        sameSelf = sameSelf && asyncFn === asyncSelf;
+        sum += i;
+    }
+    return sum + ":" + sameSelf;
+};
+
+async function asyncAwaitInLoop(n) {
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        sum += await Promise.resolve(i);
+    }
+    return sum;
+}
+
+async function asyncTryInLoop(n) {
+    var caught = 0;
+    for (var i = 0; i < n; i++) {
+        try {
+            if (i % 2 === 0) {
+                throw i;
+            }
+        } catch (e) {
+            caught += e;
+        }
+    }
+    for (var j = 0; j < 3; j++) {
+        try {
+            await Promise.reject(j);
+        } catch (e) {
+            caught += e;
+        }
+    }
+    return caught;
+}
+
+asyncSelf(100).then(result => echo("async loop without await: " + result))
+    .then(() => asyncAwaitInLoop(10)).then(result => echo("async loop with await: " + result))
+    .then(() => asyncTryInLoop(10)).then(result => echo("async loop with try/catch: " + result))
+    .catch(e => echo("FAILED: " + e));
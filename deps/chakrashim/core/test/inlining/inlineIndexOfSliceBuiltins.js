@@ -0,0 +1,146 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Array.prototype.indexOf, String.prototype.indexOf and String.prototype.slice are inlined as direct
+// calls, with a fast path for array and string receivers and tagged int indices that falls back to the
+// entry point for everything else.
+
+function assert(actual, expected, message)
+{
+    if (!Object.is(actual, expected))
+    {
+        throw new Error(message + " Actual: " + actual + " Expected: " + expected);
+    }
+}
+
+function arrayIndexOf(a, v)
+{
+    return a.indexOf(v);
+}
+
+function arrayIndexOfFrom(a, v, from)
+{
+    return a.indexOf(v, from);
+}
+
+function stringIndexOf(s, search)
+{
+    return s.indexOf(search);
+}
+
+function stringIndexOfFrom(s, search, position)
+{
+    return s.indexOf(search, position);
+}
+
+function stringSlice(s, start)
+{
+    return s.slice(start);
+}
+
+function stringSliceRange(s, start, end)
+{
+    return s.slice(start, end);
+}
+
+var holey = [0, 1, , 3];
+Array.prototype[2] = "proto";
+
+for (var iter = 0; iter < 10; iter++)
+{
+    assert(arrayIndexOf([1, 2, 3, 4], 3), 2, "native int array");
+    assert(arrayIndexOf([1.5, 2.5, 3.5], 2.5), 1, "native float array");
+    assert(arrayIndexOf(["a", "b", {}], "b"), 1, "var array");
+    assert(arrayIndexOf([1, 2, 3], 7), -1, "missing value");
+    assert(arrayIndexOf([], 1), -1, "empty array");
+    assert(arrayIndexOf([NaN], NaN), -1, "NaN is never found");
+    assert(arrayIndexOf([-0, 1], 0), 0, "-0 equals 0");
+    assert(arrayIndexOf(holey, "proto"), 2, "hole reads the prototype");
+    assert(arrayIndexOfFrom([1, 2, 1], 1, 1), 2, "fromIndex");
+
+    assert(stringIndexOf("haystack needle", "needle"), 9, "string search");
+    assert(stringIndexOf("haystack", "s"), 3, "single char search");
+    assert(stringIndexOf("haystack", ""), 0, "empty search");
+    assert(stringIndexOf("haystack", "x"), -1, "missing search");
+    assert(stringIndexOf("a1b", 1), 1, "search is converted to a string");
+    assert(stringIndexOf(new String("abc"), "c"), 2, "String object receiver");
+    assert(stringIndexOfFrom("abcabc", "b", 2), 4, "position");
+    assert(stringIndexOfFrom("abcabc", "b", -5), 1, "negative position");
+    assert(stringIndexOfFrom("abcabc", "", 100), 6, "position past the end");
+    assert(stringIndexOfFrom("abcabc", "b", 2.5), 4, "float position");
+    assert(stringIndexOfFrom("abcabc", "b", undefined), 1, "undefined position");
+
+    assert(stringSlice("abcdef", 2), "cdef", "start");
+    assert(stringSlice("abcdef", -2), "ef", "negative start");
+    assert(stringSlice("abcdef", 10), "", "start past the end");
+    assert(stringSlice("abcdef", 1.5), "bcdef", "float start");
+    assert(stringSlice(new String("abcdef"), 3), "def", "String object receiver");
+    assert(stringSliceRange("abcdef", 1, 3), "bc", "range");
+    assert(stringSliceRange("abcdef", -3, -1), "de", "negative range");
+    assert(stringSliceRange("abcdef", 4, 2), "", "end before start");
+    assert(stringSliceRange("abcdef", 2, 100), "cdef", "end past the end");
+    assert(stringSliceRange("abcdef", 2, undefined), "cdef", "undefined end");
+}
+
+delete Array.prototype[2];
+assert(arrayIndexOf(holey, "proto"), -1, "hole without the prototype value");
+
+// A getter reached through a hole is an implicit call. The loop must see the value it stores rather than
+// one loaded before the call.
+function sumWithIndexOf(a, state)
+{
+    var sum = 0;
+    for (var i = 0; i < 4; i++)
+    {
+        sum += state.step;
+        a.indexOf("none");
+    }
+    return sum;
+}
+
+var getterState = { step: 1 };
+for (var iter = 0; iter < 10; iter++)
+{
+    getterState.step = 1;
+    assert(sumWithIndexOf([0, 1, 2], getterState), 4, "no implicit call");
+}
+Object.defineProperty(Array.prototype, 1, { get: function () { getterState.step = 10; return "getter"; }, configurable: true });
+getterState.step = 1;
+assert(sumWithIndexOf([0, , 2], getterState), 31, "implicit call through a hole");
+delete Array.prototype[1];
+
+// Receivers that aren't arrays take the helper path
+var arrayLike = { length: 3, 0: "x", 1: "y", 2: "z", indexOf: Array.prototype.indexOf };
+assert(arrayIndexOf(arrayLike, "z"), 2, "array-like receiver");
+var es5Array = [1, 2, 3];
+Object.defineProperty(es5Array, 1, { get: function () { return 7; } });
+assert(arrayIndexOf(es5Array, 7), 1, "accessor element");
+assert(arrayIndexOf(new Int8Array([4, 5]), 5), 1, "typed array");
+
+// Receivers that aren't strings take the helper path and throw the usual errors
+var errors = 0;
+[null, undefined].forEach(function (o) {
+    try
+    {
+        String.prototype.indexOf.call(o, "a");
+    }
+    catch (e)
+    {
+        assert(e instanceof TypeError, true, "TypeError for null or undefined receiver");
+        errors++;
+    }
+});
+assert(errors, 2, "null and undefined receivers throw");
+assert(stringIndexOf({ indexOf: String.prototype.indexOf, toString: function () { return "obj"; } }, "b"), 1, "object receiver");
+assert(stringSlice({ slice: String.prototype.slice, toString: function () { return "obj"; } }, 1), "bj", "object slice receiver");
+
+// A replaced String.prototype.slice is called instead of the inlined builtin
+var originalSlice = String.prototype.slice;
+String.prototype.slice = function (start) { return "patched " + start; };
+assert(stringSlice("abc", 1), "patched 1", "patched slice");
+String.prototype.slice = originalSlice;
+assert(stringSlice("abc", 1), "bc", "restored slice");
+
+WScript.Echo("PASSED");
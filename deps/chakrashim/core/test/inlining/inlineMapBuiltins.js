@@ -0,0 +1,88 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Map.prototype.get/has/set are inlined as direct calls, with a fast path for Map receivers
+// that falls back to the entry point for everything else.
+
+function assert(actual, expected, message)
+{
+    if (actual !== expected)
+    {
+        throw new Error(message + " Actual: " + actual + " Expected: " + expected);
+    }
+}
+
+function fill(m, n)
+{
+    for (var i = 0; i < n; i++)
+    {
+        m.set(i, i * 2);
+    }
+    m.set(-0, "zero");     // overwrites key 0
+    m.set("key", "value");
+    return m;
+}
+
+function sum(m, n)
+{
+    var total = 0;
+    for (var i = 1; i < n; i++)
+    {
+        if (m.has(i))
+        {
+            total += m.get(i);
+        }
+    }
+    return total;
+}
+
+function lookup(m, key)
+{
+    return m.get(key);
+}
+
+class MyMap extends Map {}
+
+for (var iter = 0; iter < 10; iter++)
+{
+    var m = fill(new Map(), 100);
+    assert(sum(m, 100), 9900, "sum of values");
+    assert(m.size, 101, "size");
+    assert(m.get(0), "zero", "-0 is normalized to +0");
+    assert(Object.is([...m.keys()][0], 0), true, "-0 key is stored as +0");
+    assert(lookup(m, "key"), "value", "string key");
+    assert(lookup(m, "missing"), undefined, "missing key");
+    assert(m.has(1000), false, "missing key has");
+
+    var sub = fill(new MyMap(), 10);
+    assert(sum(sub, 10), 90, "subclass sum");
+}
+
+// Receivers that aren't Maps take the helper path and throw the usual errors
+var notMaps = [Object.create(Map.prototype), { get: Map.prototype.get }, new Set(), new WeakMap()];
+notMaps[2].get = Map.prototype.get;
+notMaps[3].get = Map.prototype.get;
+var errors = 0;
+notMaps.forEach(function (o) {
+    try
+    {
+        lookup(o, 1);
+    }
+    catch (e)
+    {
+        assert(e instanceof TypeError, true, "TypeError for non-Map receiver");
+        errors++;
+    }
+});
+assert(errors, notMaps.length, "non-Map receivers throw");
+
+// A replaced Map.prototype.get is called instead of the inlined builtin
+var originalGet = Map.prototype.get;
+Map.prototype.get = function (key) { return "patched " + key; };
+assert(lookup(new Map(), 1), "patched 1", "patched get");
+Map.prototype.get = originalGet;
+assert(lookup(new Map([[1, "one"]]), 1), "one", "restored get");
+
+WScript.Echo("PASSED");
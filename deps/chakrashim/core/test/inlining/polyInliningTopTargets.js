@@ -0,0 +1,52 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// A call site with more targets than are inlined. The hottest ones are inlined and the others go through the
+// fallback call, which must keep working when new targets show up after the function was jitted.
+var handlers = [
+    function (x) { return x + 0; },
+    function (x) { return x + 1; },
+    function (x) { return x + 2; },
+    function (x) { return x + 3; },
+    function (x) { return x + 4; },
+    function (x) { return x + 5; },
+    function (x) { return x + 6; },
+    function (x) { return x + 7; },
+    function (x) { return x + 8; },
+    function (x) { return x + 9; },
+    function (x) { return x + 10; },
+    function (x) { return x + 11; }
+];
+
+function run(targetCount, hotTargetCount, iterations) {
+    var sum = 0;
+    for (var i = 0; i < iterations; i++) {
+        // Most calls go to the first hotTargetCount handlers
+        var index = i % 8 === 0 ? i % targetCount : i % hotTargetCount;
+        sum += handlers[index](i);
+    }
+    return sum;
+}
+
+function expected(targetCount, hotTargetCount, iterations) {
+    var sum = 0;
+    for (var i = 0; i < iterations; i++) {
+        sum += i + (i % 8 === 0 ? i % targetCount : i % hotTargetCount);
+    }
+    return sum;
+}
+
+var passed = true;
+[[8, 3, 200], [8, 3, 200], [12, 4, 200], [2, 2, 200], [12, 1, 200]].forEach(function (test) {
+    var result = run(test[0], test[1], test[2]);
+    if (result !== expected(test[0], test[1], test[2])) {
+        WScript.Echo("FAILED: " + test + ": " + result);
+        passed = false;
+    }
+});
+
+if (passed) {
+    WScript.Echo("PASSED");
+}
@@ -0,0 +1,36 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Jit many loop bodies, in functions that are then dropped, so that their code is written to and freed
+// from the code pages while other loop bodies are still being jitted and run.
+
+function makeLoop(k)
+{
+    return new Function("n",
+        "var sum = 0;" +
+        "for (var i = 0; i < n; i++) {" +
+        "    sum += (i * " + k + ") & 0xff;" +
+        "    if (i % " + (k + 2) + " === 0) { sum ^= " + k + "; }" +
+        "}" +
+        "return sum;");
+}
+
+var total = 0;
+for (var round = 0; round < 20; round++)
+{
+    var loops = [];
+    for (var k = 0; k < 50; k++)
+    {
+        loops.push(makeLoop(k));
+    }
+    for (var k = 0; k < loops.length; k++)
+    {
+        total = (total + loops[k](200 + k)) | 0;
+    }
+    loops = null;
+    CollectGarbage();
+}
+
+WScript.Echo(total);
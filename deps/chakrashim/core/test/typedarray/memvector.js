@@ -0,0 +1,124 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Compares element-wise typed array kernels run by the jitted code with the expected values
+// need to run with -mic:1 -off:simplejit -off:JITLoopBody
+// Run locally with -trace:memvector -trace:bailout to help find bugs
+
+const global = this;
+const types = ["Float32Array", "Float64Array"];
+const n = 500;
+let passed = 1;
+
+function makeKernels() {
+  return {
+    add: { fn: (a, b, c, start, end) => { for (var i = start; i < end; i++) { c[i] = a[i] + b[i]; } }, op: (x, y) => x + y },
+    sub: { fn: (a, b, c, start, end) => { for (var i = start; i < end; i++) { c[i] = a[i] - b[i]; } }, op: (x, y) => x - y },
+    mul: { fn: (a, b, c, start, end) => { for (var i = start; i < end; i++) { c[i] = a[i] * b[i]; } }, op: (x, y) => x * y },
+    div: { fn: (a, b, c, start, end) => { for (var i = start; i < end; i++) { c[i] = a[i] / b[i]; } }, op: (x, y) => x / y },
+    scale: { fn: (a, b, c, start, end) => { for (var i = start; i < end; i++) { c[i] = a[i] * 2.5; } }, op: (x, y) => x * 2.5 },
+    scaleFirst: { fn: (a, b, c, start, end) => { for (var i = start; i < end; i++) { c[i] = 0.25 * a[i]; } }, op: (x, y) => 0.25 * x },
+    reverse: { fn: (a, b, c, start, end) => { for (var i = end - 1; i >= start; i--) { c[i] = a[i] - b[i]; } }, op: (x, y) => x - y },
+  };
+}
+
+function makeInvariantKernel() {
+  return function (a, b, c, start, end, k) { for (var i = start; i < end; i++) { c[i] = a[i] + k; } };
+}
+
+function check(name, arrType, expected, actual) {
+  for (let j = 0; j < n; j++) {
+    if (!Object.is(expected[j], actual[j])) {
+      passed = 0;
+      WScript.Echo(name + " " + arrType + " " + j + " " + expected[j] + " " + actual[j]);
+      return;
+    }
+  }
+}
+
+for (let arrType of types) {
+  const round = arrType === "Float32Array" ? Math.fround : (x => x);
+  const a = new global[arrType](n);
+  const b = new global[arrType](n);
+  for (let i = 0; i < n; ++i) {
+    a[i] = i + 0.1;
+    b[i] = (i % 7) - 3.3;
+  }
+
+  const kernels = makeKernels();
+  for (let name in kernels) {
+    const kernel = kernels[name];
+    const c = new global[arrType](n);
+    const expected = new global[arrType](n);
+    for (let i = 0; i < n; ++i) {
+      expected[i] = round(kernel.op(a[i], b[i]));
+    }
+    const mid = (n / 2) | 0;
+    kernel.fn(a, b, c, 0, mid);
+    kernel.fn(a, b, c, mid, n);
+    check(name, arrType, expected, c);
+  }
+
+  // Loop invariant scalar operand
+  {
+    const test = makeInvariantKernel();
+    const c = new global[arrType](n);
+    const expected = new global[arrType](n);
+    for (let i = 0; i < n; ++i) {
+      expected[i] = round(a[i] + 1.75);
+    }
+    test(a, b, c, 0, 10, 1.75);
+    test(a, b, c, 10, n, 1.75);
+    check("invariant", arrType, expected, c);
+  }
+
+  // Destination is also a source
+  {
+    const c = new global[arrType](a);
+    const expected = new global[arrType](n);
+    for (let i = 0; i < n; ++i) {
+      expected[i] = round(c[i] + b[i]);
+    }
+    const test = makeKernels().add.fn;
+    test(c, b, c, 0, 10);
+    test(c, b, c, 10, n);
+    check("inplace", arrType, expected, c);
+  }
+
+  // Overlapping views of the same buffer must keep the loop order
+  {
+    const buffer = new ArrayBuffer((n + 1) * global[arrType].BYTES_PER_ELEMENT);
+    const src = new global[arrType](buffer, 0, n);
+    const dst = new global[arrType](buffer, global[arrType].BYTES_PER_ELEMENT, n);
+    const expected = [1];
+    for (let i = 0; i < n; ++i) {
+      expected[i + 1] = round(expected[i] * 2.5);
+    }
+    src.fill(1);
+    const test = makeKernels().scale.fn;
+    test(src, b, dst, 0, 10);
+    test(src, b, dst, 10, n);
+    check("overlap", arrType, expected.slice(1), dst);
+  }
+
+  // Out of range indices are left to the loop
+  {
+    const short = new global[arrType](n / 2);
+    const c = new global[arrType](n);
+    const test = makeKernels().add.fn;
+    test(a, short, c, 0, 10);
+    test(a, short, c, 10, n);
+    if (!Number.isNaN(c[n - 1]) || c[0] !== round(a[0] + short[0])) {
+      passed = 0;
+      WScript.Echo("out of range " + arrType + " " + c[0] + " " + c[n - 1]);
+    }
+  }
+}
+
+if (passed === 1) {
+  WScript.Echo("PASSED");
+} else {
+  WScript.Echo("FAILED");
+}
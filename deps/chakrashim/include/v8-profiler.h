@@ -32,13 +32,45 @@ namespace v8 {
 
 struct HeapStatsUpdate;
 
-// NOT IMPLEMENTED
+class V8_EXPORT CpuProfileNode {
+ public:
+  Local<String> GetFunctionName() const;
+  int GetScriptId() const;
+  Local<String> GetScriptResourceName() const;
+  int GetLineNumber() const;
+  int GetColumnNumber() const;
+  const char* GetBailoutReason() const;
+  unsigned GetHitCount() const;
+  unsigned GetCallUid() const;
+  unsigned GetNodeId() const;
+  int GetChildrenCount() const;
+  const CpuProfileNode* GetChild(int index) const;
+
+  static const int kNoLineNumberInfo = 0;
+  static const int kNoColumnNumberInfo = 0;
+};
+
+class V8_EXPORT CpuProfile {
+ public:
+  Local<String> GetTitle() const;
+  const CpuProfileNode* GetTopDownRoot() const;
+  int GetSamplesCount() const;
+  const CpuProfileNode* GetSample(int index) const;
+  int64_t GetSampleTimestamp(int index) const;
+  int64_t GetStartTime() const;
+  int64_t GetEndTime() const;
+  void Delete();
+};
+
+// Samples are taken by the engine on the script thread, at the next function
+// entry or loop back edge after each sampling tick, rather than by
+// interrupting the thread.
 class V8_EXPORT CpuProfiler {
  public:
-  // void SetSamplingInterval(int us);
-  // void StartProfiling(Handle<String> title, bool record_samples = false);
-  // CpuProfile* StopProfiling(Handle<String> title);
-  void SetIdle(bool is_idle) {}
+  void SetSamplingInterval(int us);
+  void StartProfiling(Local<String> title, bool record_samples = false);
+  CpuProfile* StopProfiling(Local<String> title);
+  void SetIdle(bool is_idle);
 };
 
 class V8_EXPORT OutputStream {  // NOLINT
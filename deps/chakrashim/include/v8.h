@@ -78,6 +78,7 @@ namespace v8 {
 
 class AccessorSignature;
 class Array;
+class ArrayBuffer;
 class Value;
 class External;
 class Primitive;
@@ -436,6 +437,9 @@ class WeakCallbackData {
 
 
 namespace chakrashim {
+// Shared by the persistent handles that weakly refer to the same object. These
+// are handed out by the isolate's weak reference table rather than allocated
+// one by one.
 struct WeakReferenceCallbackWrapper {
   void *parameters;
   union {
@@ -443,24 +447,142 @@ struct WeakReferenceCallbackWrapper {
     WeakCallbackData<Value, void>::Callback dataCallback;
   };
   bool isWeakCallbackInfo;
+  unsigned int refCount;
+  // Table slot holding the object, cleared by the GC once it is collected
+  JsValueRef *object;
 };
-template class V8_EXPORT std::shared_ptr<WeakReferenceCallbackWrapper>;
 
-// A helper method for setting an object with a WeakReferenceCallback. The
-// callback will be called before the object is released.
+// A helper method for setting an object with a WeakReferenceCallback.
+// WeakCallbackInfo callbacks run together after the GC that collected their
+// objects, WeakCallbackData callbacks run before the object is released.
 V8_EXPORT void SetObjectWeakReferenceCallback(
   JsValueRef object,
   WeakCallbackInfo<void>::Callback callback,
   void* parameters,
-  std::shared_ptr<WeakReferenceCallbackWrapper>* weakWrapper);
+  WeakReferenceCallbackWrapper** weakWrapper);
 V8_EXPORT void SetObjectWeakReferenceCallback(
   JsValueRef object,
   WeakCallbackData<Value, void>::Callback callback,
   void* parameters,
-  std::shared_ptr<WeakReferenceCallbackWrapper>* weakWrapper);
-// A helper method for turning off the WeakReferenceCallback that was set using
-// the previous method
-V8_EXPORT void ClearObjectWeakReferenceCallback(JsValueRef object, bool revive);
+  WeakReferenceCallbackWrapper** weakWrapper);
+// Drops a reference taken by the methods above. The last one turns off the
+// callback, and with revive keeps the object alive if it is being collected.
+V8_EXPORT void ReleaseWeakReference(WeakReferenceCallbackWrapper* weakWrapper,
+                                    bool revive);
+
+// Weak callbacks run after the latest GC that collected weakly held objects,
+// and totals since the isolate was created.
+struct WeakCallbackStatistics {
+  size_t lastCallbackCount;
+  uint64_t lastCallbackTimeNs;
+  size_t totalCallbackCount;
+  uint64_t totalCallbackTimeNs;
+  size_t collectionCount;
+};
+V8_EXPORT void GetWeakCallbackStatistics(Isolate* isolate,
+                                         WeakCallbackStatistics* statistics);
+
+// JIT counters of the functions of the current context, one object per
+// function that has been queued for JIT. Returns an empty handle if the engine
+// was built without a JIT.
+V8_EXPORT Local<Array> GetJitTelemetry(Isolate* isolate);
+
+// Engine counters: the number of function bodies parsed on background threads
+// and the weak callback statistics above, both since the isolate was created,
+// and the microtasks run by the current context. Times are in nanoseconds.
+V8_EXPORT Local<Object> GetEngineStatistics(Isolate* isolate);
+
+// How the engine represents values in memory, read once when the first
+// isolate is created. Lets the type checks below run inline instead of going
+// through a JSRT call.
+extern V8_EXPORT JsValueLayout g_valueLayout;
+
+V8_INLINE bool IsTaggedInt(const void* value) {
+  uintptr_t bits = reinterpret_cast<uintptr_t>(value);
+  return (bits & g_valueLayout.intTagMask) == g_valueLayout.intTag;
+}
+
+V8_INLINE int32_t GetTaggedIntValue(const void* value) {
+  return static_cast<int32_t>(reinterpret_cast<uintptr_t>(value)) >>
+    g_valueLayout.intValueShift;
+}
+
+V8_INLINE bool IsTaggedFloat(const void* value) {
+  uintptr_t bits = reinterpret_cast<uintptr_t>(value);
+  return !IsTaggedInt(value) && (bits & g_valueLayout.floatTagMask) != 0;
+}
+
+V8_INLINE int GetTypeId(const void* value) {
+  if (IsTaggedInt(value)) {
+    return g_valueLayout.integerTypeId;
+  }
+  if (IsTaggedFloat(value)) {
+    return g_valueLayout.numberTypeId;
+  }
+  const char* type = *reinterpret_cast<const char* const*>(
+    static_cast<const char*>(value) + g_valueLayout.typeOffset);
+  return *reinterpret_cast<const int*>(type + g_valueLayout.typeIdOffset);
+}
+
+V8_INLINE bool IsTypedArrayTypeId(int typeId) {
+  return typeId >= g_valueLayout.firstTypedArrayTypeId &&
+    typeId <= g_valueLayout.lastTypedArrayTypeId;
+}
+
+// Element count of a typed array, and a pointer to its first element. For a
+// Uint8Array (and so for a Buffer) these are its bytes. Detaching an array
+// buffer sets the length of its views to 0 but leaves their old storage
+// pointer, so empty views have no data.
+V8_INLINE size_t GetTypedArrayLength(const void* value) {
+  return *reinterpret_cast<const uint32_t*>(
+    static_cast<const char*>(value) + g_valueLayout.typedArrayLengthOffset);
+}
+
+V8_INLINE char* GetTypedArrayData(const void* value) {
+  if (GetTypedArrayLength(value) == 0) {
+    return nullptr;
+  }
+  return *reinterpret_cast<char* const*>(
+    static_cast<const char*>(value) + g_valueLayout.typedArrayBufferOffset);
+}
+
+// A queue of messages between isolates, which may run on different threads.
+// A message is a string plus a list of array buffers. Array buffers owning
+// their memory are detached from the sending isolate and adopted by the
+// receiving one without copying it; external ones, such as those backing a
+// Buffer, are copied once.
+class V8_EXPORT MessageChannel {
+ public:
+  typedef void (*NotifyCallback)(void* data);
+
+  // The new channel holds one reference, owned by the caller.
+  static MessageChannel* New();
+
+  virtual void Ref() = 0;
+  // Deletes the channel with its undelivered messages on the last reference.
+  virtual void Unref() = 0;
+
+  // Called on the posting thread after each message is queued, e.g. to wake
+  // up the loop of the receiving thread.
+  virtual void SetNotifyCallback(NotifyCallback callback, void* data) = 0;
+
+  // Queues a message, detaching or copying the array buffers in transfer.
+  // Returns false without queuing or detaching anything if an argument is
+  // invalid, an array buffer is listed twice or already detached, or a copy
+  // can't be allocated.
+  virtual bool Post(Isolate* isolate, Local<String> message,
+                    Local<ArrayBuffer>* transfer, int transferCount) = 0;
+
+  // Takes the oldest message and creates its array buffers in the isolate.
+  // Returns false if there is no message, or it couldn't be created.
+  virtual bool Receive(Isolate* isolate, Local<String>* message,
+                       Local<Array>* transfer) = 0;
+
+  virtual size_t GetPendingCount() = 0;
+
+ protected:
+  virtual ~MessageChannel() {}
+};
 }  // namespace chakrashim
 
 enum class WeakCallbackType { kParameter, kInternalFields };
@@ -525,7 +647,8 @@ class PersistentBase {
   template<class F> friend class Local;
   template<class F1, class F2> friend class Persistent;
 
-  explicit V8_INLINE PersistentBase(T* val) : val_(val) {}
+  explicit V8_INLINE PersistentBase(T* val)
+    : val_(val), _weakWrapper(nullptr) {}
   PersistentBase(PersistentBase& other) = delete;  // NOLINT
   void operator=(PersistentBase&) = delete;
   V8_INLINE static T* New(Isolate* isolate, T* that);
@@ -534,7 +657,7 @@ class PersistentBase {
   void SetWeakCommon(P* parameter, Callback callback);
 
   T* val_;
-  std::shared_ptr<chakrashim::WeakReferenceCallbackWrapper> _weakWrapper;
+  chakrashim::WeakReferenceCallbackWrapper* _weakWrapper;
 };
 
 
@@ -669,7 +792,7 @@ class Global : public PersistentBase<T> {
   V8_INLINE Global(Global&& other) : PersistentBase<T>(other.val_) {
     this->_weakWrapper = other._weakWrapper;
     other.val_ = nullptr;
-    other._weakWrapper.reset();
+    other._weakWrapper = nullptr;
   }
 
   V8_INLINE ~Global() { this->Reset(); }
@@ -682,7 +805,7 @@ class Global : public PersistentBase<T> {
       this->val_ = rhs.val_;
       this->_weakWrapper = rhs._weakWrapper;
       rhs.val_ = nullptr;
-      rhs._weakWrapper.reset();
+      rhs._weakWrapper = nullptr;
     }
     return *this;
   }
@@ -720,10 +843,10 @@ class Eternal : private Persistent<T> {
 // collected. Chakra, on the other hand, directly walks the stack and has no
 // HandleScope mechanism. It requires hosts to keep "local" references on the
 // stack or else turn them into "persistent" references through
-// JsAddRef/JsRelease. To paper over this difference, the bridge HandleScope
-// will create a JS array and will hold that reference on the stack. Any local
-// values created will then be added to that array. So the GC will see the array
-// on the stack and then keep those local references alive.
+// JsAddRef/JsRelease. To paper over this difference, the isolate keeps a
+// native slab of value slots that the GC scans as roots. Local values are
+// pushed onto the slab, and the bridge HandleScope records the top of the slab
+// on entry and moves it back on exit, releasing its locals in one step.
 class V8_EXPORT HandleScope {
  public:
   HandleScope(Isolate* isolate);
@@ -731,14 +854,17 @@ class V8_EXPORT HandleScope {
 
   static int NumberOfHandles(Isolate* isolate);
 
+ protected:
+  HandleScope(Isolate* isolate, bool escapable);
+
  private:
   friend class EscapableHandleScope;
   template <class T> friend class Local;
-  static const int kOnStackLocals = 5;  // Arbitrary number of refs on stack
 
-  JsValueRef _locals[kOnStackLocals];   // Save some refs on stack
-  JsValueRef _refs;                     // More refs go to a JS array
-  int _count;
+  void *_slab;                          // jsrt::HandleSlab of the isolate
+  void *_markChunk;                     // Slab position to restore on exit
+  JsValueRef *_markTop;
+  JsValueRef *_escapeSlot;              // Reserved in the enclosing scope
   HandleScope *_prev;
   JsContextRef _contextRef;
   struct AddRefRecord {
@@ -747,6 +873,7 @@ class V8_EXPORT HandleScope {
   } *_addRefRecordHead;
 
   bool AddLocal(JsValueRef value);
+  bool AddEscapedLocal(JsValueRef value);
   bool AddLocalContext(JsContextRef value);
   bool AddLocalAddRef(JsRef value);
 
@@ -758,7 +885,7 @@ class V8_EXPORT HandleScope {
 
 class V8_EXPORT EscapableHandleScope : public HandleScope {
  public:
-  EscapableHandleScope(Isolate* isolate) : HandleScope(isolate) {}
+  EscapableHandleScope(Isolate* isolate) : HandleScope(isolate, true) {}
 
   template <class T>
   Local<T> Escape(Handle<T> value) { return Close(value); }
@@ -949,16 +1076,16 @@ class V8_EXPORT StackFrame {
 
 class V8_EXPORT Value : public Data {
  public:
-  bool IsUndefined() const;
-  bool IsNull() const;
-  bool IsTrue() const;
-  bool IsFalse() const;
-  bool IsString() const;
-  bool IsFunction() const;
-  bool IsArray() const;
-  bool IsObject() const;
-  bool IsBoolean() const;
-  bool IsNumber() const;
+  V8_INLINE bool IsUndefined() const;
+  V8_INLINE bool IsNull() const;
+  V8_INLINE bool IsTrue() const;
+  V8_INLINE bool IsFalse() const;
+  V8_INLINE bool IsString() const;
+  V8_INLINE bool IsFunction() const;
+  V8_INLINE bool IsArray() const;
+  V8_INLINE bool IsObject() const;
+  V8_INLINE bool IsBoolean() const;
+  V8_INLINE bool IsNumber() const;
   bool IsInt32() const;
   bool IsUint32() const;
   bool IsDate() const;
@@ -968,19 +1095,19 @@ class V8_EXPORT Value : public Data {
   bool IsNativeError() const;
   bool IsRegExp() const;
   bool IsExternal() const;
-  bool IsArrayBuffer() const;
-  bool IsArrayBufferView() const;
-  bool IsTypedArray() const;
-  bool IsUint8Array() const;
-  bool IsUint8ClampedArray() const;
-  bool IsInt8Array() const;
-  bool IsUint16Array() const;
-  bool IsInt16Array() const;
-  bool IsUint32Array() const;
-  bool IsInt32Array() const;
-  bool IsFloat32Array() const;
-  bool IsFloat64Array() const;
-  bool IsDataView() const;
+  V8_INLINE bool IsArrayBuffer() const;
+  V8_INLINE bool IsArrayBufferView() const;
+  V8_INLINE bool IsTypedArray() const;
+  V8_INLINE bool IsUint8Array() const;
+  V8_INLINE bool IsUint8ClampedArray() const;
+  V8_INLINE bool IsInt8Array() const;
+  V8_INLINE bool IsUint16Array() const;
+  V8_INLINE bool IsInt16Array() const;
+  V8_INLINE bool IsUint32Array() const;
+  V8_INLINE bool IsInt32Array() const;
+  V8_INLINE bool IsFloat32Array() const;
+  V8_INLINE bool IsFloat64Array() const;
+  V8_INLINE bool IsDataView() const;
   bool IsMapIterator() const;
   bool IsSetIterator() const;
   bool IsMap() const;
@@ -1214,9 +1341,12 @@ class V8_EXPORT String : public Name {
 
  private:
   template <class ToWide>
-  static MaybeLocal<String> New(const ToWide& toWide,
-                                const char *data, int length = -1);
-  static MaybeLocal<String> New(const wchar_t *data, int length = -1);
+  static MaybeLocal<String> New(
+    const ToWide& toWide, const char *data, int length = -1,
+    v8::NewStringType type = v8::NewStringType::kNormal);
+  static MaybeLocal<String> New(
+    const wchar_t *data, int length = -1,
+    v8::NewStringType type = v8::NewStringType::kNormal);
 };
 
 class V8_EXPORT Number : public Primitive {
@@ -2417,6 +2547,102 @@ class V8_EXPORT Locker {
 };
 
 
+//
+// Value members
+//
+
+bool Value::IsUndefined() const {
+  return chakrashim::GetTypeId(this) ==
+    chakrashim::g_valueLayout.undefinedTypeId;
+}
+
+bool Value::IsNull() const {
+  return chakrashim::GetTypeId(this) == chakrashim::g_valueLayout.nullTypeId;
+}
+
+bool Value::IsTrue() const {
+  return IsBoolean() && *reinterpret_cast<const int*>(
+    reinterpret_cast<const char*>(this) +
+    chakrashim::g_valueLayout.booleanValueOffset) != 0;
+}
+
+bool Value::IsFalse() const {
+  return IsBoolean() && *reinterpret_cast<const int*>(
+    reinterpret_cast<const char*>(this) +
+    chakrashim::g_valueLayout.booleanValueOffset) == 0;
+}
+
+bool Value::IsString() const {
+  return chakrashim::GetTypeId(this) == chakrashim::g_valueLayout.stringTypeId;
+}
+
+bool Value::IsFunction() const {
+  return chakrashim::GetTypeId(this) ==
+    chakrashim::g_valueLayout.functionTypeId;
+}
+
+bool Value::IsArray() const {
+  int typeId = chakrashim::GetTypeId(this);
+  return (typeId >= chakrashim::g_valueLayout.firstArrayTypeId &&
+          typeId <= chakrashim::g_valueLayout.lastArrayTypeId) ||
+    typeId == chakrashim::g_valueLayout.es5ArrayTypeId;
+}
+
+bool Value::IsObject() const {
+  return chakrashim::GetTypeId(this) >
+    chakrashim::g_valueLayout.lastPrimitiveTypeId;
+}
+
+bool Value::IsBoolean() const {
+  return chakrashim::GetTypeId(this) ==
+    chakrashim::g_valueLayout.booleanTypeId;
+}
+
+bool Value::IsNumber() const {
+  int typeId = chakrashim::GetTypeId(this);
+  return typeId >= chakrashim::g_valueLayout.firstNumberTypeId &&
+    typeId <= chakrashim::g_valueLayout.lastNumberTypeId;
+}
+
+bool Value::IsArrayBuffer() const {
+  return chakrashim::GetTypeId(this) ==
+    chakrashim::g_valueLayout.arrayBufferTypeId;
+}
+
+bool Value::IsArrayBufferView() const {
+  int typeId = chakrashim::GetTypeId(this);
+  return chakrashim::IsTypedArrayTypeId(typeId) ||
+    typeId == chakrashim::g_valueLayout.dataViewTypeId;
+}
+
+bool Value::IsTypedArray() const {
+  return chakrashim::IsTypedArrayTypeId(chakrashim::GetTypeId(this));
+}
+
+#define DEFINE_TYPEDARRAY_CHECK(ArrayType) \
+  bool Value::Is##ArrayType##Array() const { \
+    return chakrashim::GetTypeId(this) == \
+      chakrashim::g_valueLayout.firstTypedArrayTypeId + \
+      JsArrayType##ArrayType; \
+  }
+
+DEFINE_TYPEDARRAY_CHECK(Uint8)
+DEFINE_TYPEDARRAY_CHECK(Uint8Clamped)
+DEFINE_TYPEDARRAY_CHECK(Int8)
+DEFINE_TYPEDARRAY_CHECK(Uint16)
+DEFINE_TYPEDARRAY_CHECK(Int16)
+DEFINE_TYPEDARRAY_CHECK(Uint32)
+DEFINE_TYPEDARRAY_CHECK(Int32)
+DEFINE_TYPEDARRAY_CHECK(Float32)
+DEFINE_TYPEDARRAY_CHECK(Float64)
+#undef DEFINE_TYPEDARRAY_CHECK
+
+bool Value::IsDataView() const {
+  return chakrashim::GetTypeId(this) ==
+    chakrashim::g_valueLayout.dataViewTypeId;
+}
+
+
 //
 // Local<T> members
 //
@@ -2469,7 +2695,9 @@ void Persistent<T, M>::Copy(const Persistent<S, M2>& that) {
 
   this->val_ = that.val_;
   this->_weakWrapper = that._weakWrapper;
-  if (val_ && !IsWeak()) {
+  if (IsWeak()) {
+    this->_weakWrapper->refCount++;
+  } else if (val_) {
     JsAddRef(val_, nullptr);
   }
 
@@ -2483,7 +2711,7 @@ bool PersistentBase<T>::IsNearDeath() const {
 
 template <class T>
 bool PersistentBase<T>::IsWeak() const {
-  return static_cast<bool>(_weakWrapper);
+  return _weakWrapper != nullptr;
 }
 
 template <class T>
@@ -2491,10 +2719,8 @@ void PersistentBase<T>::Reset() {
   if (this->IsEmpty() || V8::IsDead()) return;
 
   if (IsWeak()) {
-    if (_weakWrapper.unique()) {
-      chakrashim::ClearObjectWeakReferenceCallback(val_, /*revive*/false);
-    }
-    _weakWrapper.reset();
+    chakrashim::ReleaseWeakReference(_weakWrapper, /*revive*/false);
+    _weakWrapper = nullptr;
   } else {
     JsRelease(val_, nullptr);
   }
@@ -2558,10 +2784,8 @@ P* PersistentBase<T>::ClearWeak() {
   if (!IsWeak()) return nullptr;
 
   P* parameters = reinterpret_cast<P*>(_weakWrapper->parameters);
-  if (_weakWrapper.unique()) {
-    chakrashim::ClearObjectWeakReferenceCallback(val_, /*revive*/true);
-  }
-  _weakWrapper.reset();
+  chakrashim::ReleaseWeakReference(_weakWrapper, /*revive*/true);
+  _weakWrapper = nullptr;
 
   JsAddRef(val_, nullptr);
   return parameters;
@@ -2582,7 +2806,7 @@ void PersistentBase<T>::SetWrapperClassId(uint16_t class_id) {
 
 template <class T>
 Local<T> HandleScope::Close(Handle<T> value) {
-  if (_prev == nullptr || !_prev->AddLocal(*value)) {
+  if (!AddEscapedLocal(*value)) {
     return Local<T>();
   }
 
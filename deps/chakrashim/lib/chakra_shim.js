@@ -25,8 +25,6 @@
     Function_prototype_toString = Function.prototype.toString,
     Object_defineProperty = Object.defineProperty,
     Object_getOwnPropertyDescriptor = Object.getOwnPropertyDescriptor,
-    Object_getOwnPropertyNames = Object.getOwnPropertyNames,
-    Object_keys = Object.keys,
     Object_prototype_toString = Object.prototype.toString,
     Object_setPrototypeOf = Object.setPrototypeOf,
     Reflect_apply = Reflect.apply,
@@ -424,51 +422,7 @@
     };
   }
 
-  // Simulate v8 micro tasks queue
-  var microTasks = [];
-
   function patchUtils(utils) {
-    var isUintRegex = /^(0|[1-9]\\d*)$/;
-
-    var isUint = function(value) {
-      var result = isUintRegex.test(value);
-      isUintRegex.lastIndex = 0;
-      return result;
-    };
-    utils.cloneObject = function(source, target) {
-      Object_getOwnPropertyNames(source).forEach(function(key) {
-        try {
-          var desc = Object_getOwnPropertyDescriptor(source, key);
-          if (desc.value === source) desc.value = target;
-          Object_defineProperty(target, key, desc);
-        } catch (e) {
-          // Catch sealed properties errors
-        }
-      });
-    };
-    utils.getPropertyNames = function(a) {
-      var names = [];
-      for (var propertyName in a) {
-        names.push(propertyName);
-      }
-      return names;
-    };
-    utils.getEnumerableNamedProperties = function(obj) {
-      var props = [];
-      for (var key in obj) {
-        if (!isUint(key))
-          props.push(key);
-      }
-      return props;
-    };
-    utils.getEnumerableIndexedProperties = function(obj) {
-      var props = [];
-      for (var key in obj) {
-        if (isUint(key))
-          props.push(key);
-      }
-      return props;
-    };
     utils.createEnumerationIterator = function(props) {
       var i = 0;
       return {
@@ -488,22 +442,6 @@
         }
       };
     };
-    utils.getNamedOwnKeys = function(obj) {
-      var props = [];
-      Object_keys(obj).forEach(function(item) {
-        if (!isUint(item))
-          props.push(item);
-      });
-      return props;
-    };
-    utils.getIndexedOwnKeys = function(obj) {
-      var props = [];
-      Object_keys(obj).forEach(function(item) {
-        if (isUint(item))
-          props.push(item);
-      });
-      return props;
-    };
     utils.getStackTrace = function() {
       return captureStackTrace({}, undefined)();
     };
@@ -558,12 +496,6 @@
       return Symbol_for(key);
     };
     utils.ensureDebug = ensureDebug;
-    utils.enqueueMicrotask = function(task) {
-      microTasks.push(task);
-    };
-    utils.dequeueMicrotask = function(task) {
-      return microTasks.shift();
-    };
     utils.isProxy = function(value) {
       // CHAKRA-TODO: Need to add JSRT API to detect this
       return false;
@@ -69,24 +69,23 @@ ContextShim::ContextShim(IsolateShim * isolateShim,
       proxyOfGlobal(JS_INVALID_REFERENCE),
       globalObjectTemplateInstance(globalObjectTemplateInstance),
       promiseContinuationFunction(JS_INVALID_REFERENCE),
+      microtaskQueueStart(nullptr),
+      microtaskQueueEnd(nullptr),
+      microtaskRootRange(nullptr),
+      microtaskHead(0),
+      microtaskCount(0),
+      microtasksRun(0),
+      microtaskDrainTime(0),
 #include "jsrtcachedpropertyidref.inc"
 #undef DEF_IS_TYPE
-      cloneObjectFunction(JS_INVALID_REFERENCE),
-      getPropertyNamesFunction(JS_INVALID_REFERENCE),
       getOwnPropertyDescriptorFunction(JS_INVALID_REFERENCE),
-      getEnumerableNamedPropertiesFunction(JS_INVALID_REFERENCE),
-      getEnumerableIndexedPropertiesFunction(JS_INVALID_REFERENCE),
       createEnumerationIteratorFunction(JS_INVALID_REFERENCE),
       createPropertyDescriptorsEnumerationIteratorFunction
         (JS_INVALID_REFERENCE),
-      getNamedOwnKeysFunction(JS_INVALID_REFERENCE),
-      getIndexedOwnKeysFunction(JS_INVALID_REFERENCE),
       getStackTraceFunction(JS_INVALID_REFERENCE),
       getSymbolKeyForFunction(JS_INVALID_REFERENCE),
       getSymbolForFunction(JS_INVALID_REFERENCE),
-      ensureDebugFunction(JS_INVALID_REFERENCE),
-      enqueueMicrotaskFunction(JS_INVALID_REFERENCE),
-      dequeueMicrotaskFunction(JS_INVALID_REFERENCE) {
+      ensureDebugFunction(JS_INVALID_REFERENCE) {
   memset(globalConstructor, 0, sizeof(globalConstructor));
   memset(globalPrototypeFunction, 0, sizeof(globalPrototypeFunction));
 }
@@ -95,6 +94,10 @@ ContextShim::~ContextShim() {
   if (globalObjectTemplateInstance != JS_INVALID_REFERENCE) {
     JsRelease(globalObjectTemplateInstance, nullptr);
   }
+
+  if (microtaskRootRange != nullptr) {
+    JsRemoveRootRange(isolateShim->GetRuntimeHandle(), microtaskRootRange);
+  }
 }
 
 bool ContextShim::CheckConfigGlobalObjectTemplate() {
@@ -364,6 +367,11 @@ bool ContextShim::DoInitializeContextShim() {
     }
   }
 
+  if (JsAddRootRange(isolateShim->GetRuntimeHandle(), &microtaskQueueStart,
+                     &microtaskQueueEnd, &microtaskRootRange) != JsNoError) {
+    return false;
+  }
+
   if (jsrt::InitializePromise() != JsNoError) {
     return false;
   }
@@ -387,8 +395,8 @@ bool ContextShim::DoInitializeContextShim() {
   }
 
   // add idleGC callback into prepareQueue
-  if (IsolateShim::IsIdleGcEnabled()) {
-    uv_prepare_start(IsolateShim::GetCurrent()->idleGc_prepare_handle(),
+  if (isolateShim->IsIdleGcEnabled()) {
+    uv_prepare_start(isolateShim->idleGc_prepare_handle(),
                      PrepareIdleGC);
   }
 
@@ -427,24 +435,60 @@ bool ContextShim::ExposeGc() {
   return true;
 }
 
-bool ContextShim::ExecuteChakraShimJS() {
-  wchar_t buffer[_countof(chakra_shim_native) + 1];
+// chakra_shim.js is the same for every context, so its source is converted
+// once and its bytecode serialized by the first context that runs it. Both are
+// shared read-only by the contexts of all isolates, which then skip the parse.
+static uv_once_t s_chakraShimSourceOnce = UV_ONCE_INIT;
+static wchar_t* s_chakraShimSource;
+static uv_mutex_t s_chakraShimBytecodeMutex;
+static BYTE* s_chakraShimBytecode;
+static bool s_chakraShimBytecodeFailed;
+
+static void InitializeChakraShimSource() {
+  wchar_t* source = new wchar_t[_countof(chakra_shim_native) + 1];
+  CHAKRA_VERIFY(StringConvert::CopyRaw<unsigned char, wchar_t>(
+    chakra_shim_native, _countof(chakra_shim_native),
+    source, _countof(chakra_shim_native)) == JsNoError);
 
-  if (StringConvert::CopyRaw<unsigned char, wchar_t>(chakra_shim_native,
-      _countof(chakra_shim_native),
-      buffer,
-      _countof(chakra_shim_native)) != JsNoError) {
-    return false;
+  // Ensure the buffer is null terminated
+  source[_countof(chakra_shim_native)] = L'\0';
+  s_chakraShimSource = source;
+  CHAKRA_VERIFY(uv_mutex_init(&s_chakraShimBytecodeMutex) == 0);
+}
+
+static BYTE* GetChakraShimBytecode() {
+  uv_mutex_lock(&s_chakraShimBytecodeMutex);
+  if (s_chakraShimBytecode == nullptr && !s_chakraShimBytecodeFailed) {
+    unsigned int size = 0;
+    if (JsSerializeScript(s_chakraShimSource, nullptr, &size) == JsNoError) {
+      BYTE* bytecode = new BYTE[size];
+      if (JsSerializeScript(s_chakraShimSource, bytecode,
+                            &size) == JsNoError) {
+        s_chakraShimBytecode = bytecode;
+      } else {
+        delete[] bytecode;
+      }
+    }
+    // Don't retry for every context, parsing the source still works
+    s_chakraShimBytecodeFailed = s_chakraShimBytecode == nullptr;
   }
+  BYTE* bytecode = s_chakraShimBytecode;
+  uv_mutex_unlock(&s_chakraShimBytecodeMutex);
+  return bytecode;
+}
 
-  // Ensure the buffer is null terminated
-  buffer[_countof(chakra_shim_native)] = L'\0';
+bool ContextShim::ExecuteChakraShimJS() {
+  uv_once(&s_chakraShimSourceOnce, InitializeChakraShimSource);
 
   JsValueRef getInitFunction;
-  if (JsParseScript(buffer,
-                    JS_SOURCE_CONTEXT_NONE,
-                    L"chakra_shim.js",
-                    &getInitFunction) != JsNoError) {
+  BYTE* bytecode = GetChakraShimBytecode();
+  JsErrorCode error = bytecode != nullptr ?
+    JsParseSerializedScript(s_chakraShimSource, bytecode,
+                            JS_SOURCE_CONTEXT_NONE, L"chakra_shim.js",
+                            &getInitFunction) :
+    JsParseScript(s_chakraShimSource, JS_SOURCE_CONTEXT_NONE,
+                  L"chakra_shim.js", &getInitFunction);
+  if (error != JsNoError) {
     return false;
   }
   JsValueRef initFunction;
@@ -510,21 +554,46 @@ void ContextShim::SetAlignedPointerInEmbedderData(int index, void * value) {
   }
 }
 
+void ContextShim::EnqueueMicrotask(JsValueRef task) {
+  if (microtaskCount == microtaskQueue.size()) {
+    // Grow the ring, moving the oldest task back to the front
+    std::vector<JsValueRef> queue(
+      std::max<size_t>(microtaskQueue.size() * 2, 16));
+    for (size_t i = 0; i < microtaskCount; i++) {
+      queue[i] =
+        microtaskQueue[(microtaskHead + i) & (microtaskQueue.size() - 1)];
+    }
+    microtaskQueue.swap(queue);
+    microtaskHead = 0;
+    microtaskQueueStart = microtaskQueue.data();
+    microtaskQueueEnd = microtaskQueueStart + microtaskQueue.size();
+  }
+
+  microtaskQueue[(microtaskHead + microtaskCount) &
+                 (microtaskQueue.size() - 1)] = task;
+  microtaskCount++;
+}
+
 void ContextShim::RunMicrotasks() {
-  JsValueRef dequeueMicrotaskFunction = GetdequeueMicrotaskFunction();
+  if (microtaskCount == 0) {
+    return;
+  }
 
-  for (;;) {
-    JsValueRef task;
-    if (jsrt::CallFunction(dequeueMicrotaskFunction, &task) != JsNoError ||
-      reinterpret_cast<v8::Value*>(task)->IsUndefined()) {
-      break;
-    }
+  uint64_t start = uv_hrtime();
+  while (microtaskCount != 0) {
+    // Take the task off the queue first; running it may queue more tasks
+    JsValueRef task = microtaskQueue[microtaskHead];
+    microtaskQueue[microtaskHead] = JS_INVALID_REFERENCE;
+    microtaskHead = (microtaskHead + 1) & (microtaskQueue.size() - 1);
+    microtaskCount--;
 
     JsValueRef notUsed;
     if (jsrt::CallFunction(task, &notUsed) != JsNoError) {
       JsGetAndClearException(&notUsed);  // swallow any exception from task
     }
+    microtasksRun++;
   }
+  microtaskDrainTime += uv_hrtime() - start;
 }
 
 // check initialization state first instead of calling
@@ -595,20 +664,12 @@ return GetCachedShimFunction(CachedPropertyIdRef::F, \
                              &##F##Function); \
 } \
 
-CHAKRASHIM_FUNCTION_GETTER(cloneObject)
-CHAKRASHIM_FUNCTION_GETTER(getPropertyNames)
-CHAKRASHIM_FUNCTION_GETTER(getEnumerableNamedProperties)
-CHAKRASHIM_FUNCTION_GETTER(getEnumerableIndexedProperties)
 CHAKRASHIM_FUNCTION_GETTER(createEnumerationIterator)
 CHAKRASHIM_FUNCTION_GETTER(createPropertyDescriptorsEnumerationIterator)
-CHAKRASHIM_FUNCTION_GETTER(getNamedOwnKeys)
-CHAKRASHIM_FUNCTION_GETTER(getIndexedOwnKeys)
 CHAKRASHIM_FUNCTION_GETTER(getStackTrace)
 CHAKRASHIM_FUNCTION_GETTER(getSymbolKeyFor)
 CHAKRASHIM_FUNCTION_GETTER(getSymbolFor)
 CHAKRASHIM_FUNCTION_GETTER(ensureDebug)
-CHAKRASHIM_FUNCTION_GETTER(enqueueMicrotask);
-CHAKRASHIM_FUNCTION_GETTER(dequeueMicrotask);
 
 #define DEF_IS_TYPE(F) CHAKRASHIM_FUNCTION_GETTER(F)
 #include "jsrtcachedpropertyidref.inc"
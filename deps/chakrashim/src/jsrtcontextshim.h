@@ -79,7 +79,10 @@ class ContextShim {
 
   void * GetAlignedPointerFromEmbedderData(int index);
   void SetAlignedPointerInEmbedderData(int index, void * value);
+  void EnqueueMicrotask(JsValueRef task);
   void RunMicrotasks();
+  uint64_t GetMicrotasksRun() const { return microtasksRun; }
+  uint64_t GetMicrotaskDrainTime() const { return microtaskDrainTime; }
 
   static ContextShim * GetCurrent();
 
@@ -125,27 +128,32 @@ class ContextShim {
   JsValueRef promiseContinuationFunction;
   std::vector<void*> embedderData;
 
+  // Pending microtasks, oldest first, in a ring buffer whose size is a power
+  // of 2. The whole buffer is registered with the recycler as a root range,
+  // so queued tasks are kept alive without being ref-counted one by one.
+  // Slots are cleared as tasks are taken off the queue.
+  std::vector<JsValueRef> microtaskQueue;
+  JsValueRef * microtaskQueueStart;
+  JsValueRef * microtaskQueueEnd;
+  JsRootRangeHandle microtaskRootRange;
+  size_t microtaskHead;
+  size_t microtaskCount;
+  uint64_t microtasksRun;
+  uint64_t microtaskDrainTime;  // in nanoseconds
+
 #define DECLARE_CHAKRASHIM_FUNCTION_GETTER(F) \
  public: \
    JsValueRef Get##F##Function(); \
  private: \
    JsValueRef F##Function; \
 
-  DECLARE_CHAKRASHIM_FUNCTION_GETTER(cloneObject);
-  DECLARE_CHAKRASHIM_FUNCTION_GETTER(getPropertyNames);
-  DECLARE_CHAKRASHIM_FUNCTION_GETTER(getEnumerableNamedProperties);
-  DECLARE_CHAKRASHIM_FUNCTION_GETTER(getEnumerableIndexedProperties);
   DECLARE_CHAKRASHIM_FUNCTION_GETTER(createEnumerationIterator);
   DECLARE_CHAKRASHIM_FUNCTION_GETTER
   (createPropertyDescriptorsEnumerationIterator);
-  DECLARE_CHAKRASHIM_FUNCTION_GETTER(getNamedOwnKeys);
-  DECLARE_CHAKRASHIM_FUNCTION_GETTER(getIndexedOwnKeys);
   DECLARE_CHAKRASHIM_FUNCTION_GETTER(getStackTrace);
   DECLARE_CHAKRASHIM_FUNCTION_GETTER(getSymbolKeyFor);
   DECLARE_CHAKRASHIM_FUNCTION_GETTER(getSymbolFor);
   DECLARE_CHAKRASHIM_FUNCTION_GETTER(ensureDebug);
-  DECLARE_CHAKRASHIM_FUNCTION_GETTER(enqueueMicrotask);
-  DECLARE_CHAKRASHIM_FUNCTION_GETTER(dequeueMicrotask);
 
 #define DEF_IS_TYPE(F) DECLARE_CHAKRASHIM_FUNCTION_GETTER(F)
 #include "jsrtcachedpropertyidref.inc"
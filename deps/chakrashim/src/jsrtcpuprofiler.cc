@@ -0,0 +1,249 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "v8chakra.h"
+#include <algorithm>
+#include <iterator>
+
+namespace jsrt {
+
+static int64_t MicrosecondsNow() {
+  return static_cast<int64_t>(uv_hrtime() / 1000);
+}
+
+CpuProfileShim::CpuProfileShim(const std::wstring& title, bool recordSamples)
+    : title(title),
+      recordSamples(recordSamples),
+      idleNode(nullptr),
+      startTime(MicrosecondsNow()),
+      endTime(0) {
+  Node root = {};
+  root.functionName = L"(root)";
+  root.id = 1;
+  nodes.push_back(root);
+}
+
+CpuProfileShim::Node * CpuProfileShim::GetChild(
+    Node * parent, const void * functionKey, const wchar_t * functionName,
+    const wchar_t * sourceName, int lineNumber, int columnNumber) {
+  for (Node * child : parent->children) {
+    if (child->functionKey == functionKey) {
+      return child;
+    }
+  }
+
+  // Names are copied once per call tree node; the engine's strings are only
+  // valid during the sample callback.
+  Node node = {};
+  node.functionKey = functionKey;
+  node.functionName = functionName != nullptr ? functionName : L"";
+  node.sourceName = sourceName != nullptr ? sourceName : L"";
+  node.lineNumber = lineNumber;
+  node.columnNumber = columnNumber;
+  node.id = static_cast<unsigned>(nodes.size()) + 1;
+  nodes.push_back(node);
+  parent->children.push_back(&nodes.back());
+  return &nodes.back();
+}
+
+void CpuProfileShim::Hit(Node * node, int64_t timestamp) {
+  node->hitCount++;
+  if (recordSamples) {
+    samples.push_back(node);
+    timestamps.push_back(timestamp);
+  }
+}
+
+void CpuProfileShim::AddSample(const JsStackSampleFrame * frames,
+                               unsigned short frameCount, int64_t timestamp) {
+  Node * node = &nodes.front();
+  for (int i = frameCount - 1; i >= 0; i--) {
+    const JsStackSampleFrame& frame = frames[i];
+    // v8 reports one-based positions
+    node = GetChild(node, frame.functionKey, frame.functionName,
+                    frame.sourceName, static_cast<int>(frame.line) + 1,
+                    static_cast<int>(frame.column) + 1);
+  }
+  Hit(node, timestamp);
+}
+
+void CpuProfileShim::AddIdleTicks(unsigned count, int64_t timestamp) {
+  if (idleNode == nullptr) {
+    idleNode = GetChild(&nodes.front(), &idleNode, L"(idle)", nullptr,
+                        v8::CpuProfileNode::kNoLineNumberInfo,
+                        v8::CpuProfileNode::kNoColumnNumberInfo);
+  }
+  for (unsigned i = 0; i < count; i++) {
+    Hit(idleNode, timestamp);
+  }
+}
+
+CpuProfilerShim::CpuProfilerShim(JsRuntimeHandle runtime)
+    : runtime(runtime),
+      samplingIntervalUs(1000),
+      isSampling(false),
+      stopSampler(false),
+      isIdle(false),
+      idleTicks(0) {
+  CHAKRA_VERIFY(uv_mutex_init(&mutex) == 0);
+  CHAKRA_VERIFY(uv_cond_init(&cond) == 0);
+}
+
+CpuProfilerShim::~CpuProfilerShim() {
+  StopSampler();
+  for (CpuProfileShim * profile : profiles) {
+    delete profile;
+  }
+  uv_cond_destroy(&cond);
+  uv_mutex_destroy(&mutex);
+}
+
+void CpuProfilerShim::SetSamplingInterval(int us) {
+  // Like v8, only takes effect for the next sampler started
+  if (us > 0) {
+    samplingIntervalUs = us;
+  }
+}
+
+bool CpuProfilerShim::StartProfiling(const std::wstring& title,
+                                     bool recordSamples) {
+  for (CpuProfileShim * profile : profiles) {
+    if (profile->GetTitle() == title) {
+      return true;
+    }
+  }
+
+  if (!isSampling && !StartSampler()) {
+    return false;
+  }
+
+  FlushIdleTicks();
+  profiles.push_back(new CpuProfileShim(title, recordSamples));
+  return true;
+}
+
+CpuProfileShim * CpuProfilerShim::StopProfiling(const std::wstring& title) {
+  FlushIdleTicks();
+
+  // An empty title stops the most recently started profile
+  auto it = std::find_if(profiles.rbegin(), profiles.rend(),
+                         [&](CpuProfileShim * profile) {
+    return title.empty() || profile->GetTitle() == title;
+  });
+  if (it == profiles.rend()) {
+    return nullptr;
+  }
+
+  CpuProfileShim * profile = *it;
+  profiles.erase(std::next(it).base());
+  profile->Finish(MicrosecondsNow());
+
+  if (profiles.empty()) {
+    StopSampler();
+  }
+  return profile;
+}
+
+void CpuProfilerShim::SetIdle(bool isIdle) {
+  uv_mutex_lock(&mutex);
+  this->isIdle = isIdle;
+  uv_mutex_unlock(&mutex);
+}
+
+void CpuProfilerShim::FlushIdleTicks() {
+  uv_mutex_lock(&mutex);
+  unsigned count = idleTicks;
+  idleTicks = 0;
+  uv_mutex_unlock(&mutex);
+
+  if (count != 0) {
+    int64_t timestamp = MicrosecondsNow();
+    for (CpuProfileShim * profile : profiles) {
+      profile->AddIdleTicks(count, timestamp);
+    }
+  }
+}
+
+bool CpuProfilerShim::StartSampler() {
+  if (JsSetStackSampleCallback(runtime, this, StackSampleCallback,
+                               MaxFrameCount) != JsNoError) {
+    return false;
+  }
+
+  stopSampler = false;
+  if (uv_thread_create(&samplerThread, SamplerThreadProc, this) != 0) {
+    JsSetStackSampleCallback(runtime, nullptr, nullptr, 0);
+    return false;
+  }
+
+  isSampling = true;
+  return true;
+}
+
+void CpuProfilerShim::StopSampler() {
+  if (!isSampling) {
+    return;
+  }
+
+  uv_mutex_lock(&mutex);
+  stopSampler = true;
+  uv_cond_signal(&cond);
+  uv_mutex_unlock(&mutex);
+  uv_thread_join(&samplerThread);
+
+  // No more requests can come in, so the callback can go
+  JsSetStackSampleCallback(runtime, nullptr, nullptr, 0);
+  isSampling = false;
+}
+
+void CpuProfilerShim::SamplerThreadProc(void * arg) {
+  CpuProfilerShim * profiler = static_cast<CpuProfilerShim *>(arg);
+  uint64_t timeout = static_cast<uint64_t>(profiler->samplingIntervalUs) * 1000;
+
+  uv_mutex_lock(&profiler->mutex);
+  while (!profiler->stopSampler) {
+    if (uv_cond_timedwait(&profiler->cond, &profiler->mutex,
+                          timeout) != UV_ETIMEDOUT) {
+      continue;
+    }
+
+    if (profiler->isIdle) {
+      profiler->idleTicks++;
+    } else {
+      JsRequestStackSample(profiler->runtime);
+    }
+  }
+  uv_mutex_unlock(&profiler->mutex);
+}
+
+void CHAKRA_CALLBACK CpuProfilerShim::StackSampleCallback(
+    const JsStackSampleFrame * frames, unsigned short frameCount,
+    void * callbackState) {
+  // Runs on the script thread in the middle of script; no engine calls here
+  CpuProfilerShim * profiler = static_cast<CpuProfilerShim *>(callbackState);
+  profiler->FlushIdleTicks();
+
+  int64_t timestamp = MicrosecondsNow();
+  for (CpuProfileShim * profile : profiler->profiles) {
+    profile->AddSample(frames, frameCount, timestamp);
+  }
+}
+
+}  // namespace jsrt
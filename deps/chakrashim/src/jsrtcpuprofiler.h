@@ -0,0 +1,117 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#pragma once
+
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace jsrt {
+
+// A profile being recorded, then handed out as a v8::CpuProfile. Nodes live in
+// a deque so the v8::CpuProfileNode pointers given out stay valid as the tree
+// grows.
+class CpuProfileShim {
+ public:
+  struct Node {
+    const void * functionKey;
+    std::wstring functionName;
+    std::wstring sourceName;
+    int lineNumber;
+    int columnNumber;
+    unsigned hitCount;
+    unsigned id;
+    std::vector<Node *> children;
+  };
+
+  CpuProfileShim(const std::wstring& title, bool recordSamples);
+
+  const std::wstring& GetTitle() const { return title; }
+  const Node * GetRoot() const { return &nodes.front(); }
+  const std::vector<const Node *>& GetSamples() const { return samples; }
+  const std::vector<int64_t>& GetTimestamps() const { return timestamps; }
+  int64_t GetStartTime() const { return startTime; }
+  int64_t GetEndTime() const { return endTime; }
+
+  // Frames are innermost first, as the engine reports them
+  void AddSample(const JsStackSampleFrame * frames, unsigned short frameCount,
+                 int64_t timestamp);
+  void AddIdleTicks(unsigned count, int64_t timestamp);
+  void Finish(int64_t timestamp) { endTime = timestamp; }
+
+ private:
+  Node * GetChild(Node * parent, const void * functionKey,
+                  const wchar_t * functionName, const wchar_t * sourceName,
+                  int lineNumber, int columnNumber);
+  void Hit(Node * node, int64_t timestamp);
+
+  std::wstring title;
+  bool recordSamples;
+  std::deque<Node> nodes;
+  Node * idleNode;
+  std::vector<const Node *> samples;
+  std::vector<int64_t> timestamps;
+  int64_t startTime;
+  int64_t endTime;
+};
+
+// Backs v8::CpuProfiler for an isolate. A sampler thread asks the engine for
+// a stack sample every interval; the engine takes it on the script thread, at
+// the next probe, so samples are aggregated without any locking against the
+// profiles. Ticks that fall while the embedder reports the isolate idle are
+// counted under an "(idle)" node instead.
+class CpuProfilerShim {
+ public:
+  explicit CpuProfilerShim(JsRuntimeHandle runtime);
+  ~CpuProfilerShim();
+
+  void SetSamplingInterval(int us);
+  bool StartProfiling(const std::wstring& title, bool recordSamples);
+  CpuProfileShim * StopProfiling(const std::wstring& title);
+  void SetIdle(bool isIdle);
+
+ private:
+  static const unsigned short MaxFrameCount = 128;
+
+  static void CHAKRA_CALLBACK StackSampleCallback(
+    const JsStackSampleFrame * frames, unsigned short frameCount,
+    void * callbackState);
+  static void SamplerThreadProc(void * arg);
+
+  bool StartSampler();
+  void StopSampler();
+  void FlushIdleTicks();
+
+  JsRuntimeHandle runtime;
+  std::vector<CpuProfileShim *> profiles;
+  int samplingIntervalUs;
+
+  uv_mutex_t mutex;
+  uv_cond_t cond;
+  uv_thread_t samplerThread;
+  bool isSampling;
+  // Guarded by mutex, shared with the sampler thread
+  bool stopSampler;
+  bool isIdle;
+  unsigned idleTicks;
+};
+
+}  // namespace jsrt
@@ -0,0 +1,120 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "jsrtutils.h"
+#include <new>
+
+namespace jsrt {
+
+HandleSlab::HandleSlab(JsRuntimeHandle runtime)
+    : runtime(runtime),
+      first(nullptr),
+      current(nullptr) {
+}
+
+HandleSlab::~HandleSlab() {
+  // Nothing to do here, IsolateShim::Dispose already released the chunks
+  assert(first == nullptr);
+}
+
+void HandleSlab::Dispose() {
+  Chunk * chunk = first;
+  while (chunk != nullptr) {
+    Chunk * next = chunk->next;
+    FreeChunk(chunk);
+    chunk = next;
+  }
+  first = nullptr;
+  current = nullptr;
+}
+
+HandleSlab::Chunk * HandleSlab::NewChunk() {
+  Chunk * chunk = new (std::nothrow) Chunk;
+  if (chunk == nullptr) {
+    return nullptr;
+  }
+
+  chunk->start = chunk->slots;
+  chunk->top = chunk->slots;
+  chunk->next = nullptr;
+  if (JsAddRootRange(runtime, &chunk->start, &chunk->top,
+                     &chunk->rootRange) != JsNoError) {
+    delete chunk;
+    return nullptr;
+  }
+  return chunk;
+}
+
+void HandleSlab::FreeChunk(Chunk * chunk) {
+  JsErrorCode errorCode = JsRemoveRootRange(runtime, chunk->rootRange);
+  CHAKRA_ASSERT(errorCode == JsNoError);
+  delete chunk;
+}
+
+JsValueRef * HandleSlab::AllocateSlow() {
+  // Chunks after the current one are always empty, so move on to the next one
+  // if we already have it, or grow the list.
+  Chunk * next = current != nullptr ? current->next : first;
+  if (next == nullptr) {
+    next = NewChunk();
+    if (next == nullptr) {
+      return nullptr;
+    }
+    if (current != nullptr) {
+      current->next = next;
+    } else {
+      first = next;
+    }
+  }
+
+  current = next;
+  return current->top++;
+}
+
+void HandleSlab::Reset(const Mark& mark) {
+  Chunk * chunk = mark.chunk;
+  if (chunk == nullptr) {
+    // The scope was entered before the first chunk was allocated
+    chunk = first;
+    if (chunk == nullptr) {
+      return;
+    }
+    chunk->top = chunk->start;
+  } else {
+    chunk->top = mark.top;
+  }
+
+  if (chunk != current) {
+    // Empty the chunks the scope spilled into. Keep one of them around for the
+    // next scope and give the rest back, so one deep scope doesn't pin memory.
+    Chunk * spare = chunk->next;
+    spare->top = spare->start;
+    Chunk * extra = spare->next;
+    spare->next = nullptr;
+    while (extra != nullptr) {
+      Chunk * next = extra->next;
+      FreeChunk(extra);
+      extra = next;
+    }
+  }
+  current = chunk;
+}
+
+}  // namespace jsrt
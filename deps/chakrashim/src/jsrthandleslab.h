@@ -0,0 +1,82 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#pragma once
+
+namespace jsrt {
+
+// Backing store for v8::HandleScope locals. Slots are handed out from
+// fixed-size chunks whose used part is registered with the recycler as a root
+// range, so adding a local is a pointer bump and leaving a scope just moves
+// the top back. Chunks are registered once and reused by later scopes.
+class HandleSlab {
+ public:
+  class Chunk;
+
+  // Position saved by a HandleScope on entry and restored on exit
+  struct Mark {
+    Chunk * chunk;
+    JsValueRef * top;
+  };
+
+  explicit HandleSlab(JsRuntimeHandle runtime);
+  ~HandleSlab();
+
+  JsValueRef * Allocate();
+  Mark GetMark() const;
+  void Reset(const Mark& mark);
+
+  // Unregisters and frees all chunks. Must run before the runtime goes away.
+  void Dispose();
+
+ private:
+  JsValueRef * AllocateSlow();
+  Chunk * NewChunk();
+  void FreeChunk(Chunk * chunk);
+
+  JsRuntimeHandle runtime;
+  Chunk * first;
+  Chunk * current;
+};
+
+class HandleSlab::Chunk {
+ public:
+  static const size_t kSlotCount = 1000;
+
+  JsValueRef * start;
+  JsValueRef * top;
+  Chunk * next;
+  JsRootRangeHandle rootRange;
+  JsValueRef slots[kSlotCount];
+};
+
+inline JsValueRef * HandleSlab::Allocate() {
+  if (current != nullptr && current->top < current->slots + Chunk::kSlotCount) {
+    return current->top++;
+  }
+  return AllocateSlow();
+}
+
+inline HandleSlab::Mark HandleSlab::GetMark() const {
+  Mark mark = { current, current != nullptr ? current->top : nullptr };
+  return mark;
+}
+
+}  // namespace jsrt
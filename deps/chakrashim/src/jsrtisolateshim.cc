@@ -27,14 +27,39 @@
 
 namespace v8 {
 extern bool g_disableIdleGc;
+extern bool g_parallelParse;
 }
 namespace jsrt {
 
 /* static */ __declspec(thread) IsolateShim * IsolateShim::s_currentIsolate;
 /* static */ __declspec(thread) IsolateShim * IsolateShim::s_previousIsolate;
 /* static */ IsolateShim * IsolateShim::s_isolateList = nullptr;
+/* static */ bool IsolateShim::s_idleGcTaken = false;
 
-IsolateShim::IsolateShim(JsRuntimeHandle runtime)
+// Isolates can be created and disposed on any thread, so the list of isolates
+// and the idle GC ownership are only touched under this lock.
+static uv_once_t s_isolateListOnce = UV_ONCE_INIT;
+static uv_mutex_t s_isolateListMutex;
+// The thread of the first isolate, which is the one running the default loop
+static uv_thread_t s_defaultLoopThread;
+static bool s_defaultLoopThreadKnown = false;
+
+static void InitializeIsolateListMutex() {
+  CHAKRA_VERIFY(uv_mutex_init(&s_isolateListMutex) == 0);
+}
+
+class IsolateListLock {
+ public:
+  IsolateListLock() {
+    uv_once(&s_isolateListOnce, InitializeIsolateListMutex);
+    uv_mutex_lock(&s_isolateListMutex);
+  }
+  ~IsolateListLock() {
+    uv_mutex_unlock(&s_isolateListMutex);
+  }
+};
+
+IsolateShim::IsolateShim(JsRuntimeHandle runtime, bool idleGcEnabled)
     : runtime(runtime),
       contextScopeStack(nullptr),
       symbolPropertyIdRefs(),
@@ -42,11 +67,18 @@ IsolateShim::IsolateShim(JsRuntimeHandle runtime)
       embeddedData(),
       isDisposing(false),
       tryCatchStackTop(nullptr),
+      handleSlab(runtime),
+      weakReferenceTable(runtime),
+      cpuProfiler(nullptr),
       g_arrayBufferAllocator(nullptr),
-      debugContext(nullptr) {
-  // CHAKRA-TODO: multithread locking for s_isolateList?
+      debugContext(nullptr),
+      idleGcEnabled(idleGcEnabled) {
+  IsolateListLock lock;
   this->prevnext = &s_isolateList;
   this->next = s_isolateList;
+  if (this->next) {
+    this->next->prevnext = &this->next;
+  }
   s_isolateList = this;
 }
 
@@ -56,39 +88,66 @@ IsolateShim::~IsolateShim() {
   assert(this->next == nullptr);
   assert(this->prevnext == nullptr);
 
-  if (IsolateShim::IsIdleGcEnabled()) {
+  if (IsIdleGcEnabled()) {
     uv_close(reinterpret_cast<uv_handle_t*>(idleGc_prepare_handle()), nullptr);
     uv_close(reinterpret_cast<uv_handle_t*>(idleGc_timer_handle()), nullptr);
   }
 }
 
 /* static */ v8::Isolate * IsolateShim::New() {
-  // CHAKRA-TODO: Disable multiple isolate for now until it is fully implemented
-  /*
-  if (s_isolateList != nullptr) {
-    CHAKRA_UNIMPLEMENTED_("multiple isolate");
-    return nullptr;
+  // Each isolate gets its own runtime, bound to the thread creating it. The
+  // idle GC handles live on the default loop, which only the thread of the
+  // first isolate runs, so one isolate on that thread at a time gets them.
+  // Isolates on other threads collect on allocation only, even when that
+  // isolate is gone.
+  bool disableIdleGc;
+  {
+    IsolateListLock lock;
+    // The value layout is fixed for the engine build, but no value can exist
+    // before an isolate does, so reading it here is early enough.
+    if (s_isolateList == nullptr &&
+        JsGetValueLayout(&v8::chakrashim::g_valueLayout) != JsNoError) {
+      return nullptr;
+    }
+
+    uv_thread_t self = uv_thread_self();
+    if (!s_defaultLoopThreadKnown) {
+      s_defaultLoopThread = self;
+      s_defaultLoopThreadKnown = true;
+    }
+
+    disableIdleGc = v8::g_disableIdleGc || s_idleGcTaken ||
+                    !uv_thread_equal(&s_defaultLoopThread, &self);
+    if (!disableIdleGc) {
+      s_idleGcTaken = true;
+    }
   }
-  */
-  bool disableIdleGc = v8::g_disableIdleGc;
+
   JsRuntimeHandle runtime;
   JsErrorCode error =
     JsCreateRuntime(static_cast<JsRuntimeAttributes>(
       JsRuntimeAttributeAllowScriptInterrupt |
       JsRuntimeAttributeEnableExperimentalFeatures |
       (disableIdleGc ? JsRuntimeAttributeNone :
-       JsRuntimeAttributeEnableIdleProcessing)), nullptr, &runtime);
+       JsRuntimeAttributeEnableIdleProcessing) |
+      (v8::g_parallelParse ? JsRuntimeAttributeEnableParallelParse :
+       JsRuntimeAttributeNone)), nullptr, &runtime);
   if (error != JsNoError) {
+    if (!disableIdleGc) {
+      IsolateListLock lock;
+      s_idleGcTaken = false;
+    }
     return nullptr;
   }
-  
+
   if (v8::Debug::IsDebugExposed()) {
     // If JavaScript debugging APIs need to be exposed then
     // runtime should be in debugging mode from start
     v8::Debug::StartDebugging(runtime);
   }
 
-  IsolateShim* newIsolateshim = new IsolateShim(runtime);
+  IsolateShim* newIsolateshim = new IsolateShim(runtime, !disableIdleGc);
+  CHAKRA_VERIFY(newIsolateshim->weakReferenceTable.Initialize());
   if (!disableIdleGc) {
     uv_prepare_init(uv_default_loop(), newIsolateshim->idleGc_prepare_handle());
     uv_unref(reinterpret_cast<uv_handle_t*>(newIsolateshim->idleGc_prepare_handle()));
@@ -117,16 +176,14 @@ IsolateShim::~IsolateShim() {
 }
 
 void IsolateShim::Enter() {
-  // CHAKRA-TODO: we don't support multiple isolate currently, this also doesn't
-  // support reentrence
+  // The current isolate is per thread. CHAKRA-TODO: this doesn't support
+  // entering a second isolate on the same thread.
   assert(s_currentIsolate == nullptr || s_currentIsolate == this);
   s_previousIsolate = s_currentIsolate;
   s_currentIsolate = this;
 }
 
 void IsolateShim::Exit() {
-  // CHAKRA-TODO: we don't support multiple isolate currently, this also doesn't
-  // support reentrence
   assert(s_currentIsolate == this);
   s_currentIsolate = s_previousIsolate;
   s_previousIsolate = nullptr;
@@ -142,6 +199,11 @@ bool IsolateShim::Dispose() {
     // Disposing the runtime may cause finalize call back to run
     // Set the current IsolateShim scope
     v8::Isolate::Scope scope(ToIsolate(this));
+    // Stops the sampler thread before the runtime it samples goes away
+    delete cpuProfiler;
+    cpuProfiler = nullptr;
+    weakReferenceTable.Dispose();
+    handleSlab.Dispose();
     if (JsDisposeRuntime(runtime) != JsNoError) {
       // Can't do much at this point. Assert that this doesn't happen in debug
       CHAKRA_ASSERT(false);
@@ -149,11 +211,18 @@ bool IsolateShim::Dispose() {
     }
   }
 
-  // CHAKRA-TODO: multithread locking for s_isolateList?
-  if (this->next) {
-    this->next->prevnext = this->prevnext;
+  {
+    IsolateListLock lock;
+    if (this->prevnext) {
+      if (this->next) {
+        this->next->prevnext = this->prevnext;
+      }
+      *this->prevnext = this->next;
+    }
+    if (IsIdleGcEnabled()) {
+      s_idleGcTaken = false;
+    }
   }
-  *this->prevnext = this->next;
 
   runtime = JS_INVALID_REFERENCE;
   this->next = nullptr;
@@ -214,12 +283,22 @@ bool IsolateShim::GetMemoryUsage(size_t * memoryUsage) {
 }
 
 void IsolateShim::DisposeAll() {
-  // CHAKRA-TODO: multithread locking for s_isolateList?
-  IsolateShim * curr = s_isolateList;
-  s_isolateList = nullptr;
+  // Runtimes can only be disposed on their own thread, so isolates running on
+  // other threads must have been disposed there before this is called.
+  IsolateShim * curr;
+  {
+    IsolateListLock lock;
+    curr = s_isolateList;
+    s_isolateList = nullptr;
+    for (IsolateShim * i = curr; i; i = i->next) {
+      i->prevnext = nullptr;
+    }
+  }
   while (curr) {
+    IsolateShim * next = curr->next;
+    curr->next = nullptr;
     curr->Dispose();
-    curr = curr->next;
+    curr = next;
   }
 }
 
@@ -234,9 +313,14 @@ void IsolateShim::PushScope(
   scope->previous = this->contextScopeStack;
   this->contextScopeStack = scope;
 
-  // Don't crash even if we fail to set the context
-  JsErrorCode errorCode = JsSetCurrentContext(contextShim->GetContextRef());
-  CHAKRA_ASSERT(errorCode == JsNoError);
+  // Native callbacks mostly run in the context that called them, which is
+  // already current then
+  if (scope->previous == nullptr ||
+      scope->previous->contextShim != contextShim) {
+    // Don't crash even if we fail to set the context
+    JsErrorCode errorCode = JsSetCurrentContext(contextShim->GetContextRef());
+    CHAKRA_ASSERT(errorCode == JsNoError);
+  }
 
   contextShim->EnsureInitialized();
 }
@@ -245,10 +329,14 @@ void IsolateShim::PopScope(ContextShim::Scope * scope) {
   assert(this->contextScopeStack == scope);
   ContextShim::Scope * prevScope = scope->previous;
   if (prevScope != nullptr) {
+    if (scope->contextShim == prevScope->contextShim) {
+      this->contextScopeStack = prevScope;
+      return;
+    }
+
     JsValueRef exception = JS_INVALID_REFERENCE;
     bool hasException;
-    if (scope->contextShim != prevScope->contextShim &&
-        JsHasException(&hasException) == JsNoError &&
+    if (JsHasException(&hasException) == JsNoError &&
         hasException &&
         JsGetAndClearException(&exception) == JsNoError) {
     }
@@ -353,6 +441,13 @@ bool IsolateShim::IsExeuctionDisabled() {
   return false;
 }
 
+CpuProfilerShim * IsolateShim::GetCpuProfiler() {
+  if (cpuProfiler == nullptr) {
+    cpuProfiler = new CpuProfilerShim(runtime);
+  }
+  return cpuProfiler;
+}
+
 bool IsolateShim::AddMessageListener(void * that) {
   try {
     messageListeners.push_back(that);
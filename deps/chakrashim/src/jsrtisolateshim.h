@@ -71,6 +71,14 @@ class IsolateShim {
 
   ContextShim * GetCurrentContextShim();
 
+  inline HandleSlab * GetHandleSlab() {
+    return &handleSlab;
+  }
+
+  inline WeakReferenceTable * GetWeakReferenceTable() {
+    return &weakReferenceTable;
+  }
+
   // Symbols propertyIdRef
   JsPropertyIdRef GetSelfSymbolPropertyIdRef();
   JsPropertyIdRef GetKeepAliveObjectSymbolPropertyIdRef();
@@ -85,10 +93,12 @@ class IsolateShim {
   void DisableExecution();
   bool IsExeuctionDisabled();
   void EnableExecution();
-  static inline bool IsIdleGcEnabled() {
-    return !v8::g_disableIdleGc;
+  inline bool IsIdleGcEnabled() {
+    return idleGcEnabled;
   }
 
+  CpuProfilerShim * GetCpuProfiler();
+
   bool AddMessageListener(void * that);
   void RemoveMessageListeners(void * that);
   template <typename Fn>
@@ -136,7 +146,7 @@ class IsolateShim {
 
  private:
   // Construction/Destruction should go thru New/Dispose
-  explicit IsolateShim(JsRuntimeHandle runtime);
+  IsolateShim(JsRuntimeHandle runtime, bool idleGcEnabled);
   ~IsolateShim();
   static v8::Isolate * ToIsolate(IsolateShim * isolate);
   static void CALLBACK JsContextBeforeCollectCallback(JsRef contextRef,
@@ -156,11 +166,16 @@ class IsolateShim {
 
   std::vector<void *> messageListeners;
 
+  HandleSlab handleSlab;
+  WeakReferenceTable weakReferenceTable;
+  CpuProfilerShim * cpuProfiler;
+
   // Node only has 4 slots (internals::Internals::kNumIsolateDataSlots = 4)
   void * embeddedData[4];
 
-  // CHAKRA-TODO: support multiple shims
   static IsolateShim * s_isolateList;
+  // Whether a live isolate runs idle GC on the default loop
+  static bool s_idleGcTaken;
 
   static __declspec(thread) IsolateShim * s_currentIsolate;
   static __declspec(thread) IsolateShim * s_previousIsolate;
@@ -169,5 +184,6 @@ class IsolateShim {
   uv_timer_t idleGc_timer_handle_;
   bool jsScriptExecuted = false;
   bool isIdleGcScheduled = false;
+  bool idleGcEnabled;
 };
 }  // namespace jsrt
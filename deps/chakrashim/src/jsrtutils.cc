@@ -246,19 +246,78 @@ bool InstanceOf(JsValueRef first,
   return JsInstanceOf(first, second, &result) == JsNoError && result;
 }
 
+static JsErrorCode CloneProperty(JsValueRef source,
+                                 JsValueRef target,
+                                 JsValueRef name) {
+  JsPropertyIdRef idRef;
+  JsErrorCode error = GetPropertyIdFromName(name, &idRef);
+  if (error != JsNoError) {
+    return error;
+  }
+
+  JsValueRef descriptor;
+  error = JsGetOwnPropertyDescriptor(source, idRef, &descriptor);
+  if (error != JsNoError) {
+    return error;
+  }
+
+  // A property that refers back to the source refers to the clone instead
+  JsPropertyIdRef valueIdRef =
+    IsolateShim::GetCurrent()->GetCachedPropertyIdRef(
+      CachedPropertyIdRef::value);
+  JsValueRef value;
+  error = JsGetProperty(descriptor, valueIdRef, &value);
+  if (error != JsNoError) {
+    return error;
+  }
+  if (value == source) {
+    error = JsSetProperty(descriptor, valueIdRef, target, false);
+    if (error != JsNoError) {
+      return error;
+    }
+  }
+
+  bool result;
+  return JsDefineProperty(target, idRef, descriptor, &result);
+}
+
 JsErrorCode CloneObject(JsValueRef source,
                         JsValueRef target,
                         bool clonePrototype) {
-  JsValueRef cloneObjectFunction =
-    ContextShim::GetCurrent()->GetcloneObjectFunction();
+  JsValueRef names;
+  JsErrorCode error = JsGetFilteredPropertyNames(
+    source,
+    static_cast<JsPropertyNameFlags>(JsPropertyNameOwnOnly |
+                                     JsPropertyNameIncludeNonEnumerable),
+    &names);
+  if (error != JsNoError) {
+    return error;
+  }
 
-  JsValueRef resultRef;
-  JsErrorCode error = CallFunction(cloneObjectFunction,
-                                   source, target, &resultRef);
+  unsigned int length;
+  error = GetArrayLength(names, &length);
   if (error != JsNoError) {
     return error;
   }
 
+  for (unsigned int i = 0; i < length; i++) {
+    JsValueRef name;
+    error = GetIndexedProperty(names, i, &name);
+    if (error != JsNoError) {
+      return error;
+    }
+
+    error = CloneProperty(source, target, name);
+    if (error == JsErrorScriptException) {
+      // Skip properties that can't be copied, e.g. onto a sealed target
+      JsValueRef exception;
+      error = JsGetAndClearException(&exception);
+    }
+    if (error != JsNoError) {
+      return error;
+    }
+  }
+
   if (clonePrototype) {
     JsValueRef prototypeRef;
     JsErrorCode error = JsGetPrototype(source, &prototypeRef);
@@ -398,30 +457,31 @@ JsErrorCode IsUndefined(JsValueRef value,
 
 JsErrorCode GetEnumerableNamedProperties(JsValueRef object,
                                          JsValueRef *result) {
-  return CallFunction(
-    ContextShim::GetCurrent()->GetgetEnumerableNamedPropertiesFunction(),
-    object, result);
+  return JsGetFilteredPropertyNames(object, JsPropertyNameSkipIndices, result);
 }
 
 JsErrorCode GetEnumerableIndexedProperties(JsValueRef object,
                                            JsValueRef *result) {
-  return CallFunction(
-    ContextShim::GetCurrent()->GetgetEnumerableIndexedPropertiesFunction(),
-    object, result);
+  return JsGetFilteredPropertyNames(object, JsPropertyNameSkipNonIndices,
+                                    result);
 }
 
 JsErrorCode GetIndexedOwnKeys(JsValueRef object,
                               JsValueRef *result) {
-  return CallFunction(
-    ContextShim::GetCurrent()->GetgetIndexedOwnKeysFunction(),
-    object, result);
+  return JsGetFilteredPropertyNames(
+    object,
+    static_cast<JsPropertyNameFlags>(JsPropertyNameOwnOnly |
+                                     JsPropertyNameSkipNonIndices),
+    result);
 }
 
 JsErrorCode GetNamedOwnKeys(JsValueRef object,
                             JsValueRef *result) {
-  return CallFunction(
-    ContextShim::GetCurrent()->GetgetNamedOwnKeysFunction(),
-    object, result);
+  return JsGetFilteredPropertyNames(
+    object,
+    static_cast<JsPropertyNameFlags>(JsPropertyNameOwnOnly |
+                                     JsPropertyNameSkipIndices),
+    result);
 }
 
 JsErrorCode ConcatArray(JsValueRef first,
@@ -451,9 +511,7 @@ JsErrorCode CreatePropertyDescriptorsEnumerationIterator(JsValueRef enumeration,
 
 JsErrorCode GetPropertyNames(JsValueRef object,
                              JsValueRef *result) {
-  return CallFunction(
-    ContextShim::GetCurrent()->GetgetPropertyNamesFunction(),
-    object, result);
+  return JsGetFilteredPropertyNames(object, JsPropertyNameDefault, result);
 }
 
 JsErrorCode AddExternalData(JsValueRef ref,
@@ -705,24 +763,10 @@ JsErrorCode DefineProperty(JsValueRef object,
 
 JsErrorCode GetPropertyIdFromName(JsValueRef nameRef,
                                   JsPropertyIdRef *idRef) {
-  JsErrorCode error;
-  const wchar_t *propertyName;
-  size_t propertyNameSize;
-
-  // Expect the name be either a String or a Symbol.
-  error = JsStringToPointer(nameRef, &propertyName, &propertyNameSize);
-  if (error != JsNoError) {
-    if (error == JsErrorInvalidArgument) {
-      error = JsGetPropertyIdFromSymbol(nameRef, idRef);
-      if (error == JsErrorPropertyNotSymbol) {
-        error = JsErrorInvalidArgument;  // Neither String nor Symbol
-      }
-    }
-  } else {
-    error = JsGetPropertyIdFromName(propertyName, idRef);
-  }
-
-  return error;
+  // Expect the name be either a String or a Symbol. Internalized strings and
+  // symbols (so v8::Private keys) carry their property ID, the other strings
+  // are hashed.
+  return JsGetPropertyIdFromKey(nameRef, idRef);
 }
 
 JsErrorCode GetPropertyIdFromValue(JsValueRef valueRef,
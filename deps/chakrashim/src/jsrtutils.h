@@ -24,6 +24,9 @@
 #include "uv.h"
 #include "jsrtproxyutils.h"
 #include "jsrtcontextshim.h"
+#include "jsrthandleslab.h"
+#include "jsrtweakreferencetable.h"
+#include "jsrtcpuprofiler.h"
 #include "jsrtisolateshim.h"
 
 #include "stdint.h"
@@ -0,0 +1,225 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "v8chakra.h"
+#include <new>
+
+namespace jsrt {
+
+WeakReferenceTable::WeakReferenceTable(JsRuntimeHandle runtime)
+    : runtime(runtime),
+      first(nullptr),
+      current(nullptr),
+      freeList(nullptr),
+      armedCount(0),
+      statistics() {
+}
+
+WeakReferenceTable::~WeakReferenceTable() {
+  Chunk * chunk = first;
+  while (chunk != nullptr) {
+    Chunk * next = chunk->next;
+    delete chunk;
+    chunk = next;
+  }
+}
+
+bool WeakReferenceTable::Initialize() {
+  return JsSetWeakRootsClearedCallback(runtime, this,
+                                       WeakRootsClearedCallback) == JsNoError;
+}
+
+void WeakReferenceTable::Dispose() {
+  JsSetWeakRootsClearedCallback(runtime, nullptr, nullptr);
+
+  for (Chunk * chunk = first; chunk != nullptr; chunk = chunk->next) {
+    size_t count = chunk->top - chunk->start;
+    for (size_t i = 0; i < count; i++) {
+      Entry * entry = &chunk->entries[i];
+      if (entry->refCount != 0 && chunk->objects[i] != JS_INVALID_REFERENCE) {
+        // Same as a runtime going away with per-object callbacks: everything
+        // still weakly held is about to be released, so say so.
+        v8::Utils::WeakReferenceCallbackWrapperCallback(chunk->objects[i],
+                                                        entry);
+      }
+    }
+
+    JsErrorCode errorCode = JsRemoveWeakRootRange(runtime,
+                                                  chunk->weakRootRange);
+    CHAKRA_ASSERT(errorCode == JsNoError);
+  }
+}
+
+WeakReferenceTable::Chunk * WeakReferenceTable::NewChunk() {
+  Chunk * chunk = new (std::nothrow) Chunk;
+  if (chunk == nullptr) {
+    return nullptr;
+  }
+
+  chunk->start = chunk->objects;
+  chunk->top = chunk->objects;
+  chunk->next = nullptr;
+  for (size_t i = 0; i < Chunk::kEntryCount; i++) {
+    chunk->entries[i].object = &chunk->objects[i];
+  }
+  if (JsAddWeakRootRange(runtime, &chunk->start, &chunk->top,
+                         &chunk->weakRootRange) != JsNoError) {
+    delete chunk;
+    return nullptr;
+  }
+  return chunk;
+}
+
+WeakReferenceTable::Entry * WeakReferenceTable::AllocateSlow() {
+  Chunk * chunk = NewChunk();
+  if (chunk == nullptr) {
+    return nullptr;
+  }
+
+  if (current != nullptr) {
+    current->next = chunk;
+  } else {
+    first = chunk;
+  }
+  current = chunk;
+
+  chunk->top++;
+  return &chunk->entries[0];
+}
+
+WeakReferenceTable::Entry * WeakReferenceTable::Allocate(JsValueRef object) {
+  Entry * entry;
+  if (freeList != nullptr) {
+    entry = freeList;
+    freeList = static_cast<Entry *>(entry->parameters);
+  } else if (current != nullptr &&
+             current->top < current->objects + Chunk::kEntryCount) {
+    entry = &current->entries[current->top - current->start];
+    current->top++;
+  } else {
+    entry = AllocateSlow();
+    if (entry == nullptr) {
+      return nullptr;
+    }
+  }
+
+  *entry->object = object;
+  entry->parameters = nullptr;
+  entry->infoCallback = nullptr;
+  entry->isWeakCallbackInfo = true;
+  entry->refCount = 1;
+  return entry;
+}
+
+void WeakReferenceTable::Free(Entry * entry) {
+  Disarm(entry);
+  *entry->object = JS_INVALID_REFERENCE;
+  entry->refCount = 0;
+  entry->parameters = freeList;
+  freeList = entry;
+}
+
+void WeakReferenceTable::Disarm(Entry * entry) {
+  if (entry->isWeakCallbackInfo && entry->infoCallback != nullptr) {
+    entry->infoCallback = nullptr;
+    armedCount--;
+  }
+}
+
+void WeakReferenceTable::SetCallback(
+    Entry * entry, v8::WeakCallbackInfo<void>::Callback callback,
+    void * parameters) {
+  Disarm(entry);
+  entry->parameters = parameters;
+  entry->infoCallback = callback;
+  entry->isWeakCallbackInfo = true;
+  armedCount++;
+}
+
+void WeakReferenceTable::SetCallback(
+    Entry * entry, v8::WeakCallbackData<v8::Value, void>::Callback callback,
+    void * parameters) {
+  Disarm(entry);
+  entry->parameters = parameters;
+  entry->dataCallback = callback;
+  entry->isWeakCallbackInfo = false;
+}
+
+void CALLBACK WeakReferenceTable::WeakRootsClearedCallback(
+    void * callbackState, size_t clearedCount) {
+  static_cast<WeakReferenceTable *>(callbackState)->RunCallbacks(clearedCount);
+}
+
+void WeakReferenceTable::RunCallbacks(size_t clearedCount) {
+  statistics.collectionCount++;
+  if (clearedCount == 0 || armedCount == 0) {
+    // No slot with a WeakCallbackInfo callback can have been cleared
+    statistics.lastCallbackCount = 0;
+    statistics.lastCallbackTimeNs = 0;
+    return;
+  }
+
+  uint64_t start = uv_hrtime();
+
+  // Collect first: the callbacks free entries and may allocate new ones. Each
+  // callback is disarmed as it is taken so it can't run twice. No more than
+  // the armed entries can have been cleared, so stop once all are found.
+  size_t maxCount = clearedCount < armedCount ? clearedCount : armedCount;
+  std::vector<PendingCallback> callbacks;
+  callbacks.swap(pendingCallbacks);
+  for (Chunk * chunk = first;
+       chunk != nullptr && callbacks.size() < maxCount;
+       chunk = chunk->next) {
+    size_t count = chunk->top - chunk->start;
+    for (size_t i = 0; i < count && callbacks.size() < maxCount; i++) {
+      Entry * entry = &chunk->entries[i];
+      if (entry->refCount != 0 && entry->isWeakCallbackInfo &&
+          entry->infoCallback != nullptr &&
+          chunk->objects[i] == JS_INVALID_REFERENCE) {
+        PendingCallback pending = { entry->infoCallback, entry->parameters };
+        callbacks.push_back(pending);
+        Disarm(entry);
+      }
+    }
+  }
+
+  v8::Isolate * isolate = v8::Isolate::GetCurrent();
+  for (size_t i = 0; i < callbacks.size(); i++) {
+    v8::WeakCallbackInfo<void>::Callback secondPassCallback = nullptr;
+    void * fields[v8::kInternalFieldsInWeakCallback] = {};
+    v8::WeakCallbackInfo<void> info(isolate, callbacks[i].parameters, fields,
+                                    &secondPassCallback);
+    callbacks[i].callback(info);
+  }
+
+  uint64_t elapsed = uv_hrtime() - start;
+  statistics.lastCallbackCount = callbacks.size();
+  statistics.lastCallbackTimeNs = elapsed;
+  statistics.totalCallbackCount += callbacks.size();
+  statistics.totalCallbackTimeNs += elapsed;
+
+  // Keep the buffer for the next collection
+  callbacks.clear();
+  if (pendingCallbacks.capacity() < callbacks.capacity()) {
+    pendingCallbacks.swap(callbacks);
+  }
+}
+
+}  // namespace jsrt
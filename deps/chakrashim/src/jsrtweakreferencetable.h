@@ -0,0 +1,101 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#pragma once
+
+#include <vector>
+
+namespace jsrt {
+
+// Backing store for weak persistent handles. Each entry pairs a callback
+// wrapper with an object slot; the slots are registered with the recycler as
+// weak root ranges, so a collection clears the slots of dead objects in one
+// pass instead of calling back once per object. The WeakCallbackInfo
+// callbacks of the cleared entries then run together, still inside the GC
+// pause, so they reset their handles before script can run and the objects
+// are swept.
+class WeakReferenceTable {
+ public:
+  typedef v8::chakrashim::WeakReferenceCallbackWrapper Entry;
+  class Chunk;
+
+  explicit WeakReferenceTable(JsRuntimeHandle runtime);
+  ~WeakReferenceTable();
+
+  bool Initialize();
+
+  // Returns an entry holding object, with a reference count of one
+  Entry * Allocate(JsValueRef object);
+  void Free(Entry * entry);
+
+  // Sets or replaces the callback of an entry
+  void SetCallback(Entry * entry,
+                   v8::WeakCallbackInfo<void>::Callback callback,
+                   void * parameters);
+  void SetCallback(Entry * entry,
+                   v8::WeakCallbackData<v8::Value, void>::Callback callback,
+                   void * parameters);
+
+  void GetStatistics(v8::chakrashim::WeakCallbackStatistics * statistics) {
+    *statistics = this->statistics;
+  }
+
+  // Runs the callbacks left as the runtime goes away and unregisters the
+  // slots. Chunks are freed with the table, after the runtime is disposed,
+  // since per-object callbacks may still refer to their entries until then.
+  void Dispose();
+
+ private:
+  struct PendingCallback {
+    v8::WeakCallbackInfo<void>::Callback callback;
+    void * parameters;
+  };
+
+  static void CALLBACK WeakRootsClearedCallback(void * callbackState,
+                                                size_t clearedCount);
+  void RunCallbacks(size_t clearedCount);
+  void Disarm(Entry * entry);
+  Entry * AllocateSlow();
+  Chunk * NewChunk();
+
+  JsRuntimeHandle runtime;
+  Chunk * first;
+  Chunk * current;
+  Entry * freeList;
+  // Entries whose WeakCallbackInfo callback hasn't run yet, so a collection
+  // that cleared none of those doesn't have to look for them
+  size_t armedCount;
+  std::vector<PendingCallback> pendingCallbacks;
+  v8::chakrashim::WeakCallbackStatistics statistics;
+};
+
+class WeakReferenceTable::Chunk {
+ public:
+  static const size_t kEntryCount = 1024;
+
+  JsValueRef * start;
+  JsValueRef * top;  // Slots past top have never been handed out
+  Chunk * next;
+  JsRootRangeHandle weakRootRange;
+  JsValueRef objects[kEntryCount];
+  Entry entries[kEntryCount];
+};
+
+}  // namespace jsrt
@@ -233,6 +233,10 @@ class Utils {
   static bool CheckSignature(Local<FunctionTemplate> receiver,
                              Local<Object> thisPointer,
                              Local<Object>* holder);
+  // Same, with the receiver's instance template already looked up
+  static bool CheckSignature(ObjectTemplate* receiverInstanceTemplate,
+                             Local<Object> thisPointer,
+                             Local<Object>* holder);
 
   template <class Func>
   static Local<Value> NewError(Handle<String> message, const Func& f);
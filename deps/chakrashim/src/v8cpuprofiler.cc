@@ -0,0 +1,168 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "v8chakra.h"
+#include "v8-profiler.h"
+
+namespace v8 {
+
+using jsrt::CpuProfileShim;
+using jsrt::CpuProfilerShim;
+
+static const CpuProfileShim::Node * ToNode(const CpuProfileNode * node) {
+  return reinterpret_cast<const CpuProfileShim::Node *>(node);
+}
+
+static const CpuProfileNode * FromNode(const CpuProfileShim::Node * node) {
+  return reinterpret_cast<const CpuProfileNode *>(node);
+}
+
+static const CpuProfileShim * ToProfile(const CpuProfile * profile) {
+  return reinterpret_cast<const CpuProfileShim *>(profile);
+}
+
+static CpuProfilerShim * ToProfiler(CpuProfiler * profiler) {
+  return reinterpret_cast<CpuProfilerShim *>(profiler);
+}
+
+static Local<String> MakeString(const std::wstring& str) {
+  JsValueRef strRef;
+  if (JsPointerToString(str.c_str(), str.length(), &strRef) != JsNoError) {
+    return Local<String>();
+  }
+  return static_cast<String*>(strRef);
+}
+
+static bool ReadString(Local<String> title, std::wstring * str) {
+  const wchar_t *strPtr;
+  size_t strLength;
+  if (title.IsEmpty()) {
+    str->clear();
+    return true;
+  }
+  if (JsStringToPointer(*title, &strPtr, &strLength) != JsNoError) {
+    return false;
+  }
+  str->assign(strPtr, strLength);
+  return true;
+}
+
+Local<String> CpuProfileNode::GetFunctionName() const {
+  return MakeString(ToNode(this)->functionName);
+}
+
+int CpuProfileNode::GetScriptId() const {
+  // CHAKRA-TODO: Script IDs are not reported with stack samples
+  return 0;
+}
+
+Local<String> CpuProfileNode::GetScriptResourceName() const {
+  return MakeString(ToNode(this)->sourceName);
+}
+
+int CpuProfileNode::GetLineNumber() const {
+  return ToNode(this)->lineNumber;
+}
+
+int CpuProfileNode::GetColumnNumber() const {
+  return ToNode(this)->columnNumber;
+}
+
+const char* CpuProfileNode::GetBailoutReason() const {
+  return "";
+}
+
+unsigned CpuProfileNode::GetHitCount() const {
+  return ToNode(this)->hitCount;
+}
+
+unsigned CpuProfileNode::GetCallUid() const {
+  return static_cast<unsigned>(
+    reinterpret_cast<uintptr_t>(ToNode(this)->functionKey));
+}
+
+unsigned CpuProfileNode::GetNodeId() const {
+  return ToNode(this)->id;
+}
+
+int CpuProfileNode::GetChildrenCount() const {
+  return static_cast<int>(ToNode(this)->children.size());
+}
+
+const CpuProfileNode* CpuProfileNode::GetChild(int index) const {
+  return FromNode(ToNode(this)->children[index]);
+}
+
+Local<String> CpuProfile::GetTitle() const {
+  return MakeString(ToProfile(this)->GetTitle());
+}
+
+const CpuProfileNode* CpuProfile::GetTopDownRoot() const {
+  return FromNode(ToProfile(this)->GetRoot());
+}
+
+int CpuProfile::GetSamplesCount() const {
+  return static_cast<int>(ToProfile(this)->GetSamples().size());
+}
+
+const CpuProfileNode* CpuProfile::GetSample(int index) const {
+  return FromNode(ToProfile(this)->GetSamples()[index]);
+}
+
+int64_t CpuProfile::GetSampleTimestamp(int index) const {
+  return ToProfile(this)->GetTimestamps()[index];
+}
+
+int64_t CpuProfile::GetStartTime() const {
+  return ToProfile(this)->GetStartTime();
+}
+
+int64_t CpuProfile::GetEndTime() const {
+  return ToProfile(this)->GetEndTime();
+}
+
+void CpuProfile::Delete() {
+  delete reinterpret_cast<CpuProfileShim *>(this);
+}
+
+void CpuProfiler::SetSamplingInterval(int us) {
+  ToProfiler(this)->SetSamplingInterval(us);
+}
+
+void CpuProfiler::StartProfiling(Local<String> title, bool record_samples) {
+  std::wstring str;
+  if (ReadString(title, &str)) {
+    ToProfiler(this)->StartProfiling(str, record_samples);
+  }
+}
+
+CpuProfile* CpuProfiler::StopProfiling(Local<String> title) {
+  std::wstring str;
+  if (!ReadString(title, &str)) {
+    return nullptr;
+  }
+  return reinterpret_cast<CpuProfile *>(ToProfiler(this)->StopProfiling(str));
+}
+
+void CpuProfiler::SetIdle(bool is_idle) {
+  ToProfiler(this)->SetIdle(is_idle);
+}
+
+}  // namespace v8
@@ -0,0 +1,67 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "v8chakra.h"
+
+namespace v8 {
+namespace chakrashim {
+
+Local<Object> GetEngineStatistics(Isolate* isolate) {
+  jsrt::IsolateShim* isolateShim = jsrt::IsolateShim::FromIsolate(isolate);
+  Local<Context> context = isolate->GetCurrentContext();
+  Local<Object> result = Object::New(isolate);
+  auto set = [&](const char* name, Local<Value> value) {
+    result->Set(context, String::NewFromUtf8(isolate, name), value).FromJust();
+  };
+
+  unsigned int backgroundParsedFunctionCount = 0;
+  CHAKRA_VERIFY_NOERROR(JsGetRuntimeBackgroundParseCount(
+    isolateShim->GetRuntimeHandle(), &backgroundParsedFunctionCount));
+  set("backgroundParsedFunctionCount",
+      Integer::NewFromUnsigned(isolate, backgroundParsedFunctionCount));
+
+  WeakCallbackStatistics weakCallbacks;
+  GetWeakCallbackStatistics(isolate, &weakCallbacks);
+  set("weakCallbackCollectionCount", Number::New(isolate,
+      static_cast<double>(weakCallbacks.collectionCount)));
+  set("lastWeakCallbackCount", Number::New(isolate,
+      static_cast<double>(weakCallbacks.lastCallbackCount)));
+  set("lastWeakCallbackTime", Number::New(isolate,
+      static_cast<double>(weakCallbacks.lastCallbackTimeNs)));
+  set("totalWeakCallbackCount", Number::New(isolate,
+      static_cast<double>(weakCallbacks.totalCallbackCount)));
+  set("totalWeakCallbackTime", Number::New(isolate,
+      static_cast<double>(weakCallbacks.totalCallbackTimeNs)));
+
+  // Microtasks are queued per context, so there is nothing to report when
+  // no context is entered.
+  jsrt::ContextShim* contextShim = jsrt::ContextShim::GetCurrent();
+  if (contextShim != nullptr) {
+    set("microtasksRun", Number::New(isolate, static_cast<double>(
+      contextShim->GetMicrotasksRun())));
+    set("microtaskDrainTime", Number::New(isolate, static_cast<double>(
+      contextShim->GetMicrotaskDrainTime())));
+  }
+
+  return result;
+}
+
+}  // namespace chakrashim
+}  // namespace v8
@@ -39,6 +39,12 @@ class FunctionCallbackData : public ExternalData {
   Persistent<ObjectTemplate> instanceTemplate;
   Persistent<Object> prototype;
 
+  // Resolved on the first call. Each FunctionCallbackData belongs to a single
+  // function, so its context never changes, and a template's instance
+  // template is created once.
+  ContextShim* contextShim;
+  ObjectTemplate* signatureTemplate;
+
  public:
   FunctionCallbackData(FunctionCallback callback,
                        Local<Value> data,
@@ -48,7 +54,9 @@ class FunctionCallbackData : public ExternalData {
         callback(callback),
         data(nullptr, data),
         signature(nullptr, signature),
-        instanceTemplate(nullptr, instanceTemplate) {
+        instanceTemplate(nullptr, instanceTemplate),
+        contextShim(nullptr),
+        signatureTemplate(nullptr) {
   }
 
   ~FunctionCallbackData() {
@@ -76,6 +84,13 @@ class FunctionCallbackData : public ExternalData {
       instanceTemplate->NewInstance(prototype) : Local<Object>();
   }
 
+  ContextShim* GetContextShim(JsValueRef callee) {
+    if (contextShim == nullptr) {
+      contextShim = IsolateShim::GetContextShimOfObject(callee);
+    }
+    return contextShim;
+  }
+
   bool CheckSignature(Local<Object> thisPointer,
                       JsValueRef *arguments,
                       unsigned short argumentCount,
@@ -85,8 +100,10 @@ class FunctionCallbackData : public ExternalData {
       return true;
     }
 
-    return Utils::CheckSignature(signature.As<FunctionTemplate>(),
-                                 thisPointer, holder);
+    if (signatureTemplate == nullptr) {
+      signatureTemplate = *signature.As<FunctionTemplate>()->InstanceTemplate();
+    }
+    return Utils::CheckSignature(signatureTemplate, thisPointer, holder);
   }
 
   static JsValueRef CALLBACK FunctionInvoked(JsValueRef callee,
@@ -94,18 +111,17 @@ class FunctionCallbackData : public ExternalData {
                                              JsValueRef *arguments,
                                              unsigned short argumentCount,
                                              void *callbackState) {
-    // Script engine could have switched context. Make sure to invoke the
-    // callback in the current callee context.
-    ContextShim* contextShim = IsolateShim::GetContextShimOfObject(callee);
-    ContextShim::Scope contextScope(contextShim);
-    HandleScope scope(nullptr);
-
     FunctionCallbackData* callbackData = nullptr;
     if (!ExternalData::TryGet(JsValueRef(callbackState), &callbackData)) {
       CHAKRA_ASSERT(false);  // This should never happen
       return JS_INVALID_REFERENCE;
     }
 
+    // Script engine could have switched context. Make sure to invoke the
+    // callback in the current callee context.
+    ContextShim::Scope contextScope(callbackData->GetContextShim(callee));
+    HandleScope scope(nullptr);
+
     Local<Object> thisPointer;
     ++arguments;  // skip the this argument
 
@@ -25,19 +25,57 @@ namespace v8 {
 
 __declspec(thread) HandleScope *current = nullptr;
 
+// A scope opened on a thread without an entered isolate has no slab, and
+// keeps its locals alive with AddRef instead.
+static jsrt::HandleSlab *GetHandleSlab(Isolate* isolate) {
+  jsrt::IsolateShim *isolateShim = isolate != nullptr ?
+    jsrt::IsolateShim::FromIsolate(isolate) : jsrt::IsolateShim::GetCurrent();
+  return isolateShim != nullptr ? isolateShim->GetHandleSlab() : nullptr;
+}
+
 HandleScope::HandleScope(Isolate* isolate)
-    : _prev(current),
-      _locals(),
-      _refs(JS_INVALID_REFERENCE),
-      _count(0),
+    : HandleScope(isolate, false) {
+}
+
+HandleScope::HandleScope(Isolate* isolate, bool escapable)
+    : _slab(GetHandleSlab(isolate)),
+      _markChunk(nullptr),
+      _markTop(nullptr),
+      _escapeSlot(nullptr),
+      _prev(current),
       _contextRef(JS_INVALID_REFERENCE),
       _addRefRecordHead(nullptr) {
+  jsrt::HandleSlab *slab = static_cast<jsrt::HandleSlab *>(_slab);
   current = this;
+  if (slab == nullptr) {
+    return;
+  }
+
+  // The escaped value has to outlive this scope, so reserve its slot below our
+  // own locals. Without an enclosing scope on the same slab nobody would ever
+  // give the slot back, so fall back to adding the value to _prev instead.
+  if (escapable && _prev != nullptr && _prev->_slab == _slab) {
+    _escapeSlot = slab->Allocate();
+    if (_escapeSlot != nullptr) {
+      *_escapeSlot = JS_INVALID_REFERENCE;
+    }
+  }
+
+  jsrt::HandleSlab::Mark mark = slab->GetMark();
+  _markChunk = mark.chunk;
+  _markTop = mark.top;
 }
 
 HandleScope::~HandleScope() {
   current = _prev;
 
+  if (_slab != nullptr) {
+    jsrt::HandleSlab::Mark mark = {
+      static_cast<jsrt::HandleSlab::Chunk *>(_markChunk), _markTop
+    };
+    static_cast<jsrt::HandleSlab *>(_slab)->Reset(mark);
+  }
+
   AddRefRecord * currRecord = this->_addRefRecordHead;
   while (currRecord != nullptr) {
     AddRefRecord * nextRecord = currRecord->_next;
@@ -54,29 +92,23 @@ HandleScope *HandleScope::GetCurrent() {
 }
 
 bool HandleScope::AddLocal(JsValueRef value) {
-  if (_count < _countof(_locals)) {
-    _locals[_count++] = value;
-    return true;
-  }
-
-  if (_refs == JS_INVALID_REFERENCE) {
-    if (JsCreateArray(1, &_refs) != JsNoError) {
-      return AddLocalAddRef(value);
-    }
-  }
-
-  JsValueRef index;
-
-  if (JsIntToNumber(_count - _countof(_locals), &index) != JsNoError) {
+  JsValueRef *slot = _slab != nullptr ?
+    static_cast<jsrt::HandleSlab *>(_slab)->Allocate() : nullptr;
+  if (slot == nullptr) {
     return AddLocalAddRef(value);
   }
 
-  if (JsSetIndexedProperty(_refs, index, value) != JsNoError) {
-    return AddLocalAddRef(value);
+  *slot = value;
+  return true;
+}
+
+bool HandleScope::AddEscapedLocal(JsValueRef value) {
+  if (_escapeSlot != nullptr && *_escapeSlot == JS_INVALID_REFERENCE) {
+    *_escapeSlot = value;
+    return true;
   }
 
-  _count++;
-  return true;
+  return _prev != nullptr && _prev->AddLocalAddRef(value);
 }
 
 bool HandleScope::AddLocalContext(JsContextRef value) {
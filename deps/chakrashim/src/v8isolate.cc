@@ -25,7 +25,6 @@
 namespace v8 {
 
 HeapProfiler dummyHeapProfiler;
-CpuProfiler dummyCpuProfiler;
 
 Isolate* Isolate::New(const CreateParams& params) {
   Isolate* iso = jsrt::IsolateShim::New();
@@ -122,7 +121,8 @@ HeapProfiler* Isolate::GetHeapProfiler() {
 }
 
 CpuProfiler* Isolate::GetCpuProfiler() {
-  return &dummyCpuProfiler;
+  return reinterpret_cast<CpuProfiler*>(
+    jsrt::IsolateShim::FromIsolate(this)->GetCpuProfiler());
 }
 
 void Isolate::AddGCPrologueCallback(
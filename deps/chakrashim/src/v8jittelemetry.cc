@@ -0,0 +1,129 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "v8chakra.h"
+#include <string>
+#include <vector>
+
+namespace v8 {
+namespace chakrashim {
+
+struct FunctionJitTelemetry {
+  std::wstring name;
+  std::wstring url;
+  JsFunctionJitTelemetry counters;
+  std::vector<std::pair<std::string, unsigned int>> bailOuts;
+};
+
+static void CHAKRA_CALLBACK CollectJitTelemetry(
+    const JsFunctionJitTelemetry *telemetry, void *callbackState) {
+  auto functions =
+    static_cast<std::vector<FunctionJitTelemetry>*>(callbackState);
+  functions->emplace_back();
+  FunctionJitTelemetry& function = functions->back();
+  function.name = telemetry->functionName != nullptr ?
+    telemetry->functionName : L"";
+  function.url = telemetry->sourceName != nullptr ?
+    telemetry->sourceName : L"";
+  function.counters = *telemetry;
+  for (unsigned int i = 0; i < telemetry->bailOutKindCount; i++) {
+    function.bailOuts.emplace_back(telemetry->bailOutKinds[i].kindName,
+                                   telemetry->bailOutKinds[i].count);
+  }
+}
+
+static Local<String> MakeString(const std::wstring& str) {
+  JsValueRef strRef;
+  if (JsPointerToString(str.c_str(), str.length(), &strRef) != JsNoError) {
+    return Local<String>();
+  }
+  return static_cast<String*>(strRef);
+}
+
+static const char* GetTierName(JsFunctionTier tier) {
+  switch (tier) {
+    case JsFunctionTierSimpleJit:
+      return "simpleJit";
+    case JsFunctionTierFullJit:
+      return "fullJit";
+    default:
+      return "interpreter";
+  }
+}
+
+Local<Array> GetJitTelemetry(Isolate* isolate) {
+  // The engine can't be called while it enumerates, so the objects are built
+  // once it is done.
+  std::vector<FunctionJitTelemetry> functions;
+  if (JsEnumerateJitTelemetry(CollectJitTelemetry, &functions) != JsNoError) {
+    return Local<Array>();
+  }
+
+  Local<Context> context = isolate->GetCurrentContext();
+  Local<Array> result = Array::New(isolate, static_cast<int>(functions.size()));
+  auto set = [&](Local<Object> object, const char* name, Local<Value> value) {
+    object->Set(context, String::NewFromUtf8(isolate, name), value).FromJust();
+  };
+
+  for (size_t i = 0; i < functions.size(); i++) {
+    const FunctionJitTelemetry& function = functions[i];
+    const JsFunctionJitTelemetry& counters = function.counters;
+
+    Local<Object> bailOuts = Object::New(isolate);
+    for (const auto& bailOut : function.bailOuts) {
+      set(bailOuts, bailOut.first.c_str(),
+          Integer::NewFromUnsigned(isolate, bailOut.second));
+    }
+
+    Local<Object> entry = Object::New(isolate);
+    set(entry, "name", MakeString(function.name));
+    set(entry, "url", MakeString(function.url));
+    set(entry, "lineNumber",
+        Integer::NewFromUnsigned(isolate, counters.line + 1));
+    set(entry, "columnNumber",
+        Integer::NewFromUnsigned(isolate, counters.column + 1));
+    set(entry, "tier", String::NewFromUtf8(isolate,
+                                           GetTierName(counters.tier)));
+    set(entry, "simpleJitCount",
+        Integer::NewFromUnsigned(isolate, counters.simpleJitCount));
+    set(entry, "fullJitCount",
+        Integer::NewFromUnsigned(isolate, counters.fullJitCount));
+    set(entry, "loopBodyJitCount",
+        Integer::NewFromUnsigned(isolate, counters.loopBodyJitCount));
+    set(entry, "rejitCount",
+        Integer::NewFromUnsigned(isolate, counters.rejitCount));
+    set(entry, "bailOutCount",
+        Integer::NewFromUnsigned(isolate, counters.bailOutCount));
+    set(entry, "otherBailOutCount",
+        Integer::NewFromUnsigned(isolate, counters.otherBailOutCount));
+    set(entry, "loopBodyEntryCount",
+        Integer::NewFromUnsigned(isolate, counters.loopBodyEntryCount));
+    set(entry, "scalarReplacedObjectCount",
+        Integer::NewFromUnsigned(isolate, counters.scalarReplacedObjectCount));
+    set(entry, "bailOuts", bailOuts);
+    set(entry, "codeGenTime", Number::New(isolate, counters.codeGenTime));
+    result->Set(context, static_cast<uint32_t>(i), entry).FromJust();
+  }
+
+  return result;
+}
+
+}  // namespace chakrashim
+}  // namespace v8
@@ -0,0 +1,271 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "v8chakra.h"
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace v8 {
+namespace chakrashim {
+
+namespace {
+
+// The contents of one array buffer on its way to another isolate: either the
+// memory detached from the sender, or a copy of it if it couldn't be detached.
+struct TransferredBuffer {
+  JsArrayBufferContentsHandle contents;
+  void* copy;
+  size_t length;
+
+  void Release() {
+    if (contents != nullptr) {
+      JsReleaseArrayBufferContents(contents);
+      contents = nullptr;
+    }
+    free(copy);
+    copy = nullptr;
+  }
+};
+
+struct Message {
+  std::string data;
+  std::vector<TransferredBuffer> buffers;
+
+  void Release() {
+    for (auto& buffer : buffers) {
+      buffer.Release();
+    }
+    buffers.clear();
+  }
+};
+
+void CALLBACK FreeCopiedBuffer(void* data) {
+  free(data);
+}
+
+class MessageChannelImpl : public MessageChannel {
+ public:
+  MessageChannelImpl()
+      : refCount(1), notifyCallback(nullptr), notifyData(nullptr) {
+    CHAKRA_VERIFY(uv_mutex_init(&mutex) == 0);
+  }
+
+  void Ref() override {
+    uv_mutex_lock(&mutex);
+    refCount++;
+    uv_mutex_unlock(&mutex);
+  }
+
+  void Unref() override {
+    uv_mutex_lock(&mutex);
+    bool last = --refCount == 0;
+    uv_mutex_unlock(&mutex);
+    if (last) {
+      delete this;
+    }
+  }
+
+  void SetNotifyCallback(NotifyCallback callback, void* data) override {
+    uv_mutex_lock(&mutex);
+    notifyCallback = callback;
+    notifyData = data;
+    uv_mutex_unlock(&mutex);
+  }
+
+  bool Post(Isolate* isolate, Local<String> message,
+            Local<ArrayBuffer>* transfer, int transferCount) override;
+  bool Receive(Isolate* isolate, Local<String>* message,
+               Local<Array>* transfer) override;
+
+  size_t GetPendingCount() override {
+    uv_mutex_lock(&mutex);
+    size_t count = messages.size();
+    uv_mutex_unlock(&mutex);
+    return count;
+  }
+
+ private:
+  ~MessageChannelImpl() override {
+    for (auto& message : messages) {
+      message.Release();
+    }
+    uv_mutex_destroy(&mutex);
+  }
+
+  static bool CopyBuffer(Local<ArrayBuffer> arrayBuffer,
+                         TransferredBuffer* buffer);
+
+  uv_mutex_t mutex;
+  unsigned int refCount;
+  std::deque<Message> messages;
+  NotifyCallback notifyCallback;
+  void* notifyData;
+};
+
+// External array buffers don't own their memory, so it can't leave the sending
+// isolate
+bool MessageChannelImpl::CopyBuffer(Local<ArrayBuffer> arrayBuffer,
+                                    TransferredBuffer* buffer) {
+  BYTE* data;
+  unsigned int length;
+  if (JsGetArrayBufferStorage(*arrayBuffer, &data, &length) != JsNoError) {
+    return false;
+  }
+  if (length > 0) {
+    buffer->copy = malloc(length);
+    if (buffer->copy == nullptr) {
+      return false;
+    }
+    memcpy(buffer->copy, data, length);
+  }
+  buffer->length = length;
+  return true;
+}
+
+bool MessageChannelImpl::Post(Isolate* isolate, Local<String> message,
+                              Local<ArrayBuffer>* transfer,
+                              int transferCount) {
+  if (message.IsEmpty() || transferCount < 0 ||
+      (transferCount > 0 && transfer == nullptr)) {
+    return false;
+  }
+
+  // Check every buffer before detaching any, so that a rejected message leaves
+  // the sender's buffers as they were. A buffer listed twice or already
+  // detached can't be moved.
+  std::vector<bool> detachable(transferCount);
+  for (int i = 0; i < transferCount; i++) {
+    bool isDetached;
+    bool isDetachable;
+    if (transfer[i].IsEmpty() || !transfer[i]->IsArrayBuffer() ||
+        JsGetArrayBufferDetachState(*transfer[i], &isDetached,
+                                    &isDetachable) != JsNoError ||
+        isDetached) {
+      return false;
+    }
+    for (int j = 0; j < i; j++) {
+      if (*transfer[j] == *transfer[i]) {
+        return false;
+      }
+    }
+    detachable[i] = isDetachable;
+  }
+
+  Message entry;
+  int length = message->Utf8Length();
+  entry.data.resize(length);
+  if (length > 0) {
+    message->WriteUtf8(&entry.data[0], length, nullptr,
+                       String::NO_NULL_TERMINATION);
+  }
+
+  // Copies can fail, so make them first. Once the buffers are known to be
+  // detachable, detaching them only fails when out of memory.
+  entry.buffers.resize(transferCount, TransferredBuffer());
+  for (int i = 0; i < transferCount; i++) {
+    if (!detachable[i] && !CopyBuffer(transfer[i], &entry.buffers[i])) {
+      entry.Release();
+      return false;
+    }
+  }
+  for (int i = 0; i < transferCount; i++) {
+    if (detachable[i]) {
+      JsErrorCode error = JsDetachArrayBuffer(*transfer[i],
+                                              &entry.buffers[i].contents);
+      CHAKRA_VERIFY_NOERROR(error);
+    }
+  }
+
+  uv_mutex_lock(&mutex);
+  messages.push_back(std::move(entry));
+  NotifyCallback callback = notifyCallback;
+  void* data = notifyData;
+  uv_mutex_unlock(&mutex);
+
+  if (callback != nullptr) {
+    callback(data);
+  }
+  return true;
+}
+
+bool MessageChannelImpl::Receive(Isolate* isolate, Local<String>* message,
+                                 Local<Array>* transfer) {
+  Message entry;
+  uv_mutex_lock(&mutex);
+  bool empty = messages.empty();
+  if (!empty) {
+    entry = std::move(messages.front());
+    messages.pop_front();
+  }
+  uv_mutex_unlock(&mutex);
+  if (empty) {
+    return false;
+  }
+
+  Local<String> data = String::NewFromUtf8(
+    isolate, entry.data.data(), NewStringType::kNormal,
+    static_cast<int>(entry.data.size())).FromMaybe(Local<String>());
+  JsValueRef buffers;
+  if (data.IsEmpty() ||
+      JsCreateArray(static_cast<unsigned int>(entry.buffers.size()),
+                    &buffers) != JsNoError) {
+    entry.Release();
+    return false;
+  }
+
+  for (size_t i = 0; i < entry.buffers.size(); i++) {
+    TransferredBuffer& buffer = entry.buffers[i];
+    JsValueRef arrayBuffer;
+    JsErrorCode error;
+    if (buffer.contents != nullptr) {
+      error = JsCreateArrayBufferFromContents(buffer.contents, &arrayBuffer);
+      if (error == JsNoError) {
+        buffer.contents = nullptr;
+      }
+    } else {
+      error = JsCreateExternalArrayBuffer(
+        buffer.copy, static_cast<unsigned int>(buffer.length),
+        FreeCopiedBuffer, buffer.copy, &arrayBuffer);
+      if (error == JsNoError) {
+        buffer.copy = nullptr;
+      }
+    }
+    if (error != JsNoError ||
+        jsrt::SetIndexedProperty(buffers, static_cast<unsigned int>(i),
+                                 arrayBuffer) != JsNoError) {
+      entry.Release();
+      return false;
+    }
+  }
+
+  *message = data;
+  *transfer = Local<Array>::New(buffers);
+  return true;
+}
+
+}  // namespace
+
+MessageChannel* MessageChannel::New() {
+  return new MessageChannelImpl();
+}
+
+}  // namespace chakrashim
+}  // namespace v8
@@ -41,6 +41,7 @@ typedef struct AcessorExternalDataType {
     AccessorNameSetterCallback setter;
   };
   Persistent<Name> propertyName;
+  ObjectTemplate* signatureTemplate = nullptr;  // Resolved on first access
 
   bool CheckSignature(Local<Object> thisPointer, Local<Object>* holder) {
     if (signature.IsEmpty()) {
@@ -48,8 +49,11 @@ typedef struct AcessorExternalDataType {
       return true;
     }
 
-    Local<FunctionTemplate> receiver = signature.As<FunctionTemplate>();
-    return Utils::CheckSignature(receiver, thisPointer, holder);
+    if (signatureTemplate == nullptr) {
+      Local<FunctionTemplate> receiver = signature.As<FunctionTemplate>();
+      signatureTemplate = *receiver->InstanceTemplate();
+    }
+    return Utils::CheckSignature(signatureTemplate, thisPointer, holder);
   }
 } AccessorExternalData;
 
@@ -675,6 +679,12 @@ JsErrorCode Utils::GetObjectData(Object* object, ObjectData** objectData) {
     return JsNoError;
   }
 
+  // Instances of templates without interceptors are the external object
+  // itself, so try that before looking up the proxy target below
+  if (ExternalData::TryGet(object, objectData)) {
+    return JsNoError;
+  }
+
   JsErrorCode error;
   JsValueRef self = object;
   {
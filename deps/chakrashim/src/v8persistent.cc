@@ -24,20 +24,29 @@ namespace v8 {
 
 void CALLBACK Utils::WeakReferenceCallbackWrapperCallback(JsRef ref,
                                                           void *data) {
-  const chakrashim::WeakReferenceCallbackWrapper *callbackWrapper =
-    reinterpret_cast<const chakrashim::WeakReferenceCallbackWrapper*>(data);
+  chakrashim::WeakReferenceCallbackWrapper *callbackWrapper =
+    reinterpret_cast<chakrashim::WeakReferenceCallbackWrapper*>(data);
+  if (callbackWrapper->infoCallback == nullptr) {
+    return;  // Already called
+  }
+
   if (callbackWrapper->isWeakCallbackInfo) {
-    WeakCallbackInfo<void>::Callback callback;
+    WeakCallbackInfo<void>::Callback callback = callbackWrapper->infoCallback;
+    callbackWrapper->infoCallback = nullptr;
+    WeakCallbackInfo<void>::Callback secondPassCallback = nullptr;
     void* fields[kInternalFieldsInWeakCallback] = {};
     WeakCallbackInfo<void> info(Isolate::GetCurrent(),
                                 callbackWrapper->parameters,
-                                fields, &callback);
-    callbackWrapper->infoCallback(info);
+                                fields, &secondPassCallback);
+    callback(info);
   } else {
+    WeakCallbackData<Value, void>::Callback callback =
+      callbackWrapper->dataCallback;
+    callbackWrapper->dataCallback = nullptr;
     WeakCallbackData<Value, void> data(Isolate::GetCurrent(),
                                        callbackWrapper->parameters,
                                        static_cast<Value*>(ref));
-    callbackWrapper->dataCallback(data);
+    callback(data);
   }
 }
 
@@ -47,48 +56,75 @@ static void CALLBACK DummyObjectBeforeCollectCallback(JsRef ref, void *data) {
   // Do nothing, only used to revive an object temporarily
 }
 
-void ClearObjectWeakReferenceCallback(JsValueRef object, bool revive) {
-  if (jsrt::IsolateShim::GetCurrent()->IsDisposing()) {
+static void ClearObjectBeforeCollectCallback(
+    WeakReferenceCallbackWrapper *callbackWrapper, bool revive) {
+  JsValueRef object = *callbackWrapper->object;
+  if (!callbackWrapper->isWeakCallbackInfo &&
+      callbackWrapper->dataCallback != nullptr &&
+      object != JS_INVALID_REFERENCE) {
+    JsSetObjectBeforeCollectCallback(
+      object, nullptr, revive ? DummyObjectBeforeCollectCallback : nullptr);
+  }
+}
+
+void ReleaseWeakReference(WeakReferenceCallbackWrapper* weakWrapper,
+                          bool revive) {
+  jsrt::IsolateShim *isolateShim = jsrt::IsolateShim::GetCurrent();
+  if (isolateShim->IsDisposing()) {
     return;
   }
 
-  JsSetObjectBeforeCollectCallback(
-    object, nullptr, revive ? DummyObjectBeforeCollectCallback : nullptr);
+  if (--weakWrapper->refCount == 0) {
+    ClearObjectBeforeCollectCallback(weakWrapper, revive);
+    isolateShim->GetWeakReferenceTable()->Free(weakWrapper);
+  }
 }
 
 template <class Callback, class Func>
 void SetObjectWeakReferenceCallbackCommon(
     JsValueRef object,
     Callback callback,
-    std::shared_ptr<WeakReferenceCallbackWrapper>* weakWrapper,
+    WeakReferenceCallbackWrapper** weakWrapper,
     const Func& initWrapper) {
-  if (callback == nullptr || object == JS_INVALID_REFERENCE) {
+  if (callback == nullptr || object == JS_INVALID_REFERENCE ||
+      IsTaggedInt(object) || IsTaggedFloat(object)) {
     return;
   }
 
-  if (!*weakWrapper) {
-    *weakWrapper = std::make_shared<WeakReferenceCallbackWrapper>();
+  WeakReferenceCallbackWrapper *callbackWrapper = *weakWrapper;
+  if (callbackWrapper == nullptr) {
+    callbackWrapper = jsrt::IsolateShim::GetCurrent()->GetWeakReferenceTable()
+      ->Allocate(object);
+    if (callbackWrapper == nullptr) {
+      return;
+    }
+    *weakWrapper = callbackWrapper;
+  } else {
+    ClearObjectBeforeCollectCallback(callbackWrapper, /*revive*/false);
   }
 
-  WeakReferenceCallbackWrapper *callbackWrapper = (*weakWrapper).get();
   initWrapper(callbackWrapper);
 
-  JsSetObjectBeforeCollectCallback(
-    object, callbackWrapper,
-    v8::Utils::WeakReferenceCallbackWrapperCallback);
+  // WeakCallbackInfo callbacks don't see the object, so they can wait for the
+  // GC to clear its table slot. The older API hands out the object and still
+  // needs a callback while it is alive.
+  if (!callbackWrapper->isWeakCallbackInfo) {
+    JsSetObjectBeforeCollectCallback(
+      object, callbackWrapper,
+      v8::Utils::WeakReferenceCallbackWrapperCallback);
+  }
 }
 
 void SetObjectWeakReferenceCallback(
     JsValueRef object,
     WeakCallbackInfo<void>::Callback callback,
     void* parameters,
-    std::shared_ptr<WeakReferenceCallbackWrapper>* weakWrapper) {
+    WeakReferenceCallbackWrapper** weakWrapper) {
   SetObjectWeakReferenceCallbackCommon(
     object, callback, weakWrapper,
     [=](WeakReferenceCallbackWrapper *callbackWrapper) {
-      callbackWrapper->parameters = parameters;
-      callbackWrapper->infoCallback = callback;
-      callbackWrapper->isWeakCallbackInfo = true;
+      jsrt::IsolateShim::GetCurrent()->GetWeakReferenceTable()
+        ->SetCallback(callbackWrapper, callback, parameters);
   });
 }
 
@@ -96,15 +132,20 @@ void SetObjectWeakReferenceCallback(
     JsValueRef object,
     WeakCallbackData<Value, void>::Callback callback,
     void* parameters,
-    std::shared_ptr<WeakReferenceCallbackWrapper>* weakWrapper) {
+    WeakReferenceCallbackWrapper** weakWrapper) {
   SetObjectWeakReferenceCallbackCommon(
     object, callback, weakWrapper,
     [=](WeakReferenceCallbackWrapper *callbackWrapper) {
-      callbackWrapper->parameters = parameters;
-      callbackWrapper->dataCallback = callback;
-      callbackWrapper->isWeakCallbackInfo = false;
+      jsrt::IsolateShim::GetCurrent()->GetWeakReferenceTable()
+        ->SetCallback(callbackWrapper, callback, parameters);
   });
 }
 
+void GetWeakCallbackStatistics(Isolate* isolate,
+                               WeakCallbackStatistics* statistics) {
+  jsrt::IsolateShim::FromIsolate(isolate)->GetWeakReferenceTable()
+    ->GetStatistics(statistics);
+}
+
 }  // namespace chakrashim
 }  // namespace v8
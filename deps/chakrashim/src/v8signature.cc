@@ -42,13 +42,17 @@ Local<AccessorSignature> AccessorSignature::New(
 bool Utils::CheckSignature(Local<FunctionTemplate> receiver,
                            Local<Object> thisPointer,
                            Local<Object>* holder) {
-  *holder = thisPointer;
+  return CheckSignature(*receiver->InstanceTemplate(), thisPointer, holder);
+}
 
-  Local<ObjectTemplate> receiverInstanceTemplate = receiver->InstanceTemplate();
+bool Utils::CheckSignature(ObjectTemplate* receiverInstanceTemplate,
+                           Local<Object> thisPointer,
+                           Local<Object>* holder) {
+  *holder = thisPointer;
 
   // v8 signature check walks hidden prototype chain to find holder. Chakra
   // doesn't support hidden prototypes. Just check the receiver itself.
-  bool matched = Utils::IsInstanceOf(*thisPointer, *receiverInstanceTemplate);
+  bool matched = Utils::IsInstanceOf(*thisPointer, receiverInstanceTemplate);
 
   if (!matched) {
     const wchar_t txt[] = L"Illegal invocation";
@@ -70,17 +70,11 @@ int String::Length() const {
 }
 
 int String::Utf8Length() const {
-  const wchar_t* str;
-  size_t stringLength;
-  if (JsStringToPointer((JsValueRef)this, &str, &stringLength) != JsNoError) {
-    // error
-    return 0;
-  }
-
   size_t utf8Length;
-  auto result =
-    jsrt::StringConvert::UTF8CharLength(str, stringLength, &utf8Length);
-  if (result != JsNoError) {
+  // Unpaired surrogates take three bytes whether they are replaced or not
+  if (JsCopyStringUtf8((JsValueRef)this, nullptr, 0, false,
+                       &utf8Length, nullptr) != JsNoError) {
+    // error
     return 0;
   }
 
@@ -157,46 +151,22 @@ int String::WriteUtf8(
     return 0;
   }
 
-  const wchar_t* str;
-  size_t stringLength;
-  if (JsStringToPointer((JsValueRef)this, &str, &stringLength) != JsNoError) {
-    // error
-    return 0;
-  }
-
-  if (stringLength == 0) {
-    // bail out if string is empty
+  // Concatenated strings are transcoded piece by piece, so a large rope is
+  // never flattened into an intermediate UTF-16 buffer on its way out.
+  // in case length was not provided the buffer is big enough for the whole
+  // string and its null terminator
+  size_t bufferSize = length < 0 ? SIZE_MAX : static_cast<size_t>(length);
 
-    if (!(options & String::NO_NULL_TERMINATION)) {
-      buffer[0] = '\0';
-    }
-
-    return 0;
-  }
-
-  int originalLength = length;
-  if (length < 0) {
-    // in case length was not provided we want to copy the whole string
-    length = static_cast<int>(stringLength);
-  }
-  unsigned int count = length < static_cast<int>(stringLength) ?
-    length : static_cast<unsigned int>(stringLength);
-
-  size_t charsCount = 0;
   size_t size = 0;
-  // we pass -1 as the buffer size to imply that the buffer is big enough
-  JsErrorCode convertResult = jsrt::StringConvert::ToUTF8Char(
-    str, count, buffer, originalLength, &size, &charsCount);
-
-  if (convertResult != JsNoError) {
+  size_t charsCount = 0;
+  bool replace = (options & String::REPLACE_INVALID_UTF8) != 0;
+  if (JsCopyStringUtf8((JsValueRef)this, buffer, bufferSize, replace,
+                       &size, &charsCount) != JsNoError) {
     return 0;
   }
 
-  if (!(options & String::NO_NULL_TERMINATION)) {
+  if (!(options & String::NO_NULL_TERMINATION) && size < bufferSize) {
     buffer[size++] = '\0';
-    count++;
-    // CHAKRA-TODO: @saary - should we increase this?
-    // charsCount++;
   }
 
   if (nchars_ref != nullptr) {
@@ -217,7 +187,8 @@ String* String::Cast(v8::Value *obj) {
 
 template <class ToWide>
 MaybeLocal<String> String::New(const ToWide& toWide,
-                               const char *data, int length) {
+                               const char *data, int length,
+                               v8::NewStringType type) {
   if (length < 0) {
     length = static_cast<int>(strlen(data));
   }
@@ -232,16 +203,23 @@ MaybeLocal<String> String::New(const ToWide& toWide,
     return Local<String>();
   }
 
-  return New(str.get(), static_cast<int>(charsWritten));
+  return New(str.get(), static_cast<int>(charsWritten), type);
 }
 
-MaybeLocal<String> String::New(const wchar_t *data, int length) {
+MaybeLocal<String> String::New(const wchar_t *data, int length,
+                               v8::NewStringType type) {
   if (length < 0) {
     length = static_cast<int>(wcslen(data));
   }
 
+  // Internalized strings are mostly property names (e.g. the per isolate
+  // strings of node's Environment). Creating them with their property ID
+  // spares hashing them again on every property access using them.
   JsValueRef strRef;
-  if (JsPointerToString(data, length, &strRef) != JsNoError) {
+  JsErrorCode error = type == v8::NewStringType::kInternalized ?
+    JsCreatePropertyString(data, length, &strRef) :
+    JsPointerToString(data, length, &strRef);
+  if (error != JsNoError) {
     return Local<String>();
   }
 
@@ -252,7 +230,7 @@ MaybeLocal<String> String::NewFromUtf8(Isolate* isolate,
                                        const char* data,
                                        v8::NewStringType type,
                                        int length) {
-  return New(jsrt::StringConvert::ToWChar, data, length);
+  return New(jsrt::StringConvert::ToWChar, data, length, type);
 }
 
 Local<String> String::NewFromUtf8(Isolate* isolate,
@@ -269,7 +247,7 @@ MaybeLocal<String> String::NewFromOneByte(Isolate* isolate,
                                           int length) {
   return New(jsrt::StringConvert::CopyRaw<char, wchar_t>,
              reinterpret_cast<const char*>(data),
-             length);
+             length, type);
 }
 
 Local<String> String::NewFromOneByte(Isolate* isolate,
@@ -285,7 +263,7 @@ MaybeLocal<String> String::NewFromTwoByte(Isolate* isolate,
                                           const uint16_t* data,
                                           v8::NewStringType type,
                                           int length) {
-  return New(reinterpret_cast<const wchar_t*>(data), length);
+  return New(reinterpret_cast<const wchar_t*>(data), length, type);
 }
 
 Local<String> String::NewFromTwoByte(Isolate* isolate,
@@ -23,6 +23,9 @@
 #include "jsrtutils.h"
 #include "v8-debug.h"
 #include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
 
 namespace v8 {
 
@@ -30,6 +33,11 @@ bool g_disposed = false;
 bool g_exposeGC = false;
 bool g_useStrict = false;
 bool g_disableIdleGc = false;
+bool g_parallelParse = false;
+bool g_perfBasicProf = false;
+bool g_perfProf = false;
+// -1 when --loop-jit-threshold isn't given, -2 when its value isn't a count
+int g_loopJitThreshold = -1;
 
 const char *V8::GetVersion() {
   static char versionStr[32] = {};
@@ -105,6 +113,35 @@ void V8::SetFlagsFromCommandLine(int *argc, char **argv, bool remove_flags) {
       if (remove_flags) {
         argv[i] = nullptr;
       }
+    } else if (equals("--parallel-parse", arg) ||
+               equals("--parallel_parse", arg)) {
+      g_parallelParse = true;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
+    } else if (equals("--perf-basic-prof", arg) ||
+               equals("--perf_basic_prof", arg)) {
+      g_perfBasicProf = true;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
+    } else if (equals("--perf-prof", arg) || equals("--perf_prof", arg)) {
+      g_perfProf = true;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
+    } else if (startsWith(arg, "--loop-jit-threshold=") ||
+               startsWith(arg, "--loop_jit_threshold=")) {
+      const char* value = arg + sizeof("--loop-jit-threshold=") - 1;
+      char* end;
+      errno = 0;
+      long threshold = strtol(value, &end, 10);
+      bool valid = *value >= '0' && *value <= '9' && *end == '\0' &&
+                   errno == 0 && threshold <= INT_MAX;
+      g_loopJitThreshold = valid ? static_cast<int>(threshold) : -2;
+      if (remove_flags) {
+        argv[i] = nullptr;
+      }
     } else if (remove_flags &&
                (startsWith(
                  arg, "--debug")  // Ignore some flags to reduce unit test noise
@@ -120,6 +157,14 @@ void V8::SetFlagsFromCommandLine(int *argc, char **argv, bool remove_flags) {
           " --expose_gc (expose gc extension)\n"
           "     type: bool  default: false\n"
           " --off_idlegc (turn off idle GC)\n"
+          " --parallel_parse (parse function bodies of large scripts on "
+          "background threads)\n"
+          "     type: bool  default: false\n"
+          " --perf_basic_prof (write /tmp/perf-<pid>.map for linux perf)\n"
+          " --perf_prof (write /tmp/jit-<pid>.dump for perf inject --jit)\n"
+          " --loop_jit_threshold (iterations a loop is interpreted before "
+          "its body is jitted)\n"
+          "     type: int  default: 150\n"
           " --harmony_simd (enable \"harmony simd\" (in progress))\n"
           " --harmony (Other flags are ignored in node running with "
           "chakracore)\n"
@@ -140,6 +185,19 @@ bool V8::Initialize() {
   if (g_disposed) {
     return false;  // Can no longer Initialize if Disposed
   }
+  if ((g_perfBasicProf || g_perfProf) &&
+      JsEnablePerfJitProfiling(g_perfBasicProf, g_perfProf) != JsNoError) {
+    fprintf(stderr, "Warning: --perf-basic-prof and --perf-prof are not "
+                    "supported on this platform\n");
+  }
+  if (g_loopJitThreshold == -2) {
+    fprintf(stderr, "Warning: --loop-jit-threshold has an invalid value, "
+                    "expected a non-negative count\n");
+  } else if (g_loopJitThreshold >= 0 &&
+             JsSetLoopBodyJitThreshold(g_loopJitThreshold) != JsNoError) {
+    fprintf(stderr, "Warning: --loop-jit-threshold is not supported by "
+                    "this build\n");
+  }
 #ifndef NODE_ENGINE_CHAKRACORE
   if (g_EnableDebug && JsStartDebugging() != JsNoError) {
     return false;
@@ -25,110 +25,17 @@ namespace v8 {
 
 using jsrt::ContextShim;
 
-static bool IsOfType(const Value* ref, JsValueType type) {
-  JsValueType valueType;
-  if (JsGetValueType(const_cast<Value*>(ref), &valueType) != JsNoError) {
-    return false;
-  }
-  return valueType == type;
-}
-
-bool Value::IsUndefined() const {
-  return IsOfType(this, JsValueType::JsUndefined);
-}
-
-bool Value::IsNull() const {
-  return IsOfType(this, JsValueType::JsNull);
-}
-
-bool Value::IsTrue() const {
-  bool isTrue;
-  if (JsEquals(jsrt::GetTrue(), (JsValueRef)this, &isTrue) != JsNoError) {
-    return false;
-  }
-
-  return isTrue;
-}
-
-bool Value::IsFalse() const {
-  bool isFalse;
-  if (JsEquals(jsrt::GetFalse(), (JsValueRef)this, &isFalse) != JsNoError) {
-    return false;
-  }
-
-  return isFalse;
-}
-
-bool Value::IsString() const {
-  return IsOfType(this, JsValueType::JsString);
-}
-
-bool Value::IsFunction() const {
-  return IsOfType(this, JsValueType::JsFunction);
-}
-
-bool Value::IsArray() const {
-  return IsOfType(this, JsValueType::JsArray);
-}
-
-bool Value::IsObject() const {
-  JsValueType type;
-  if (JsGetValueType((JsValueRef)this, &type) != JsNoError) {
-    return false;
-  }
-
-  return type >= JsValueType::JsObject && type != JsSymbol;
-}
+JsValueLayout chakrashim::g_valueLayout;
 
 bool Value::IsExternal() const {
   return External::IsExternal(this);
 }
 
-bool Value::IsArrayBuffer() const {
-  return IsOfType(this, JsValueType::JsArrayBuffer);
-}
-
-bool Value::IsTypedArray() const {
-  return IsOfType(this, JsValueType::JsTypedArray);
-}
-
-#define DEFINE_TYPEDARRAY_CHECK(ArrayType) \
-  bool Value::Is##ArrayType##Array() const { \
-  JsTypedArrayType typedArrayType; \
-  return JsGetTypedArrayInfo(const_cast<Value*>(this), \
-                             &typedArrayType, \
-                             nullptr, nullptr, nullptr) == JsNoError && \
-  typedArrayType == JsTypedArrayType::JsArrayType##ArrayType; \
-}
-
-DEFINE_TYPEDARRAY_CHECK(Uint8)
-DEFINE_TYPEDARRAY_CHECK(Uint8Clamped)
-DEFINE_TYPEDARRAY_CHECK(Int8)
-DEFINE_TYPEDARRAY_CHECK(Uint16)
-DEFINE_TYPEDARRAY_CHECK(Int16)
-DEFINE_TYPEDARRAY_CHECK(Uint32)
-DEFINE_TYPEDARRAY_CHECK(Int32)
-DEFINE_TYPEDARRAY_CHECK(Float32)
-DEFINE_TYPEDARRAY_CHECK(Float64)
-
-
-bool Value::IsArrayBufferView() const {
-  return IsTypedArray() || IsDataView();
-}
-
-bool Value::IsDataView() const {
-  return IsOfType(this, JsValueType::JsDataView);
-}
-
-bool Value::IsBoolean() const {
-  return IsOfType(this, JsValueType::JsBoolean);
-}
-
-bool Value::IsNumber() const {
-  return IsOfType(this, JsValueType::JsNumber);
-}
-
 bool Value::IsInt32() const {
+  if (chakrashim::IsTaggedInt(this)) {
+    return true;
+  }
+
   if (!IsNumber()) {
     return false;
   }
@@ -144,6 +51,10 @@ bool Value::IsInt32() const {
 }
 
 bool Value::IsUint32() const {
+  if (chakrashim::IsTaggedInt(this)) {
+    return chakrashim::GetTaggedIntValue(this) >= 0;
+  }
+
   if (!IsNumber()) {
     return false;
   }
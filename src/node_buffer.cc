@@ -29,6 +29,17 @@
       return env->ThrowTypeError("argument should be a Buffer");            \
   } while (0)
 
+#ifdef NODE_ENGINE_CHAKRACORE
+// Chakra reads the data pointer and length of a typed array inline, without
+// going through its ArrayBuffer.
+#define SPREAD_ARG(val, name)                                                 \
+  CHECK((val)->IsUint8Array());                                               \
+  Local<Uint8Array> name = (val).As<Uint8Array>();                            \
+  const size_t name##_length = v8::chakrashim::GetTypedArrayLength(*name);    \
+  char* const name##_data = v8::chakrashim::GetTypedArrayData(*name);         \
+  if (name##_length > 0)                                                      \
+    CHECK_NE(name##_data, nullptr);
+#else
 #define SPREAD_ARG(val, name)                                                 \
   CHECK((val)->IsUint8Array());                                               \
   Local<Uint8Array> name = (val).As<Uint8Array>();                            \
@@ -39,6 +50,7 @@
       static_cast<char*>(name##_c.Data()) + name##_offset;                    \
   if (name##_length > 0)                                                      \
     CHECK_NE(name##_data, nullptr);
+#endif
 
 #define SLICE_START_END(start_arg, end_arg, end_max)                        \
   size_t start;                                                             \
@@ -232,31 +244,47 @@ bool HasInstance(Local<Object> obj) {
 
 char* Data(Local<Value> val) {
   CHECK(val->IsUint8Array());
+#ifdef NODE_ENGINE_CHAKRACORE
+  return v8::chakrashim::GetTypedArrayData(*val);
+#else
   Local<Uint8Array> ui = val.As<Uint8Array>();
   ArrayBuffer::Contents ab_c = ui->Buffer()->GetContents();
   return static_cast<char*>(ab_c.Data()) + ui->ByteOffset();
+#endif
 }
 
 
 char* Data(Local<Object> obj) {
   CHECK(obj->IsUint8Array());
+#ifdef NODE_ENGINE_CHAKRACORE
+  return v8::chakrashim::GetTypedArrayData(*obj);
+#else
   Local<Uint8Array> ui = obj.As<Uint8Array>();
   ArrayBuffer::Contents ab_c = ui->Buffer()->GetContents();
   return static_cast<char*>(ab_c.Data()) + ui->ByteOffset();
+#endif
 }
 
 
 size_t Length(Local<Value> val) {
   CHECK(val->IsUint8Array());
+#ifdef NODE_ENGINE_CHAKRACORE
+  return v8::chakrashim::GetTypedArrayLength(*val);
+#else
   Local<Uint8Array> ui = val.As<Uint8Array>();
   return ui->ByteLength();
+#endif
 }
 
 
 size_t Length(Local<Object> obj) {
   CHECK(obj->IsUint8Array());
+#ifdef NODE_ENGINE_CHAKRACORE
+  return v8::chakrashim::GetTypedArrayLength(*obj);
+#else
   Local<Uint8Array> ui = obj.As<Uint8Array>();
   return ui->ByteLength();
+#endif
 }
 
 
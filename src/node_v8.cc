@@ -92,6 +92,21 @@ void SetFlagsFromString(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+#ifdef NODE_ENGINE_CHAKRACORE
+void GetJitTelemetry(const FunctionCallbackInfo<Value>& args) {
+  Local<Array> telemetry = v8::chakrashim::GetJitTelemetry(args.GetIsolate());
+  if (!telemetry.IsEmpty())
+    args.GetReturnValue().Set(telemetry);
+}
+
+
+void GetEngineStatistics(const FunctionCallbackInfo<Value>& args) {
+  args.GetReturnValue().Set(
+      v8::chakrashim::GetEngineStatistics(args.GetIsolate()));
+}
+#endif
+
+
 void InitializeV8Bindings(Local<Object> target,
                           Local<Value> unused,
                           Local<Context> context) {
@@ -168,6 +183,11 @@ void InitializeV8Bindings(Local<Object> target,
 #undef V
 
   env->SetMethod(target, "setFlagsFromString", SetFlagsFromString);
+
+#ifdef NODE_ENGINE_CHAKRACORE
+  env->SetMethod(target, "getJitTelemetry", GetJitTelemetry);
+  env->SetMethod(target, "getEngineStatistics", GetEngineStatistics);
+#endif
 }
 
 }  // namespace node
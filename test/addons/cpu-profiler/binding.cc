@@ -0,0 +1,59 @@
+#include "node.h"
+#include "v8.h"
+#include "v8-profiler.h"
+
+namespace {
+
+v8::Local<v8::String> Str(v8::Isolate* isolate, const char* str) {
+  return v8::String::NewFromUtf8(isolate, str);
+}
+
+// Converts a call tree node to { name, hitCount, children } so the test can
+// look for frames from JS.
+v8::Local<v8::Object> ToObject(v8::Isolate* isolate,
+                               const v8::CpuProfileNode* node) {
+  v8::Local<v8::Object> result = v8::Object::New(isolate);
+  result->Set(Str(isolate, "name"), node->GetFunctionName());
+  result->Set(Str(isolate, "hitCount"),
+              v8::Integer::NewFromUnsigned(isolate, node->GetHitCount()));
+  v8::Local<v8::Array> children =
+      v8::Array::New(isolate, node->GetChildrenCount());
+  for (int i = 0; i < node->GetChildrenCount(); i++) {
+    children->Set(i, ToObject(isolate, node->GetChild(i)));
+  }
+  result->Set(Str(isolate, "children"), children);
+  return result;
+}
+
+// profile(title, fn): profiles a call to fn at a 100us interval and returns
+// { root, samplesCount }.
+inline void Profile(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::Isolate* const isolate = args.GetIsolate();
+  v8::CpuProfiler* const profiler = isolate->GetCpuProfiler();
+  v8::Local<v8::String> title = args[0].As<v8::String>();
+
+  profiler->SetSamplingInterval(100);
+  profiler->StartProfiling(title, true);
+  args[1].As<v8::Function>()->Call(isolate->GetCurrentContext()->Global(),
+                                   0, nullptr);
+  v8::CpuProfile* const profile = profiler->StopProfiling(title);
+
+  v8::Local<v8::Object> result = v8::Object::New(isolate);
+  result->Set(Str(isolate, "title"), profile->GetTitle());
+  result->Set(Str(isolate, "root"),
+              ToObject(isolate, profile->GetTopDownRoot()));
+  result->Set(Str(isolate, "samplesCount"),
+              v8::Integer::New(isolate, profile->GetSamplesCount()));
+  profile->Delete();
+  args.GetReturnValue().Set(result);
+}
+
+inline void Initialize(v8::Local<v8::Object> binding) {
+  v8::Isolate* const isolate = binding->GetIsolate();
+  binding->Set(Str(isolate, "profile"),
+               v8::FunctionTemplate::New(isolate, Profile)->GetFunction());
+}
+
+NODE_MODULE(binding, Initialize)
+
+}  // anonymous namespace
@@ -0,0 +1,43 @@
+'use strict';
+
+require('../../common');
+const assert = require('assert');
+const binding = require('./build/Release/binding');
+
+function findNode(node, name) {
+  if (node.name === name)
+    return node;
+  for (const child of node.children) {
+    const found = findNode(child, name);
+    if (found)
+      return found;
+  }
+  return null;
+}
+
+function hitCount(node) {
+  return node.children.reduce((sum, child) => sum + hitCount(child),
+                              node.hitCount);
+}
+
+// Spins in a loop without calls, so samples have to be taken at loop probes
+// once the function is JIT'd, as well as at function entry.
+function spin(ms) {
+  const end = Date.now() + ms;
+  let x = 0;
+  while (Date.now() < end) {
+    for (let i = 0; i < 1e4; i++)
+      x += i;
+  }
+  return x;
+}
+
+const profile = binding.profile('spin', function outer() {
+  spin(200);
+});
+
+assert.strictEqual(profile.title, 'spin');
+assert.ok(profile.samplesCount > 0, 'no samples were recorded');
+assert.strictEqual(hitCount(profile.root), profile.samplesCount);
+assert.ok(findNode(profile.root, 'outer'), 'outer is not in the profile');
+assert.ok(findNode(profile.root, 'spin'), 'spin is not in the profile');
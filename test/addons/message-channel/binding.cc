@@ -0,0 +1,170 @@
+#include <node.h>
+#include <node_buffer.h>
+#include <v8.h>
+#include <uv.h>
+
+#include <assert.h>
+#include <string>
+#include <vector>
+
+#ifdef NODE_ENGINE_CHAKRACORE
+using v8::chakrashim::MessageChannel;
+
+// Posts the string and array buffers passed in through a channel and returns
+// what comes out of it: [message, buffers].
+void RoundTrip(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::Isolate* isolate = args.GetIsolate();
+  std::vector<v8::Local<v8::ArrayBuffer>> transfer;
+  for (int i = 1; i < args.Length(); i++) {
+    transfer.push_back(args[i].As<v8::ArrayBuffer>());
+  }
+
+  MessageChannel* channel = MessageChannel::New();
+  bool posted = channel->Post(isolate, args[0].As<v8::String>(),
+                              transfer.data(),
+                              static_cast<int>(transfer.size()));
+  assert(posted);
+  assert(channel->GetPendingCount() == 1);
+
+  v8::Local<v8::String> message;
+  v8::Local<v8::Array> buffers;
+  bool received = channel->Receive(isolate, &message, &buffers);
+  assert(received);
+  assert(!channel->Receive(isolate, &message, &buffers));
+  channel->Unref();
+
+  v8::Local<v8::Array> result = v8::Array::New(isolate, 2);
+  result->Set(0, message);
+  result->Set(1, buffers);
+  args.GetReturnValue().Set(result);
+}
+
+// Posts the string and array buffers passed in through a channel that is
+// dropped with the message, and returns whether it was posted.
+void Post(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  std::vector<v8::Local<v8::ArrayBuffer>> transfer;
+  for (int i = 1; i < args.Length(); i++) {
+    transfer.push_back(args[i].As<v8::ArrayBuffer>());
+  }
+
+  MessageChannel* channel = MessageChannel::New();
+  bool posted = channel->Post(args.GetIsolate(), args[0].As<v8::String>(),
+                              transfer.data(),
+                              static_cast<int>(transfer.size()));
+  assert(channel->GetPendingCount() == (posted ? 1 : 0));
+  channel->Unref();
+  args.GetReturnValue().Set(posted);
+}
+
+// A Buffer over memory allocated outside of the engine.
+void ExternalBuffer(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::String::Utf8Value data(args[0]);
+  args.GetReturnValue().Set(
+      node::Buffer::Copy(args.GetIsolate(), *data, data.length())
+          .ToLocalChecked());
+}
+
+struct Worker {
+  uv_thread_t thread;
+  uv_async_t async;
+  MessageChannel* toWorker;
+  MessageChannel* toMain;
+  v8::Isolate* isolate;
+  v8::Persistent<v8::Function> callback;
+};
+
+// Runs in an isolate of its own: sums the bytes of the buffer it receives and
+// sends the sum back along with the buffer.
+void WorkerMain(void* arg) {
+  Worker* worker = static_cast<Worker*>(arg);
+  v8::Isolate::CreateParams params;
+  v8::Isolate* isolate = v8::Isolate::New(params);
+  assert(isolate != nullptr);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> message;
+    v8::Local<v8::Array> buffers;
+    bool received = worker->toWorker->Receive(isolate, &message, &buffers);
+    assert(received);
+    v8::Local<v8::ArrayBuffer> buffer = buffers->Get(0).As<v8::ArrayBuffer>();
+
+    v8::ArrayBuffer::Contents contents = buffer->GetContents();
+    const unsigned char* data =
+        static_cast<const unsigned char*>(contents.Data());
+    unsigned int sum = 0;
+    for (size_t i = 0; i < contents.ByteLength(); i++) {
+      sum += data[i];
+    }
+
+    std::string reply = std::to_string(sum);
+    bool posted = worker->toMain->Post(
+        isolate, v8::String::NewFromUtf8(isolate, reply.c_str()), &buffer, 1);
+    assert(posted);
+  }
+  isolate->Dispose();
+}
+
+void NotifyMain(void* data) {
+  uv_async_send(static_cast<uv_async_t*>(data));
+}
+
+void AfterWorker(uv_async_t* async) {
+  Worker* worker = static_cast<Worker*>(async->data);
+  v8::Isolate* isolate = worker->isolate;
+  v8::HandleScope scope(isolate);
+
+  v8::Local<v8::String> message;
+  v8::Local<v8::Array> buffers;
+  if (!worker->toMain->Receive(isolate, &message, &buffers)) {
+    return;
+  }
+  uv_thread_join(&worker->thread);
+  uv_close(reinterpret_cast<uv_handle_t*>(async), [](uv_handle_t* handle) {
+    delete static_cast<Worker*>(handle->data);
+  });
+
+  v8::Local<v8::Value> argv[] = { message, buffers->Get(0) };
+  v8::Local<v8::Function> callback =
+      v8::Local<v8::Function>::New(isolate, worker->callback);
+  worker->callback.Reset();
+  worker->toWorker->Unref();
+  worker->toMain->Unref();
+  callback->Call(isolate->GetCurrentContext()->Global(), 2, argv);
+}
+
+// Sends an array buffer to a thread running its own isolate, and calls back
+// with the sum of its bytes and the buffer once the thread sends it back.
+void SumOnThread(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::Isolate* isolate = args.GetIsolate();
+  Worker* worker = new Worker();
+  worker->isolate = isolate;
+  worker->callback.Reset(isolate, args[1].As<v8::Function>());
+  worker->toWorker = MessageChannel::New();
+  worker->toMain = MessageChannel::New();
+  worker->async.data = worker;
+  uv_async_init(uv_default_loop(), &worker->async, AfterWorker);
+  worker->toMain->SetNotifyCallback(NotifyMain, &worker->async);
+
+  v8::Local<v8::ArrayBuffer> buffer = args[0].As<v8::ArrayBuffer>();
+  bool posted = worker->toWorker->Post(
+      isolate, v8::String::Empty(isolate), &buffer, 1);
+  assert(posted);
+  uv_thread_create(&worker->thread, WorkerMain, worker);
+}
+
+void init(v8::Local<v8::Object> target) {
+  NODE_SET_METHOD(target, "roundTrip", RoundTrip);
+  NODE_SET_METHOD(target, "post", Post);
+  NODE_SET_METHOD(target, "externalBuffer", ExternalBuffer);
+  NODE_SET_METHOD(target, "sumOnThread", SumOnThread);
+}
+#else
+void init(v8::Local<v8::Object> target) {
+}
+#endif
+
+NODE_MODULE(binding, init);
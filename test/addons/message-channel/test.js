@@ -0,0 +1,66 @@
+'use strict';
+const common = require('../../common');
+const assert = require('assert');
+const binding = require('./build/Release/binding');
+
+if (!common.isChakraEngine) {
+  common.skip('MessageChannel is only implemented by chakrashim');
+  return;
+}
+
+// Array buffers owning their memory are moved, leaving the original detached.
+const owned = new ArrayBuffer(16);
+new Uint8Array(owned).fill(7);
+const view = new Uint8Array(owned);
+let [message, buffers] = binding.roundTrip('héllo', owned);
+assert.strictEqual(message, 'héllo');
+assert.strictEqual(buffers.length, 1);
+assert.strictEqual(owned.byteLength, 0);
+assert.strictEqual(view.length, 0);
+assert.deepStrictEqual(Array.from(new Uint8Array(buffers[0])),
+                       new Array(16).fill(7));
+
+// A Buffer over a detached array buffer reads as empty in native code.
+const moved = new ArrayBuffer(8);
+const movedBuf = Buffer.from(moved);
+movedBuf.fill('a');
+binding.roundTrip('', moved);
+assert.strictEqual(movedBuf.length, 0);
+assert.strictEqual(Buffer.compare(movedBuf, Buffer.from('a')), -1);
+assert.strictEqual(movedBuf.indexOf('a'), -1);
+assert(movedBuf.equals(Buffer.alloc(0)));
+
+// External memory can't be moved, so it is copied and stays usable.
+const buf = binding.externalBuffer('message channel');
+[message, buffers] = binding.roundTrip('', buf.buffer);
+assert.strictEqual(message, '');
+assert.strictEqual(buf.toString(), 'message channel');
+assert.strictEqual(Buffer.from(buffers[0]).toString(), 'message channel');
+
+// A buffer listed twice, or one already detached, can't be transferred, and
+// the message is rejected before any of its buffers is detached.
+const twice = new ArrayBuffer(4);
+assert.strictEqual(binding.post('', twice, twice), false);
+assert.strictEqual(twice.byteLength, 4);
+const first = new ArrayBuffer(4);
+assert.strictEqual(binding.post('', first, owned), false);
+assert.strictEqual(first.byteLength, 4);
+assert.strictEqual(binding.post('', first, buf.buffer), true);
+assert.strictEqual(first.byteLength, 0);
+assert.strictEqual(buf.toString(), 'message channel');
+
+// A message without buffers.
+[message, buffers] = binding.roundTrip('alone');
+assert.strictEqual(message, 'alone');
+assert.strictEqual(buffers.length, 0);
+
+// The buffer travels to an isolate on another thread and back.
+const data = new ArrayBuffer(256);
+new Uint8Array(data).forEach((_, i, a) => { a[i] = i; });
+binding.sumOnThread(data, common.mustCall((sum, back) => {
+  assert.strictEqual(sum, String(255 * 256 / 2));
+  assert.strictEqual(data.byteLength, 0);
+  assert.strictEqual(back.byteLength, 256);
+  assert.strictEqual(new Uint8Array(back)[255], 255);
+}));
+assert.strictEqual(data.byteLength, 0);
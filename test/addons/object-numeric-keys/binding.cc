@@ -0,0 +1,39 @@
+#include <node.h>
+#include <v8.h>
+
+// Each method takes the object and the key as values, so numeric keys go
+// through the same property ID lookup as string and symbol keys.
+
+void Set(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::Local<v8::Context> context = args.GetIsolate()->GetCurrentContext();
+  v8::Local<v8::Object> object = args[0].As<v8::Object>();
+  args.GetReturnValue().Set(
+      object->Set(context, args[1], args[2]).FromJust());
+}
+
+void Get(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::Local<v8::Context> context = args.GetIsolate()->GetCurrentContext();
+  v8::Local<v8::Object> object = args[0].As<v8::Object>();
+  args.GetReturnValue().Set(object->Get(context, args[1]).ToLocalChecked());
+}
+
+void Has(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::Local<v8::Context> context = args.GetIsolate()->GetCurrentContext();
+  v8::Local<v8::Object> object = args[0].As<v8::Object>();
+  args.GetReturnValue().Set(object->Has(context, args[1]).FromJust());
+}
+
+void Delete(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::Local<v8::Context> context = args.GetIsolate()->GetCurrentContext();
+  v8::Local<v8::Object> object = args[0].As<v8::Object>();
+  args.GetReturnValue().Set(object->Delete(context, args[1]).FromJust());
+}
+
+void init(v8::Local<v8::Object> target) {
+  NODE_SET_METHOD(target, "set", Set);
+  NODE_SET_METHOD(target, "get", Get);
+  NODE_SET_METHOD(target, "has", Has);
+  NODE_SET_METHOD(target, "delete", Delete);
+}
+
+NODE_MODULE(binding, init);
@@ -0,0 +1,33 @@
+'use strict';
+require('../../common');
+const assert = require('assert');
+const binding = require('./build/Release/binding');
+
+// Integer and double keys name the same properties as their string forms.
+for (const key of [0, 1, -1, 2147483647, 4294967296, 1.5, -0.25, 1e21, NaN]) {
+  const object = {};
+  assert.strictEqual(binding.set(object, key, 'value'), true);
+  assert.strictEqual(object[String(key)], 'value');
+  assert.strictEqual(binding.get(object, key), 'value');
+  assert.strictEqual(binding.has(object, key), true);
+  assert.strictEqual(binding.delete(object, key), true);
+  assert.strictEqual(binding.has(object, key), false);
+  assert.strictEqual(binding.get(object, key), undefined);
+}
+
+// Including on arrays, where integer keys are elements.
+const array = [];
+binding.set(array, 3, 'x');
+binding.set(array, 0.5, 'y');
+assert.strictEqual(array.length, 4);
+assert.strictEqual(array[3], 'x');
+assert.strictEqual(array['0.5'], 'y');
+assert.strictEqual(binding.get(array, 3), 'x');
+
+// String and symbol keys still work.
+const symbol = Symbol('key');
+const object = {};
+binding.set(object, 'name', 1);
+binding.set(object, symbol, 2);
+assert.strictEqual(binding.get(object, 'name'), 1);
+assert.strictEqual(binding.get(object, symbol), 2);
@@ -0,0 +1,52 @@
+#include "node.h"
+#include "v8.h"
+
+namespace {
+
+const int kHandleCount = 100;
+
+v8::Persistent<v8::Object> handles[kHandleCount];
+int indices[kHandleCount];
+int callback_count = 0;
+
+void WeakCallback(const v8::WeakCallbackInfo<int>& info) {
+  callback_count++;
+  handles[*info.GetParameter()].Reset();
+}
+
+// Creates kHandleCount objects that are only reachable through weak handles.
+inline void MakeWeak(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::Isolate* const isolate = args.GetIsolate();
+  v8::HandleScope scope(isolate);
+  for (int i = 0; i < kHandleCount; i++) {
+    v8::Local<v8::Object> object = v8::Object::New(isolate);
+    object->Set(v8::String::NewFromUtf8(isolate, "index"),
+                v8::Integer::New(isolate, i));
+    indices[i] = i;
+    handles[i].Reset(isolate, object);
+    handles[i].SetWeak(&indices[i], WeakCallback,
+                       v8::WeakCallbackType::kParameter);
+  }
+}
+
+// Returns the object behind handle i, or undefined once it has been reset.
+inline void Get(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::Isolate* const isolate = args.GetIsolate();
+  const int i = args[0]->Int32Value();
+  if (!handles[i].IsEmpty())
+    args.GetReturnValue().Set(v8::Local<v8::Object>::New(isolate, handles[i]));
+}
+
+inline void CallbackCount(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  args.GetReturnValue().Set(callback_count);
+}
+
+inline void Initialize(v8::Local<v8::Object> binding) {
+  NODE_SET_METHOD(binding, "makeWeak", MakeWeak);
+  NODE_SET_METHOD(binding, "get", Get);
+  NODE_SET_METHOD(binding, "callbackCount", CallbackCount);
+}
+
+NODE_MODULE(binding, Initialize)
+
+}  // anonymous namespace
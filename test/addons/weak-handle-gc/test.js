@@ -0,0 +1,37 @@
+'use strict';
+const common = require('../../common');
+const assert = require('assert');
+const binding = require('./build/Release/binding');
+
+// Weak handles must read as empty as soon as script can run again after the
+// GC that collected their objects, including when the GC sweeps concurrently
+// with script. So allocate to trigger GCs, rather than calling gc(), and check
+// every handle between allocations.
+binding.makeWeak();
+
+const start = Date.now();
+let collected = 0;
+let garbage = [];
+while (collected < 50 && Date.now() - start < 20000) {
+  for (let i = 0; i < 10000; i++)
+    garbage.push({ i: i, s: 'x' + i });
+  garbage = [];
+
+  collected = 0;
+  for (let i = 0; i < 100; i++) {
+    const object = binding.get(i);
+    if (object === undefined)
+      collected++;
+    else
+      assert.strictEqual(object.index, i);
+  }
+  assert.strictEqual(binding.callbackCount(), collected);
+}
+
+assert(collected > 0, 'no weakly held object was collected');
+
+if (common.isChakraEngine) {
+  const statistics = process.binding('v8').getEngineStatistics();
+  assert(statistics.weakCallbackCollectionCount > 0);
+  assert(statistics.totalWeakCallbackCount >= collected);
+}
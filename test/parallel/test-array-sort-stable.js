@@ -0,0 +1,75 @@
+'use strict';
+require('../common');
+const assert = require('assert');
+
+// Long enough to be sorted by merging runs rather than by insertion.
+const n = 2000;
+
+// Equal keys keep their original order, with and without a comparator.
+const objects = [];
+for (let i = 0; i < n; i++) objects.push({ key: (i * 7919) % 13, index: i });
+objects.sort((a, b) => a.key - b.key);
+for (let i = 1; i < n; i++) {
+  const a = objects[i - 1];
+  const b = objects[i];
+  assert(a.key < b.key || (a.key === b.key && a.index < b.index));
+}
+
+const strings = [];
+for (let i = 0; i < n; i++) strings.push(i % 2 ? String(i % 10) : i % 10);
+strings.sort();
+for (let i = 1; i < n; i++) {
+  const a = strings[i - 1];
+  const b = strings[i];
+  assert(String(a) <= String(b));
+  if (String(a) === String(b) && typeof a !== typeof b) {
+    assert.strictEqual(typeof a, 'number');
+  }
+}
+
+// Ints without a comparator are ordered as strings.
+const ints = [10, 9, 1, -1, -10, 100, 2, 0, -2147483648, 2147483647, -2];
+assert.deepStrictEqual(ints.sort(),
+                       [-1, -10, -2, -2147483648, 0, 1, 10, 100, 2,
+                        2147483647, 9]);
+const manyInts = [];
+for (let i = 0; i < n; i++) manyInts.push(((i * 7919) % 4001) - 2000);
+const expected = manyInts.map(String).sort();
+assert.deepStrictEqual(manyInts.sort().map(String), expected);
+
+// Holes and undefined go last.
+const holey = [3, undefined, 1, 2];
+holey.length = 5;
+holey.sort();
+assert.deepStrictEqual(holey.slice(0, 4), [1, 2, 3, undefined]);
+assert(!(4 in holey));
+
+// A comparator that throws leaves every element in the array.
+const victims = [];
+for (let i = 0; i < n; i++) victims.push((i * 7919) % n);
+let calls = 0;
+assert.throws(() => {
+  victims.sort((a, b) => {
+    if (++calls === 15000) throw new Error('stop');
+    return a - b;
+  });
+}, /stop/);
+assert.deepStrictEqual(victims.slice().sort((a, b) => a - b),
+                       Array.from({ length: n }, (v, i) => i));
+
+// Typed arrays sort numerically, NaN last and -0 before +0.
+const floats = new Float64Array([3, NaN, -0, 0, -Infinity, 1.5, NaN, 0, -0]);
+floats.sort();
+const signed = Array.from(floats).map((v) => Object.is(v, -0) ? '-0' : v);
+assert.deepStrictEqual(signed,
+                       [-Infinity, '-0', '-0', 0, 0, 1.5, 3, NaN, NaN]);
+
+for (const T of [Int8Array, Uint8Array, Int16Array, Uint16Array, Int32Array]) {
+  const ta = new T(n);
+  for (let i = 0; i < n; i++) ta[i] = (i * 7919) - 1000;
+  const sorted = Array.from(ta).sort((a, b) => a - b);
+  assert.deepStrictEqual(Array.from(ta.sort()), sorted);
+  for (let i = 0; i < n; i++) ta[i] = (i * 7919) - 1000;
+  assert.deepStrictEqual(Array.from(ta.sort((a, b) => b - a)),
+                         sorted.reverse());
+}
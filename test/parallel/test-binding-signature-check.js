@@ -0,0 +1,20 @@
+'use strict';
+require('../common');
+const assert = require('assert');
+const TCP = process.binding('tcp_wrap').TCP;
+const Pipe = process.binding('pipe_wrap').Pipe;
+
+// Native prototype methods check that their receiver was made from the
+// template they belong to. Once a method has accepted many calls on a good
+// receiver, it must still reject every other kind.
+const handle = new TCP();
+for (let i = 0; i < 1000; i++)
+  assert.strictEqual(typeof handle.getsockname({}), 'number');
+
+[{}, new Pipe(), Object.create(handle)].forEach(function(receiver) {
+  assert.throws(function() {
+    TCP.prototype.getsockname.call(receiver, {});
+  }, /^TypeError: Illegal invocation$/);
+});
+
+handle.close();
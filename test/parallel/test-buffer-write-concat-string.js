@@ -0,0 +1,36 @@
+'use strict';
+require('../common');
+const assert = require('assert');
+
+// Strings built by concatenation are written out as UTF-8 piece by piece.
+// Surrogate pairs split across pieces must still be encoded as one character.
+let built = '';
+const parts = [];
+for (let i = 0; i < 10000; i++) {
+  const part = 'row ' + i + ' é中\ud83d';
+  parts.push(part, '\ude00\n');
+  built += part;
+  built += '\ude00\n';
+}
+const flat = parts.join('');
+assert.strictEqual(Buffer.byteLength(built), Buffer.byteLength(flat));
+assert.ok(Buffer.from(built).equals(Buffer.from(flat)));
+assert.strictEqual(Buffer.from(built).toString(), flat);
+
+const pair = '\ud83d' + '\ude00';
+assert.deepStrictEqual(Array.from(Buffer.from(pair)), [0xf0, 0x9f, 0x98, 0x80]);
+
+// Buffer.from asks for lone surrogates to be replaced with U+FFFD.
+assert.deepStrictEqual(Array.from(Buffer.from('a' + '\ud83d')),
+                       [0x61, 0xef, 0xbf, 0xbd]);
+assert.deepStrictEqual(Array.from(Buffer.from('\ude00' + 'a')),
+                       [0xef, 0xbf, 0xbd, 0x61]);
+assert.deepStrictEqual(Array.from(Buffer.from('\ud83d' + 'a')),
+                       [0xef, 0xbf, 0xbd, 0x61]);
+
+// A partial write stops before the first character that does not fit.
+const buf = Buffer.alloc(5, 0);
+assert.strictEqual(buf.write('ab' + pair + 'c'), 2);
+assert.deepStrictEqual(Array.from(buf), [0x61, 0x62, 0, 0, 0]);
+assert.strictEqual(buf.write('a' + '中' + pair), 4);
+assert.deepStrictEqual(Array.from(buf), [0x61, 0xe4, 0xb8, 0xad, 0]);
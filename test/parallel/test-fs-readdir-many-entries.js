@@ -0,0 +1,24 @@
+// Flags: --expose-gc
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+
+// readdirSync creates a local handle for every entry inside a single native
+// handle scope, so a large directory makes that scope spill over many chunks
+// of handle storage. Every name has to survive until it is returned.
+const count = 3000;
+common.refreshTmpDir();
+const expected = [];
+for (let i = 0; i < count; i++) {
+  const name = 'entry-' + i;
+  fs.writeFileSync(path.join(common.tmpDir, name), '');
+  expected.push(name);
+}
+
+for (let round = 0; round < 3; round++) {
+  const names = fs.readdirSync(common.tmpDir);
+  global.gc();
+  assert.deepStrictEqual(names.sort(), expected.slice().sort());
+}
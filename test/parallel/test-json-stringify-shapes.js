@@ -0,0 +1,75 @@
+'use strict';
+require('../common');
+const assert = require('assert');
+
+// Many objects of the same shape serialize identically to one-off objects.
+const rows = [];
+for (let i = 0; i < 100; i++) {
+  rows.push({ id: i, name: 'row"' + i, tags: ['a', 'b'],
+              nested: { ok: true } });
+}
+const json = JSON.stringify(rows);
+assert.deepStrictEqual(JSON.parse(json), rows);
+assert.strictEqual(JSON.stringify(rows[3]),
+                   '{"id":3,"name":"row\\"3","tags":["a","b"],' +
+                   '"nested":{"ok":true}}');
+
+// Property names that need escaping are quoted correctly.
+const escaped = [{ 'a"b': 1, 'c\nd': 2 }, { 'a"b': 3, 'c\nd': 4 }];
+assert.strictEqual(JSON.stringify(escaped),
+                   '[{"a\\"b":1,"c\\nd":2},{"a\\"b":3,"c\\nd":4}]');
+
+// A toJSON that reshapes its holder while it is being serialized.
+function Reshaping(v) {
+  this.first = {
+    toJSON: () => {
+      delete this.second;
+      this.third = 3;
+      return v;
+    }
+  };
+  this.second = 2;
+  this.fourth = 4;
+}
+assert.strictEqual(JSON.stringify([new Reshaping(1), new Reshaping(2)]),
+                   '[{"first":1,"fourth":4},{"first":2,"fourth":4}]');
+
+// Indentation and undefined members.
+const spaced = [{ a: 1, b: undefined }, { a: 2, b: undefined }];
+assert.strictEqual(JSON.stringify(spaced, null, 1),
+                   '[\n {\n  "a": 1\n },\n {\n  "a": 2\n }\n]');
+
+// Symbol-keyed properties are skipped.
+const sym = Symbol('s');
+const withSymbol = [{ x: 1, [sym]: 2 }, { x: 3, [sym]: 4 }];
+assert.strictEqual(JSON.stringify(withSymbol), '[{"x":1},{"x":3}]');
+
+// String values are escaped while the members are written out, and long
+// members grow the output past its initial size.
+const long = 'x'.repeat(10000);
+const strings = [];
+for (let i = 0; i < 10; i++) {
+  strings.push({ empty: '', ctrl: '\u0001\t' + i, uni: '\u00e9 ',
+                 long: long + i, built: ['a', i].join('-'),
+                 boxed: new String('s' + i), n: new Number(i),
+                 b: new Boolean(i % 2), nil: null, inf: Infinity });
+}
+assert.deepStrictEqual(JSON.parse(JSON.stringify(strings)),
+                       JSON.parse(JSON.stringify(strings.map((o) => {
+                         return Object.assign(Object.create(null), o);
+                       }))));
+assert.strictEqual(JSON.stringify(strings[1]),
+                   '{"empty":"","ctrl":"\\u0001\\t1","uni":"\u00e9 ",' +
+                   `"long":"${long}1","built":"a-1","boxed":"s1","n":1,` +
+                   '"b":true,"nil":null,"inf":null}');
+
+// Nested objects between primitive members keep their place.
+const mixed = [{ a: 1, o: { p: 'q' }, z: 'end' },
+               { a: 2, o: { p: 'r' }, z: 'end' }];
+assert.strictEqual(JSON.stringify(mixed),
+                   '[{"a":1,"o":{"p":"q"},"z":"end"},' +
+                   '{"a":2,"o":{"p":"r"},"z":"end"}]');
+assert.strictEqual(JSON.stringify(mixed, null, 2),
+                   '[\n  {\n    "a": 1,\n    "o": {\n      "p": "q"\n    },' +
+                   '\n    "z": "end"\n  },\n  {\n    "a": 2,\n    "o": {\n' +
+                   '      "p": "r"\n    },\n    "z": "end"\n  }\n]');
@@ -0,0 +1,59 @@
+'use strict';
+require('../common');
+const assert = require('assert');
+
+// Iteration order is insertion order, and survives deletes and re-adds.
+const m = new Map();
+for (let i = 0; i < 100; i++) m.set(i, i * 2);
+for (let i = 0; i < 100; i += 3) m.delete(i);
+m.set(0, 'again');
+const keys = Array.from(m.keys());
+assert.strictEqual(keys.length, 67);
+assert.strictEqual(keys[0], 1);
+assert.strictEqual(keys[keys.length - 1], 0);
+assert.strictEqual(m.get(0), 'again');
+assert.strictEqual(m.get(2), 4);
+assert.strictEqual(m.has(3), false);
+
+// An iterator keeps its place while the table is compacted underneath it.
+const s = new Set();
+for (let i = 0; i < 64; i++) s.add(i);
+const it = s.values();
+assert.deepStrictEqual(it.next(), { value: 0, done: false });
+assert.deepStrictEqual(it.next(), { value: 1, done: false });
+for (let i = 0; i < 60; i++) s.delete(i);   // shrinks the table
+for (let i = 100; i < 200; i++) s.add(i);   // grows it again
+const rest = [];
+for (let r = it.next(); !r.done; r = it.next()) rest.push(r.value);
+assert.strictEqual(rest.length, 104);
+assert.deepStrictEqual(rest.slice(0, 5), [60, 61, 62, 63, 100]);
+
+// Entries added during forEach are visited; deleted ones are not.
+const visited = [];
+const f = new Map([[1, 'a'], [2, 'b'], [3, 'c']]);
+f.forEach((v, k) => {
+  visited.push(k);
+  if (k === 1) {
+    f.delete(2);
+    f.set(4, 'd');
+  }
+});
+assert.deepStrictEqual(visited, [1, 3, 4]);
+
+// Clear while iterating moves the iterator to the (new) end.
+const c = new Set([1, 2, 3]);
+const cit = c.values();
+cit.next();
+c.clear();
+c.add(5);
+assert.deepStrictEqual(cit.next(), { value: 5, done: false });
+assert.deepStrictEqual(cit.next(), { value: undefined, done: true });
+c.add(6);
+assert.deepStrictEqual(cit.next(), { value: undefined, done: true });
+
+// SameValueZero keys.
+const z = new Map([[NaN, 1], [-0, 2], ['1', 3]]);
+assert.strictEqual(z.get(NaN), 1);
+assert.strictEqual(z.get(0), 2);
+assert.strictEqual(z.get(1), undefined);
+assert.strictEqual(z.size, 3);
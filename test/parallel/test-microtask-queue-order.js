@@ -0,0 +1,45 @@
+// Flags: --expose-gc
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+
+// Promise reactions run in the order they were queued, including reactions
+// queued while the queue is being drained, and well past the point where the
+// queue has to grow.
+const order = [];
+const count = 10000;
+const statistics = common.isChakraEngine ?
+  process.binding('v8').getEngineStatistics() : null;
+let p = Promise.resolve();
+for (let i = 0; i < count; i++) {
+  Promise.resolve(i).then((v) => order.push(v));
+}
+for (let i = 0; i < 3; i++) {
+  p = p.then(() => order.push('chain' + i));
+}
+
+// Queued reactions are only reachable from the queue, and must survive a GC.
+global.gc();
+
+// A rejected reaction does not stop the rest of the queue.
+Promise.reject(new Error('boom')).catch(common.mustCall((e) => {
+  assert.strictEqual(e.message, 'boom');
+}));
+
+process.nextTick(common.mustCall(() => {
+  // nextTick callbacks run before the microtask queue is drained.
+  assert.strictEqual(order.length, 0);
+}));
+
+setImmediate(common.mustCall(() => {
+  assert.strictEqual(order.length, count + 3);
+  for (let i = 0; i < count; i++)
+    assert.strictEqual(order[i], i);
+  assert.deepStrictEqual(order.slice(count), ['chain0', 'chain1', 'chain2']);
+
+  if (statistics) {
+    const after = process.binding('v8').getEngineStatistics();
+    assert(after.microtasksRun >= statistics.microtasksRun + count + 4);
+    assert(after.microtaskDrainTime > statistics.microtaskDrainTime);
+  }
+}));
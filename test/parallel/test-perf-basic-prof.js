@@ -0,0 +1,83 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const cp = require('child_process');
+const fs = require('fs');
+
+// The perf map and jitdump files are only written by chakracore on linux.
+if (!common.isChakraEngine) {
+  common.skip('perf map output is tested for chakra engine only.');
+  return;
+}
+if (process.platform !== 'linux' ||
+    (process.arch !== 'x64' && process.arch !== 'ia32')) {
+  common.skip('perf map output is only written on linux x86.');
+  return;
+}
+
+// Builds without the JIT, such as the default linux build, have no perf output
+// and warn about the flags instead.
+{
+  const args = ['--perf-basic-prof', '-e', '0'];
+  const child = cp.spawnSync(process.execPath, args);
+  if (/not supported on this platform/.test(child.stderr.toString())) {
+    common.skip('perf map output needs chakracore built with the JIT.');
+    return;
+  }
+  try {
+    fs.unlinkSync(`/tmp/perf-${child.pid}.map`);
+  } catch (e) {}
+}
+
+const script = `
+  function hotPerfMapFunction(n) {
+    var sum = 0;
+    for (var i = 0; i < n; i++)
+      sum += i * 3;
+    return sum;
+  }
+  var start = Date.now();
+  (function run() {
+    for (var j = 0; j < 100; j++)
+      hotPerfMapFunction(1000);
+    if (Date.now() - start < 1000)
+      setImmediate(run);
+  })();
+`;
+
+function run(flag) {
+  const child = cp.spawnSync(process.execPath, [flag, '-e', script]);
+  assert.strictEqual(child.status, 0, child.stderr.toString());
+  return child.pid;
+}
+
+{
+  const pid = run('--perf-basic-prof');
+  const file = `/tmp/perf-${pid}.map`;
+  const map = fs.readFileSync(file, 'utf8');
+  fs.unlinkSync(file);
+
+  // "START SIZE name" in hex, one line per code range
+  assert(/^[0-9a-f]+ [0-9a-f]+ JS:[*+~]hotPerfMapFunction /m.test(map), map);
+  for (const line of map.split('\n').filter((line) => line)) {
+    assert(/^[0-9a-f]+ [0-9a-f]+ \S/.test(line), line);
+  }
+}
+
+{
+  const pid = run('--perf-prof');
+  const file = `/tmp/jit-${pid}.dump`;
+  const dump = fs.readFileSync(file);
+  fs.unlinkSync(file);
+
+  // File header: magic "JiTD", version 1, header size 40, then the pid
+  assert.strictEqual(dump.readUInt32LE(0), 0x4A695444);
+  assert.strictEqual(dump.readUInt32LE(4), 1);
+  assert.strictEqual(dump.readUInt32LE(8), 40);
+  assert.strictEqual(dump.readUInt32LE(20), pid);
+  assert(dump.indexOf('hotPerfMapFunction') > 0);
+
+  // The file ends with the close record written at exit: id 3, size 16
+  assert.strictEqual(dump.readUInt32LE(dump.length - 16), 3);
+  assert.strictEqual(dump.readUInt32LE(dump.length - 12), 16);
+}
@@ -0,0 +1,92 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const cp = require('child_process');
+
+if (!common.isChakraEngine) {
+  common.skip('loop body JIT telemetry is only kept by chakra engine.');
+  return;
+}
+
+// A function that is only called once, so its loop can only leave the
+// interpreter by jumping into the JIT'd loop body. JIT compilation happens in
+// the background, so the loop runs until it has been entered.
+const script = `
+  const binding = process.binding('v8');
+  function find() {
+    return binding.getJitTelemetry()
+      .find((entry) => entry.name === 'longStartupLoop');
+  }
+  function longStartupLoop() {
+    const start = Date.now();
+    let sum = 0;
+    for (let i = 0; ; i++) {
+      sum += i & 7;
+      if ((i & 0xffff) === 0) {
+        const entry = find();
+        if ((entry && entry.loopBodyEntryCount > 0) ||
+            Date.now() - start > 10000)
+          break;
+      }
+    }
+    return sum;
+  }
+  longStartupLoop();
+  console.log(JSON.stringify(find()));
+`;
+
+function run(...flags) {
+  const child = cp.spawnSync(process.execPath, [...flags, '-e', script]);
+  assert.strictEqual(child.status, 0, child.stderr.toString());
+  const entry = JSON.parse(child.stdout.toString());
+  assert(entry, 'longStartupLoop was never queued for JIT');
+  assert.strictEqual(entry.tier, 'interpreter');
+  assert(entry.loopBodyJitCount > 0);
+  assert(entry.loopBodyEntryCount > 0);
+}
+
+run();
+run('--loop-jit-threshold=1');
+
+// A loop that runs a million times is queued for JIT with the default
+// threshold, but never with a threshold above its iteration count. JIT
+// compilation happens in the background, so give it time to finish.
+const boundedScript = `
+  const binding = process.binding('v8');
+  function boundedLoop() {
+    let sum = 0;
+    for (let i = 0; i < 1000000; i++)
+      sum += i & 7;
+    return sum;
+  }
+  boundedLoop();
+  const start = Date.now();
+  (function report() {
+    const entry = binding.getJitTelemetry()
+      .find((entry) => entry.name === 'boundedLoop');
+    const count = entry ? entry.loopBodyJitCount : 0;
+    if (count === 0 && Date.now() - start < 2000) {
+      setTimeout(report, 10);
+      return;
+    }
+    console.log(count);
+  })();
+`;
+
+function runBounded(...flags) {
+  const child = cp.spawnSync(process.execPath,
+                             [...flags, '-e', boundedScript]);
+  assert.strictEqual(child.status, 0, child.stderr.toString());
+  return { count: +child.stdout.toString(), stderr: child.stderr.toString() };
+}
+
+assert(runBounded().count > 0);
+assert.strictEqual(runBounded('--loop-jit-threshold=1000000000').count, 0);
+
+// Values that aren't a count are ignored with a warning
+for (const value of ['abc', '12abc', '-5', '']) {
+  const result = runBounded(`--loop-jit-threshold=${value}`);
+  assert(result.count > 0);
+  const warning = /Warning: --loop-jit-threshold has an invalid value/;
+  assert(warning.test(result.stderr), result.stderr);
+}
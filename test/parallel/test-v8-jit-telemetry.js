@@ -0,0 +1,57 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+
+if (!common.isChakraEngine) {
+  common.skip('JIT telemetry is only kept by chakra engine.');
+  return;
+}
+
+const binding = process.binding('v8');
+
+function hotJitTelemetryFunction(o) {
+  return o.x + 1;
+}
+
+function find() {
+  return binding.getJitTelemetry()
+    .find((entry) => entry.name === 'hotJitTelemetryFunction');
+}
+
+// JIT compilation happens in the background, so keep calling the function
+// until it has been compiled, then change the type of its argument to make the
+// JIT'd code bail out.
+const start = Date.now();
+let bailedOut = false;
+(function run() {
+  for (let i = 0; i < 1000; i++)
+    hotJitTelemetryFunction({ x: i });
+
+  const entry = find();
+  if (entry && entry.fullJitCount + entry.simpleJitCount > 0 && !bailedOut) {
+    bailedOut = true;
+    for (let i = 0; i < 10; i++)
+      hotJitTelemetryFunction({ y: 0, x: 'a' });
+  }
+  if ((!entry || entry.bailOutCount === 0) && Date.now() - start < 10000) {
+    setImmediate(run);
+    return;
+  }
+
+  assert(entry, 'hotJitTelemetryFunction was never queued for JIT');
+  assert(/test-v8-jit-telemetry\.js$/.test(entry.url), entry.url);
+  assert.strictEqual(entry.lineNumber, 12);
+  assert(['interpreter', 'simpleJit', 'fullJit'].includes(entry.tier));
+  assert(entry.simpleJitCount + entry.fullJitCount > 0);
+  assert(entry.codeGenTime > 0);
+  assert(entry.bailOutCount > 0);
+  // The object literals are created by the caller, so none can be removed
+  assert.strictEqual(entry.scalarReplacedObjectCount, 0);
+
+  let total = entry.otherBailOutCount;
+  for (const kind of Object.keys(entry.bailOuts)) {
+    assert(/Bail/.test(kind), kind);
+    total += entry.bailOuts[kind];
+  }
+  assert.strictEqual(total, entry.bailOutCount);
+})();
@@ -0,0 +1,25 @@
+'use strict';
+// Flags: --expose-gc
+require('../common');
+const assert = require('assert');
+const vm = require('vm');
+
+// Every contextified sandbox is tied to its native context through a weak
+// handle. Drop most of them between collections so each collection releases
+// many weak handles at once, and check the ones still referenced survive.
+const kept = [];
+for (let round = 0; round < 10; round++) {
+  for (let i = 0; i < 200; i++) {
+    const sandbox = vm.createContext({ round: round, index: i });
+    vm.runInContext('var value = round * 1000 + index;', sandbox);
+    if (i % 50 === 0)
+      kept.push(sandbox);
+  }
+  global.gc();
+}
+
+assert.strictEqual(kept.length, 40);
+kept.forEach(function(sandbox) {
+  assert.strictEqual(sandbox.value, sandbox.round * 1000 + sandbox.index);
+  assert.strictEqual(vm.runInContext('value + 1', sandbox), sandbox.value + 1);
+});
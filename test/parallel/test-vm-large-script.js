@@ -0,0 +1,53 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const cp = require('child_process');
+const vm = require('vm');
+
+// Large scripts may have their function bodies parsed on background threads.
+// The result must be the same as parsing them in order.
+const parts = ['var results = [];'];
+for (let i = 0; i < 2000; i++) {
+  parts.push(`results.push((function f${i}(a, b) {
+    var s = '${'x'.repeat(20)}' + a;
+    for (var k = 0; k < b; k++) s += k;
+    return s.length + ${i};
+  })(${i}, 3));`);
+}
+parts.push('results;');
+const source = parts.join('\n');
+assert.ok(source.length > 128 * 1024);
+
+function backgroundParsedFunctionCount() {
+  return common.isChakraEngine ?
+    process.binding('v8').getEngineStatistics().backgroundParsedFunctionCount :
+    0;
+}
+
+const parsedBefore = backgroundParsedFunctionCount();
+
+const results = vm.runInThisContext(source);
+assert.strictEqual(results.length, 2000);
+for (let i = 0; i < 2000; i++)
+  assert.strictEqual(results[i], 20 + String(i).length + 3 + i);
+
+// A syntax error in a late function body is still reported.
+const broken = source.replace('return s.length + 1999;', 'return s.length +;');
+assert.throws(() => vm.runInThisContext(broken), SyntaxError);
+
+if (process.argv[2] === 'child') {
+  console.log(backgroundParsedFunctionCount() - parsedBefore);
+  return;
+}
+
+if (common.isChakraEngine) {
+  // Parallel parse is opt-in, so everything was parsed on the main thread.
+  assert.strictEqual(backgroundParsedFunctionCount(), parsedBefore);
+
+  // With it turned on, some of the function bodies are parsed on background
+  // threads.
+  const child = cp.spawnSync(process.execPath,
+                             ['--parallel_parse', __filename, 'child']);
+  assert.strictEqual(child.status, 0, child.stderr.toString());
+  assert(+child.stdout.toString() > 0, child.stdout.toString());
+}
@@ -0,0 +1,28 @@
+'use strict';
+require('../common');
+const assert = require('assert');
+const vm = require('vm');
+
+// Enumerating the global of a context goes through the sandbox's property
+// interceptors, which list indexed and named keys separately.
+const proto = { inherited: 1 };
+const sandbox = Object.create(proto);
+sandbox.b = 1;
+sandbox[1] = 'one';
+sandbox.a = 2;
+sandbox[0] = 'zero';
+sandbox['01'] = 'not an index';
+Object.defineProperty(sandbox, 'hidden', { value: 3, enumerable: false });
+vm.createContext(sandbox);
+
+const own = vm.runInContext('Object.keys(this)', sandbox);
+for (const key of ['0', '1', 'b', 'a', '01'])
+  assert(own.includes(key), `missing own key ${key}`);
+assert(!own.includes('hidden'));
+assert(own.indexOf('0') < own.indexOf('1'));
+
+const forIn = vm.runInContext(
+  'var names = []; for (var k in this) names.push(k); names', sandbox);
+for (const key of ['0', '1', 'b', 'a', '01', 'inherited'])
+  assert(forIn.includes(key), `missing enumerable key ${key}`);
+assert(!forIn.includes('hidden'));